@@ -0,0 +1,102 @@
+project "Arc-Benchmark"
+	kind "ConsoleApp"
+	language "C++"
+	cppdialect "C++20"
+	staticruntime "off"
+	warnings "extra"
+	externalwarnings "off"
+	rtti "off"
+	postbuildmessage "================ Post-Build: Copying dependencies ================"
+
+	flags { "FatalWarnings" }
+
+	binDir = "%{wks.location}/bin/" .. outputdir
+	targetdir ("%{wks.location}/bin/" .. outputdir .. "/%{prj.name}")
+	objdir ("%{wks.location}/bin-int/" .. outputdir .. "/%{prj.name}")
+	debugdir ("%{cfg.targetdir}")
+
+	files
+	{
+		"src/**.h",
+		"src/**.cpp",
+	}
+
+	includedirs
+	{
+		"src",
+		"%{wks.location}/Arc/src",
+		"%{wks.location}/Arc/vendor"
+	}
+
+	externalincludedirs
+	{
+		"%{wks.location}/Arc/vendor/spdlog/include",
+		"%{IncludeDir.glm}",
+		"%{IncludeDir.entt}",
+		"%{IncludeDir.optick}",
+		"%{IncludeDir.yaml_cpp}",
+	}
+	
+	links
+	{
+		"Arc",
+		"GLFW",
+		"Glad",
+		"ImGui",
+		"yaml-cpp",
+		"optick",
+		"box2d",
+		"JoltPhysics",
+	}
+
+	-- Shaders are loaded relative to the working directory
+	postbuildcommands
+	{
+		'{COPY} "../Arc-Editor/assets" "%{cfg.targetdir}"/assets',
+	}
+
+	filter "system:windows"
+		systemversion "latest"
+		links
+		{
+			"%{LibDir.Mono}/mono-2.0-sgen.lib",
+			"opengl.dll"
+		}
+
+	filter "system:linux"
+		pic "On"
+		systemversion "latest"
+		links
+		{
+			"monosgen-2.0:shared",
+			"GL:shared",
+			"dl:shared"
+		}
+
+	filter "configurations:Debug"
+		defines "ARC_DEBUG"
+		runtime "Debug"
+		symbols "on"
+		postbuildcommands
+		{
+			'{COPY} "%{BinDir.Mono}/mono-2.0-sgen.dll" "%{cfg.targetdir}"',
+		}
+
+	filter "configurations:Release"
+		defines "ARC_RELEASE"
+		runtime "Release"
+		optimize "speed"
+		postbuildcommands
+		{
+			'{COPY} "%{BinDir.Mono}/mono-2.0-sgen.dll" "%{cfg.targetdir}"',
+		}
+
+	filter "configurations:Dist"
+		defines "ARC_DIST"
+		runtime "Release"
+		optimize "speed"
+		symbols "off"
+		postbuildcommands
+		{
+			'{COPY} "%{BinDir.Mono}/mono-2.0-sgen.dll" "%{cfg.targetdir}"',
+		}
@@ -0,0 +1,222 @@
+#include "Benchmark.h"
+
+#include <yaml-cpp/yaml.h>
+
+namespace ArcEngine
+{
+	BenchmarkState::BenchmarkState(uint32_t warmupIterations, uint32_t iterations)
+		: m_WarmupIterations(warmupIterations), m_Iterations(iterations)
+	{
+		m_Times.reserve(iterations);
+		m_Allocations.reserve(iterations);
+	}
+
+	bool BenchmarkState::Next()
+	{
+		if (m_Iteration > 0)
+			EndIteration();
+
+		if (m_Iteration == m_WarmupIterations + m_Iterations)
+			return false;
+
+		++m_Iteration;
+		m_Paused = false;
+		m_Elapsed = {};
+		m_AllocationCount = 0;
+		m_AllocationStart = Application::GetAllocationCount();
+		m_Start = Clock::now();
+		return true;
+	}
+
+	void BenchmarkState::PauseTiming()
+	{
+		const Clock::time_point now = Clock::now();
+		if (m_Paused)
+			return;
+
+		m_Elapsed += now - m_Start;
+		m_AllocationCount += Application::GetAllocationCount() - m_AllocationStart;
+		m_Paused = true;
+	}
+
+	void BenchmarkState::ResumeTiming()
+	{
+		if (!m_Paused)
+			return;
+
+		m_Paused = false;
+		m_AllocationStart = Application::GetAllocationCount();
+		m_Start = Clock::now();
+	}
+
+	void BenchmarkState::EndIteration()
+	{
+		PauseTiming();
+		if (m_Iteration <= m_WarmupIterations)
+			return;
+
+		m_Times.push_back(std::chrono::duration<double, std::milli>(m_Elapsed).count());
+		m_Allocations.push_back(m_AllocationCount);
+	}
+
+	static double Percentile(const std::vector<double>& sorted, double percentile)
+	{
+		// Nearest rank
+		const size_t rank = static_cast<size_t>(std::ceil(percentile * static_cast<double>(sorted.size())));
+		return sorted[std::clamp<size_t>(rank, 1, sorted.size()) - 1];
+	}
+
+	void BenchmarkRunner::Register(const std::string& name, uint32_t iterations, const BenchmarkFunction& function)
+	{
+		m_Benchmarks.push_back({ name, iterations, function });
+	}
+
+	std::vector<BenchmarkResult> BenchmarkRunner::Run(const Options& options) const
+	{
+		std::vector<BenchmarkResult> results;
+		for (const Benchmark& benchmark : m_Benchmarks)
+		{
+			if (!options.Filter.empty() && benchmark.Name.find(options.Filter) == std::string::npos)
+				continue;
+
+			const uint32_t iterations = options.Iterations != 0 ? options.Iterations : benchmark.Iterations;
+			BenchmarkState state(options.WarmupIterations, iterations);
+			benchmark.Function(state);
+
+			std::vector<double> times = state.GetTimes();
+			if (times.empty())
+			{
+				ARC_APP_WARN("{}: no iterations were measured", benchmark.Name);
+				continue;
+			}
+			std::ranges::sort(times);
+
+			BenchmarkResult& result = results.emplace_back();
+			result.Name = benchmark.Name;
+			result.Iterations = static_cast<uint32_t>(times.size());
+			result.Min = times.front();
+			result.Max = times.back();
+			result.Mean = std::accumulate(times.begin(), times.end(), 0.0) / static_cast<double>(times.size());
+			result.P50 = Percentile(times, 0.5);
+			result.P90 = Percentile(times, 0.9);
+			result.P99 = Percentile(times, 0.99);
+
+			const std::vector<uint64_t>& allocations = state.GetAllocations();
+			result.AllocationsPerIteration = static_cast<double>(std::accumulate(allocations.begin(), allocations.end(), uint64_t(0))) / static_cast<double>(allocations.size());
+			result.Counters = state.GetCounters();
+
+			ARC_APP_INFO("{:<32} p50 {:>10.4f} ms  p90 {:>10.4f} ms  p99 {:>10.4f} ms  allocs {:>10.1f}",
+				result.Name, result.P50, result.P90, result.P99, result.AllocationsPerIteration);
+		}
+		return results;
+	}
+
+	void BenchmarkRunner::List() const
+	{
+		for (const Benchmark& benchmark : m_Benchmarks)
+			ARC_APP_INFO("{}", benchmark.Name);
+	}
+
+	void BenchmarkRunner::WriteReport(const std::vector<BenchmarkResult>& results, std::ostream& stream)
+	{
+		stream << "{\n";
+		stream << fmt::format("\t\"workers\": {},\n", JobSystem::GetWorkerCount());
+		stream << "\t\"benchmarks\": [";
+		for (size_t i = 0; i < results.size(); ++i)
+		{
+			const BenchmarkResult& result = results[i];
+			stream << (i == 0 ? "\n" : ",\n");
+			stream << "\t\t{\n";
+			stream << fmt::format("\t\t\t\"name\": \"{}\",\n", result.Name);
+			stream << fmt::format("\t\t\t\"iterations\": {},\n", result.Iterations);
+			stream << fmt::format("\t\t\t\"time_ms\": {{ \"min\": {}, \"mean\": {}, \"p50\": {}, \"p90\": {}, \"p99\": {}, \"max\": {} }},\n",
+				result.Min, result.Mean, result.P50, result.P90, result.P99, result.Max);
+			stream << fmt::format("\t\t\t\"allocations\": {},\n", result.AllocationsPerIteration);
+			stream << "\t\t\t\"counters\": {";
+			bool first = true;
+			for (const auto& [name, value] : result.Counters)
+			{
+				stream << fmt::format("{} \"{}\": {}", first ? "" : ",", name, value);
+				first = false;
+			}
+			stream << (result.Counters.empty() ? "}\n" : " }\n");
+			stream << "\t\t}";
+		}
+		stream << "\n\t]\n}\n";
+	}
+
+	bool BenchmarkRunner::CompareToBaseline(const std::vector<BenchmarkResult>& results, const std::filesystem::path& baselinePath, double threshold)
+	{
+		// Reports are JSON, which YAML is a superset of
+		YAML::Node data;
+		try
+		{
+			data = YAML::LoadFile(baselinePath.string());
+		}
+		catch (YAML::Exception& e)
+		{
+			ARC_APP_ERROR("Failed to load baseline '{0}'\n     {1}", baselinePath, e.what());
+			return false;
+		}
+
+		const YAML::Node benchmarks = data["benchmarks"];
+		if (!benchmarks)
+		{
+			ARC_APP_ERROR("Baseline '{}' has no benchmarks", baselinePath);
+			return false;
+		}
+
+		bool passed = true;
+		for (const BenchmarkResult& result : results)
+		{
+			// Entries are hand editable, a malformed one fails the comparison instead of the tool
+			bool found = false;
+			bool valid = true;
+			double baselineTime = 0.0;
+			double baselineAllocations = 0.0;
+			for (const YAML::Node& node : benchmarks)
+			{
+				try
+				{
+					if (!node.IsMap() || node["name"].as<std::string>(std::string()) != result.Name)
+						continue;
+
+					found = true;
+					baselineTime = node["time_ms"]["p50"].as<double>();
+					baselineAllocations = node["allocations"].as<double>();
+				}
+				catch (YAML::Exception& e)
+				{
+					ARC_APP_ERROR("{}: invalid baseline entry\n     {}", result.Name, e.what());
+					valid = false;
+				}
+				break;
+			}
+
+			if (!valid)
+			{
+				passed = false;
+				continue;
+			}
+
+			if (!found)
+			{
+				ARC_APP_WARN("{}: not in the baseline", result.Name);
+				continue;
+			}
+
+			if (result.P50 > baselineTime * (1.0 + threshold))
+			{
+				ARC_APP_ERROR("{}: p50 regressed from {:.4f} ms to {:.4f} ms", result.Name, baselineTime, result.P50);
+				passed = false;
+			}
+			// Allocation counts barely vary between runs, so any growth past the threshold is real
+			if (result.AllocationsPerIteration > baselineAllocations * (1.0 + threshold) + 0.5)
+			{
+				ARC_APP_ERROR("{}: allocations regressed from {:.1f} to {:.1f}", result.Name, baselineAllocations, result.AllocationsPerIteration);
+				passed = false;
+			}
+		}
+		return passed;
+	}
+}
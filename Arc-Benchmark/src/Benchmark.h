@@ -0,0 +1,108 @@
+#pragma once
+
+#include <ArcEngine.h>
+
+#include <chrono>
+#include <filesystem>
+#include <functional>
+#include <map>
+#include <numeric>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace ArcEngine
+{
+	// Handed to every benchmark, which measures the body of `while (state.Next())`.
+	// The first iterations are warmup and are left out of the results.
+	class BenchmarkState
+	{
+	public:
+		using Clock = std::chrono::steady_clock;
+
+		BenchmarkState(uint32_t warmupIterations, uint32_t iterations);
+
+		[[nodiscard]] bool Next();
+
+		// Setup work inside the loop goes between these, its time and allocations are not counted
+		void PauseTiming();
+		void ResumeTiming();
+
+		// Extra values for the report, like draw calls or bodies, the last value set wins
+		void SetCounter(const std::string& name, double value) { m_Counters[name] = value; }
+
+		[[nodiscard]] uint32_t GetIteration() const { return m_Iteration; }
+		[[nodiscard]] const std::vector<double>& GetTimes() const { return m_Times; }
+		[[nodiscard]] const std::vector<uint64_t>& GetAllocations() const { return m_Allocations; }
+		[[nodiscard]] const std::map<std::string, double>& GetCounters() const { return m_Counters; }
+
+	private:
+		void EndIteration();
+
+	private:
+		uint32_t m_WarmupIterations;
+		uint32_t m_Iterations;
+		uint32_t m_Iteration = 0;
+		bool m_Paused = false;
+
+		Clock::time_point m_Start;
+		Clock::duration m_Elapsed = {};
+		uint64_t m_AllocationStart = 0;
+		uint64_t m_AllocationCount = 0;
+
+		std::vector<double> m_Times;				// Milliseconds
+		std::vector<uint64_t> m_Allocations;
+		std::map<std::string, double> m_Counters;
+	};
+
+	struct BenchmarkResult
+	{
+		std::string Name;
+		uint32_t Iterations = 0;
+
+		// Milliseconds per iteration
+		double Min = 0.0;
+		double Mean = 0.0;
+		double P50 = 0.0;
+		double P90 = 0.0;
+		double P99 = 0.0;
+		double Max = 0.0;
+
+		double AllocationsPerIteration = 0.0;
+		std::map<std::string, double> Counters;
+	};
+
+	class BenchmarkRunner
+	{
+	public:
+		using BenchmarkFunction = std::function<void(BenchmarkState&)>;
+
+		struct Options
+		{
+			std::string Filter;				// Only benchmarks whose name contains this run
+			uint32_t WarmupIterations = 3;
+			uint32_t Iterations = 0;		// Overrides the count the benchmark was registered with when non-zero
+		};
+
+		void Register(const std::string& name, uint32_t iterations, const BenchmarkFunction& function);
+
+		[[nodiscard]] std::vector<BenchmarkResult> Run(const Options& options) const;
+		void List() const;
+
+		static void WriteReport(const std::vector<BenchmarkResult>& results, std::ostream& stream);
+
+		// Reports benchmarks whose median time or allocations grew by more than the threshold
+		// over a previous report. Returns false if there is a regression or the baseline cannot be read.
+		[[nodiscard]] static bool CompareToBaseline(const std::vector<BenchmarkResult>& results, const std::filesystem::path& baselinePath, double threshold);
+
+	private:
+		struct Benchmark
+		{
+			std::string Name;
+			uint32_t Iterations;
+			BenchmarkFunction Function;
+		};
+
+		std::vector<Benchmark> m_Benchmarks;
+	};
+}
@@ -0,0 +1,148 @@
+#include "Benchmarks.h"
+
+#include <charconv>
+#include <fstream>
+#include <iostream>
+
+namespace ArcEngine
+{
+	struct BenchmarkArguments
+	{
+		BenchmarkRunner::Options Options;
+		SceneGeneratorSpec Spec;
+		std::filesystem::path OutputPath;
+		std::filesystem::path BaselinePath;
+		std::filesystem::path ProjectPath;
+		double Threshold = 0.1;
+		bool List = false;
+	};
+
+	template<typename T>
+	static bool ParseNumber(std::string_view text, T& outValue)
+	{
+		const auto [end, error] = std::from_chars(text.data(), text.data() + text.size(), outValue);
+		return error == std::errc() && end == text.data() + text.size();
+	}
+
+	static bool ParseArguments(int argc, char** argv, BenchmarkArguments& outArguments)
+	{
+		for (int i = 1; i < argc; ++i)
+		{
+			const std::string_view argument = argv[i];
+			if (argument == "--list")
+			{
+				outArguments.List = true;
+				continue;
+			}
+
+			if (i + 1 >= argc)
+			{
+				ARC_APP_ERROR("Missing value for {}", argument);
+				return false;
+			}
+
+			const std::string_view value = argv[++i];
+			bool valid = true;
+			if (argument == "--filter")
+				outArguments.Options.Filter = value;
+			else if (argument == "--iterations")
+				valid = ParseNumber(value, outArguments.Options.Iterations);
+			else if (argument == "--warmup")
+				valid = ParseNumber(value, outArguments.Options.WarmupIterations);
+			else if (argument == "--seed")
+				valid = ParseNumber(value, outArguments.Spec.Seed);
+			else if (argument == "--out")
+				outArguments.OutputPath = value;
+			else if (argument == "--baseline")
+				outArguments.BaselinePath = value;
+			else if (argument == "--project")
+				outArguments.ProjectPath = value;
+			else if (argument == "--threshold")
+				valid = ParseNumber(value, outArguments.Threshold);
+			else
+			{
+				ARC_APP_ERROR("Unknown argument {}", argument);
+				return false;
+			}
+
+			if (!valid)
+			{
+				ARC_APP_ERROR("Invalid value for {}: {}", argument, value);
+				return false;
+			}
+		}
+		return true;
+	}
+}
+
+// Usage: Arc-Benchmark [--list] [--filter <text>] [--iterations <n>] [--warmup <n>] [--seed <n>]
+//                      [--out <report.json>] [--baseline <report.json>] [--threshold <fraction>]
+//                      [--project <project.arcproj>]
+// Script benchmarks only run with --project, which builds and loads the scripts of that project.
+// The report is written to stdout without --out. With --baseline the exit code is non-zero
+// if a benchmark regressed by more than the threshold, 0.1 by default.
+int main(int argc, char** argv)
+{
+	using namespace ArcEngine;
+
+	// The report may go to stdout, so it has to be the only thing there
+	Log::Init(true);
+
+	BenchmarkArguments arguments;
+	if (!ParseArguments(argc, argv, arguments))
+		return 2;
+
+	// Headless: the null backend records what would be drawn and AssetManager is left uninitialized,
+	// so assets load on the calling thread and no window or application is needed
+	RendererAPI::SetAPI(RendererAPI::API::None);
+	JobSystem::Init();
+	Renderer::Init();
+
+	BenchmarkRunner runner;
+	RegisterSceneBenchmarks(runner, arguments.Spec);
+	RegisterSystemBenchmarks(runner, arguments.Spec);
+
+	const bool scripting = !arguments.ProjectPath.empty();
+	if (scripting)
+	{
+		if (!Project::Load(arguments.ProjectPath))
+		{
+			ARC_APP_ERROR("Failed to load project {}", arguments.ProjectPath.string());
+			Renderer::Shutdown();
+			JobSystem::Shutdown();
+			return 2;
+		}
+
+		ScriptEngine::Init();
+		RegisterScriptBenchmarks(runner);
+	}
+
+	int result = 0;
+	if (arguments.List)
+	{
+		runner.List();
+	}
+	else
+	{
+		const std::vector<BenchmarkResult> results = runner.Run(arguments.Options);
+		if (arguments.OutputPath.empty())
+		{
+			BenchmarkRunner::WriteReport(results, std::cout);
+		}
+		else
+		{
+			std::ofstream file(arguments.OutputPath, std::ios::out | std::ios::trunc);
+			BenchmarkRunner::WriteReport(results, file);
+		}
+
+		if (!arguments.BaselinePath.empty() && !BenchmarkRunner::CompareToBaseline(results, arguments.BaselinePath, arguments.Threshold))
+			result = 1;
+	}
+
+	if (scripting)
+		ScriptEngine::Shutdown();
+	SceneGenerator::Shutdown();
+	Renderer::Shutdown();
+	JobSystem::Shutdown();
+	return result;
+}
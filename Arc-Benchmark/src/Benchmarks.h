@@ -0,0 +1,12 @@
+#pragma once
+
+#include "Benchmark.h"
+#include "SceneGenerator.h"
+
+namespace ArcEngine
+{
+	void RegisterSceneBenchmarks(BenchmarkRunner& runner, const SceneGeneratorSpec& spec);
+	void RegisterSystemBenchmarks(BenchmarkRunner& runner, const SceneGeneratorSpec& spec);
+	// Needs the script engine running with a project loaded
+	void RegisterScriptBenchmarks(BenchmarkRunner& runner);
+}
@@ -0,0 +1,139 @@
+#include "Benchmarks.h"
+
+#include <Arc/Scene/SceneSerializer.h>
+#include <Platform/Null/NullRecorder.h>
+
+namespace ArcEngine
+{
+	static constexpr uint32_t s_ViewportWidth = 1920;
+	static constexpr uint32_t s_ViewportHeight = 1080;
+	static constexpr float s_FrameTime = 1.0f / 60.0f;
+
+	static CameraData GetCameraData(Scene& scene)
+	{
+		CameraData cameraData = {};
+		const Entity cameraEntity = scene.GetPrimaryCameraEntity();
+		cameraData.View = glm::inverse(cameraEntity.GetWorldTransform());
+		cameraData.Projection = cameraEntity.GetComponent<CameraComponent>().Camera.GetProjection();
+		cameraData.ViewProjection = cameraData.Projection * cameraData.View;
+		cameraData.Position = cameraEntity.GetTransform().Translation;
+		return cameraData;
+	}
+
+	static void SetRenderCounters(BenchmarkState& state, uint32_t frames)
+	{
+		const NullRecorder::Statistics& stats = NullRecorder::GetStatistics();
+		state.SetCounter("draw_calls", static_cast<double>(stats.DrawCalls + stats.InstancedDrawCalls) / frames);
+		state.SetCounter("state_changes", static_cast<double>(stats.StateChanges) / frames);
+		state.SetCounter("bytes_uploaded", static_cast<double>(stats.BytesUploaded) / frames);
+	}
+
+	void RegisterSceneBenchmarks(BenchmarkRunner& runner, const SceneGeneratorSpec& spec)
+	{
+		// Full runtime frames: scripts, physics, particles and rendering
+		runner.Register("Scene/OnUpdateRuntime", 120, [spec](BenchmarkState& state)
+		{
+			const Ref<Scene> scene = SceneGenerator::Generate(spec);
+			const Ref<RenderGraphData> renderGraphData = CreateRef<RenderGraphData>(s_ViewportWidth, s_ViewportHeight);
+			scene->OnViewportResize(s_ViewportWidth, s_ViewportHeight);
+			scene->OnRuntimeStart();
+
+			uint32_t frames = 0;
+			NullRecorder::Reset();
+			while (state.Next())
+			{
+				scene->OnUpdateRuntime(s_FrameTime, renderGraphData);
+				++frames;
+			}
+			SetRenderCounters(state, frames);
+
+			scene->OnRuntimeStop();
+		});
+
+		// Culling, batching and submission of a static view, the null backend does not draw anything
+		runner.Register("Scene/OnRender", 120, [spec](BenchmarkState& state)
+		{
+			const Ref<Scene> scene = SceneGenerator::Generate(spec);
+			const Ref<RenderGraphData> renderGraphData = CreateRef<RenderGraphData>(s_ViewportWidth, s_ViewportHeight);
+			scene->OnViewportResize(s_ViewportWidth, s_ViewportHeight);
+			const CameraData cameraData = GetCameraData(*scene);
+
+			uint32_t frames = 0;
+			NullRecorder::Reset();
+			while (state.Next())
+			{
+				scene->OnRender(renderGraphData, cameraData);
+				++frames;
+			}
+			SetRenderCounters(state, frames);
+		});
+
+		// What entering play mode in the editor costs, the copy is destroyed outside of the measurement
+		runner.Register("Scene/CopyTo", 20, [spec](BenchmarkState& state)
+		{
+			const Ref<Scene> scene = SceneGenerator::Generate(spec);
+			while (state.Next())
+			{
+				Ref<Scene> copy = Scene::CopyTo(scene);
+
+				state.PauseTiming();
+				copy.reset();
+				state.ResumeTiming();
+			}
+		});
+
+		runner.Register("SceneSerializer/Serialize", 10, [spec](BenchmarkState& state)
+		{
+			const Ref<Scene> scene = SceneGenerator::Generate(spec);
+			const std::string filepath = (SceneGenerator::GetDirectory() / "Benchmark.arc").string();
+			while (state.Next())
+				SceneSerializer(scene).Serialize(filepath);
+
+			state.SetCounter("file_bytes", static_cast<double>(std::filesystem::file_size(filepath)));
+		});
+
+		runner.Register("SceneSerializer/Deserialize", 10, [spec](BenchmarkState& state)
+		{
+			const std::string filepath = (SceneGenerator::GetDirectory() / "Benchmark.arc").string();
+			SceneSerializer(SceneGenerator::Generate(spec)).Serialize(filepath);
+
+			while (state.Next())
+			{
+				Ref<Scene> scene = CreateRef<Scene>();
+				if (!SceneSerializer(scene).Deserialize(filepath))
+					ARC_APP_ERROR("Could not deserialize {}", filepath);
+
+				state.PauseTiming();
+				scene.reset();
+				state.ResumeTiming();
+			}
+		});
+
+		runner.Register("SceneSerializer/SerializeBinary", 10, [spec](BenchmarkState& state)
+		{
+			const Ref<Scene> scene = SceneGenerator::Generate(spec);
+			const std::string filepath = (SceneGenerator::GetDirectory() / "BenchmarkBinary.arc").string();
+			while (state.Next())
+				SceneSerializer(scene).SerializeBinary(filepath);
+
+			state.SetCounter("file_bytes", static_cast<double>(std::filesystem::file_size(filepath)));
+		});
+
+		runner.Register("SceneSerializer/DeserializeBinary", 10, [spec](BenchmarkState& state)
+		{
+			const std::string filepath = (SceneGenerator::GetDirectory() / "BenchmarkBinary.arc").string();
+			SceneSerializer(SceneGenerator::Generate(spec)).SerializeBinary(filepath);
+
+			while (state.Next())
+			{
+				Ref<Scene> scene = CreateRef<Scene>();
+				if (!SceneSerializer(scene).Deserialize(filepath))
+					ARC_APP_ERROR("Could not deserialize {}", filepath);
+
+				state.PauseTiming();
+				scene.reset();
+				state.ResumeTiming();
+			}
+		});
+	}
+}
@@ -0,0 +1,203 @@
+#include "SceneGenerator.h"
+
+#include <fstream>
+#include <random>
+
+#include <Arc/Renderer/Mesh.h>
+
+namespace ArcEngine
+{
+	static Ref<Mesh> s_Mesh = nullptr;
+
+	Ref<Scene> SceneGenerator::Generate(const SceneGeneratorSpec& spec)
+	{
+		ARC_PROFILE_SCOPE()
+
+		std::mt19937_64 engine(spec.Seed);
+		std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+		const auto random = [&](float min, float max) { return min + (max - min) * unit(engine); };
+		const auto randomPosition = [&](float minHeight, float maxHeight)
+		{
+			return glm::vec3(random(-spec.Extent, spec.Extent), random(minHeight, maxHeight), random(-spec.Extent, spec.Extent));
+		};
+
+		Ref<Scene> scene = CreateRef<Scene>();
+		const auto createEntity = [&](const std::string& name) { return scene->CreateEntityWithUUID(UUID(engine()), name); };
+
+		// Parents are offset a little from each other, so every level of the chain changes the world transform
+		const auto createHierarchy = [&](const std::string& name, const glm::vec3& position)
+		{
+			Entity parent = {};
+			for (uint32_t level = 0; level < spec.HierarchyDepth; ++level)
+			{
+				Entity node = createEntity(fmt::format("{} Parent {}", name, level));
+				node.GetTransform().Translation = level == 0 ? position : glm::vec3(random(-1.0f, 1.0f), 0.0f, random(-1.0f, 1.0f));
+				node.GetTransform().Rotation.y = random(0.0f, glm::two_pi<float>());
+				if (parent)
+					node.SetParent(parent);
+				parent = node;
+			}
+
+			Entity entity = createEntity(name);
+			if (parent)
+				entity.SetParent(parent);
+			else
+				entity.GetTransform().Translation = position;
+			return entity;
+		};
+
+		{
+			Entity camera = createEntity("Camera");
+			camera.GetTransform().Translation = { 0.0f, 40.0f, spec.Extent };
+			camera.GetTransform().Rotation.x = glm::radians(-20.0f);
+			auto& component = camera.AddComponent<CameraComponent>();
+			component.Camera.SetPerspective(glm::radians(60.0f), 0.1f, spec.Extent * 4.0f);
+			component.Primary = true;
+		}
+
+		// Sprites lie in the xy plane, the static ones are what the sprite chunks are built from
+		std::vector<Ref<Texture2D>> textures(spec.SpriteTextures);
+		for (Ref<Texture2D>& texture : textures)
+		{
+			texture = Texture2D::Create(16, 16);
+			std::vector<uint32_t> pixels(16 * 16, static_cast<uint32_t>(engine()) | 0xFF000000u);
+			texture->SetData(pixels.data(), static_cast<uint32_t>(pixels.size() * sizeof(uint32_t)));
+		}
+		for (uint32_t i = 0; i < spec.Sprites; ++i)
+		{
+			const bool isStatic = unit(engine) < spec.StaticSpriteRatio;
+			const glm::vec3 position = { random(-spec.Extent, spec.Extent), random(-spec.Extent, spec.Extent), 0.0f };
+			Entity entity = isStatic ? createEntity("Static Sprite") : createHierarchy("Sprite", position);
+			if (isStatic)
+			{
+				entity.GetComponent<TagComponent>().Layer = Scene::StaticLayer;
+				entity.GetTransform().Translation = position;
+			}
+
+			auto& sprite = entity.AddComponent<SpriteRendererComponent>();
+			sprite.Color = { unit(engine), unit(engine), unit(engine), 1.0f };
+			sprite.SortingOrder = static_cast<int32_t>(engine() % 4);
+			if (!textures.empty())
+				sprite.Texture = textures[engine() % textures.size()];
+		}
+
+		for (uint32_t i = 0; i < spec.Meshes; ++i)
+		{
+			Entity entity = createHierarchy("Mesh", randomPosition(0.0f, 8.0f));
+			auto& mesh = entity.AddComponent<MeshComponent>();
+			mesh.MeshGeometry = GetMesh();
+		}
+
+		const uint32_t lightCount = spec.DirectionalLights + spec.PointLights + spec.SpotLights;
+		for (uint32_t i = 0; i < lightCount; ++i)
+		{
+			Entity entity = createEntity("Light");
+			auto& light = entity.AddComponent<LightComponent>();
+			light.Color = { unit(engine), unit(engine), unit(engine) };
+			if (i < spec.DirectionalLights)
+			{
+				light.Type = LightComponent::LightType::Directional;
+				entity.GetTransform().Rotation = { glm::radians(-50.0f), random(0.0f, glm::two_pi<float>()), 0.0f };
+				continue;
+			}
+
+			entity.GetTransform().Translation = randomPosition(1.0f, 12.0f);
+			light.Type = i < spec.DirectionalLights + spec.PointLights ? LightComponent::LightType::Point : LightComponent::LightType::Spot;
+			light.Range = random(4.0f, 24.0f);
+			light.CastShadows = light.Type == LightComponent::LightType::Spot;
+		}
+
+		// A static floor and boxes dropped on it
+		if (spec.Rigidbodies > 0)
+		{
+			Entity floor = createEntity("Floor");
+			floor.GetTransform().Scale = { spec.Extent * 2.0f, 1.0f, spec.Extent * 2.0f };
+			floor.AddComponent<RigidbodyComponent>().Type = RigidbodyComponent::BodyType::Static;
+			floor.AddComponent<BoxColliderComponent>();
+		}
+		for (uint32_t i = 0; i < spec.Rigidbodies; ++i)
+		{
+			Entity entity = createEntity("Rigidbody");
+			entity.GetTransform().Translation = randomPosition(2.0f, 30.0f);
+			entity.GetTransform().Rotation = { random(0.0f, glm::pi<float>()), random(0.0f, glm::pi<float>()), 0.0f };
+			entity.AddComponent<RigidbodyComponent>();
+			entity.AddComponent<BoxColliderComponent>();
+			entity.AddComponent<MeshComponent>().MeshGeometry = GetMesh();
+		}
+
+		for (uint32_t i = 0; i < spec.ParticleSystems; ++i)
+		{
+			Entity entity = createEntity("Particle System");
+			entity.GetTransform().Translation = randomPosition(0.0f, 4.0f);
+			ParticleProperties& properties = entity.AddComponent<ParticleSystemComponent>().System->GetProperties();
+			properties.MaxParticles = spec.ParticlesPerSystem;
+			properties.RateOverTime = spec.ParticlesPerSystem;
+			properties.StartLifetime = 1.0f;
+		}
+
+		return scene;
+	}
+
+	bool SceneGenerator::WriteSphereObj(const std::filesystem::path& filepath, uint32_t segments, uint32_t rings)
+	{
+		ARC_PROFILE_SCOPE()
+
+		std::ofstream file(filepath, std::ios::out | std::ios::trunc);
+		if (!file)
+			return false;
+
+		file << "o Sphere\n";
+		for (uint32_t ring = 0; ring <= rings; ++ring)
+		{
+			const float v = static_cast<float>(ring) / static_cast<float>(rings);
+			const float phi = v * glm::pi<float>();
+			for (uint32_t segment = 0; segment <= segments; ++segment)
+			{
+				const float u = static_cast<float>(segment) / static_cast<float>(segments);
+				const float theta = u * glm::two_pi<float>();
+				const glm::vec3 normal = { glm::sin(phi) * glm::cos(theta), glm::cos(phi), glm::sin(phi) * glm::sin(theta) };
+				file << fmt::format("v {} {} {}\nvt {} {}\nvn {} {} {}\n", normal.x * 0.5f, normal.y * 0.5f, normal.z * 0.5f, u, 1.0f - v, normal.x, normal.y, normal.z);
+			}
+		}
+
+		const uint32_t rowSize = segments + 1;
+		for (uint32_t ring = 0; ring < rings; ++ring)
+		{
+			for (uint32_t segment = 0; segment < segments; ++segment)
+			{
+				// OBJ indices start at one, position, texture coordinate and normal share them here
+				const uint32_t a = ring * rowSize + segment + 1;
+				const uint32_t b = a + rowSize;
+				file << fmt::format("f {0}/{0}/{0} {1}/{1}/{1} {2}/{2}/{2}\n", a, a + 1, b);
+				file << fmt::format("f {0}/{0}/{0} {1}/{1}/{1} {2}/{2}/{2}\n", a + 1, b + 1, b);
+			}
+		}
+
+		return file.good();
+	}
+
+	std::filesystem::path SceneGenerator::GetDirectory()
+	{
+		const std::filesystem::path directory = std::filesystem::temp_directory_path() / "ArcBenchmark";
+		std::error_code error;
+		std::filesystem::create_directories(directory, error);
+		return directory;
+	}
+
+	const Ref<Mesh>& SceneGenerator::GetMesh()
+	{
+		if (!s_Mesh)
+		{
+			const std::filesystem::path filepath = GetDirectory() / "Sphere.obj";
+			if (!WriteSphereObj(filepath, 32, 16))
+				ARC_APP_ERROR("Could not write {}", filepath);
+			s_Mesh = CreateRef<Mesh>(filepath.string().c_str());
+		}
+		return s_Mesh;
+	}
+
+	void SceneGenerator::Shutdown()
+	{
+		s_Mesh.reset();
+	}
+}
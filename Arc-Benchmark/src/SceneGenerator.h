@@ -0,0 +1,45 @@
+#pragma once
+
+#include <ArcEngine.h>
+
+namespace ArcEngine
+{
+	class Mesh;
+
+	// Sizes of a generated scene, the same spec and seed always produce the same scene
+	struct SceneGeneratorSpec
+	{
+		uint32_t Seed = 1;
+		float Extent = 256.0f;				// Entities are spread over [-Extent, Extent] on x and z
+
+		uint32_t Sprites = 4096;
+		float StaticSpriteRatio = 0.75f;	// Part of the sprites put on the static layer
+		uint32_t SpriteTextures = 48;		// More than the texture slots of a batch
+		uint32_t Meshes = 1024;
+		uint32_t PointLights = 96;
+		uint32_t SpotLights = 16;
+		uint32_t DirectionalLights = 1;
+		uint32_t Rigidbodies = 512;
+		uint32_t ParticleSystems = 16;
+		uint32_t ParticlesPerSystem = 2048;
+
+		// Every mesh and sprite gets a chain of this many parents
+		uint32_t HierarchyDepth = 3;
+	};
+
+	class SceneGenerator
+	{
+	public:
+		[[nodiscard]] static Ref<Scene> Generate(const SceneGeneratorSpec& spec);
+
+		// Writes a UV sphere as an .obj file, segments around and rings from pole to pole
+		static bool WriteSphereObj(const std::filesystem::path& filepath, uint32_t segments, uint32_t rings);
+
+		// Scratch directory for generated files, under the system temp directory
+		[[nodiscard]] static std::filesystem::path GetDirectory();
+
+		// Sphere mesh shared by every generated scene, created on first use
+		[[nodiscard]] static const Ref<Mesh>& GetMesh();
+		static void Shutdown();
+	};
+}
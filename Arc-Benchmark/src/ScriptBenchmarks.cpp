@@ -0,0 +1,77 @@
+#include "Benchmarks.h"
+
+#include <Arc/Scripting/ScriptEngine.h>
+
+namespace ArcEngine
+{
+	static constexpr uint32_t s_CallsPerIteration = 10000;
+	static constexpr float s_FrameTime = 1.0f / 60.0f;
+
+	// Script classes come from the project given with --project, the first one with an OnUpdate is used.
+	// A class with an empty OnUpdate measures only the cost of the call.
+	static std::string FindUpdateClass()
+	{
+		for (const auto& [name, scriptClass] : ScriptEngine::GetClasses())
+		{
+			if (scriptClass->GetMethod("OnUpdate", 1))
+				return name;
+		}
+		return {};
+	}
+
+	void RegisterScriptBenchmarks(BenchmarkRunner& runner)
+	{
+		const std::string className = FindUpdateClass();
+		if (className.empty())
+		{
+			ARC_APP_WARN("No script class with an OnUpdate method is loaded, skipping script benchmarks");
+			return;
+		}
+
+		// Calls OnUpdate the way the engine did before thunks, boxing the argument into a params array
+		runner.Register("Script/OnUpdateRuntimeInvoke", 60, [className](BenchmarkState& state)
+		{
+			const Ref<Scene> scene = CreateRef<Scene>();
+			ScriptEngine::SetScene(scene.get());
+			const Entity entity = scene->CreateEntity();
+			const ScriptInstance* instance = ScriptEngine::CreateInstance(entity, className);
+			instance->InvokeOnCreate();
+
+			const Ref<ScriptClass>& scriptClass = ScriptEngine::GetClasses().at(className);
+			MonoMethod* method = scriptClass->GetMethod("OnUpdate", 1);
+			while (state.Next())
+			{
+				for (uint32_t i = 0; i < s_CallsPerIteration; ++i)
+				{
+					float ts = s_FrameTime;
+					void* params = &ts;
+					scriptClass->InvokeMethod(instance->GetHandle(), method, &params);
+				}
+			}
+
+			state.SetCounter("calls", s_CallsPerIteration);
+			ScriptEngine::RemoveInstance(entity, className);
+			ScriptEngine::SetScene(nullptr);
+		});
+
+		// The path Scene::OnUpdateRuntime takes, through the unmanaged thunk
+		runner.Register("Script/OnUpdateThunk", 60, [className](BenchmarkState& state)
+		{
+			const Ref<Scene> scene = CreateRef<Scene>();
+			ScriptEngine::SetScene(scene.get());
+			const Entity entity = scene->CreateEntity();
+			const ScriptInstance* instance = ScriptEngine::CreateInstance(entity, className);
+			instance->InvokeOnCreate();
+
+			while (state.Next())
+			{
+				for (uint32_t i = 0; i < s_CallsPerIteration; ++i)
+					instance->InvokeOnUpdate(s_FrameTime);
+			}
+
+			state.SetCounter("calls", s_CallsPerIteration);
+			ScriptEngine::RemoveInstance(entity, className);
+			ScriptEngine::SetScene(nullptr);
+		});
+	}
+}
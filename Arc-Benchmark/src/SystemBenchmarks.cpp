@@ -0,0 +1,74 @@
+#include "Benchmarks.h"
+
+#include <Arc/Physics/Physics3D.h>
+#include <Arc/Renderer/Mesh.h>
+#include <Arc/Renderer/ParticleSystem.h>
+
+namespace ArcEngine
+{
+	static constexpr float s_FrameTime = 1.0f / 60.0f;
+
+	void RegisterSystemBenchmarks(BenchmarkRunner& runner, const SceneGeneratorSpec& spec)
+	{
+		// Bodies of the generated scene falling onto its floor, most of them collide during the run
+		runner.Register("Physics3D/Step", 120, [spec](BenchmarkState& state)
+		{
+			const Ref<Scene> scene = SceneGenerator::Generate(spec);
+			scene->OnRuntimeStart();
+
+			while (state.Next())
+				Physics3D::Step(s_FrameTime);
+
+			state.SetCounter("bodies", static_cast<double>(scene->GetAllEntitiesWith<RigidbodyComponent>().size()));
+			scene->OnRuntimeStop();
+		});
+
+		// A single system large enough to be simulated in parallel
+		runner.Register("ParticleSystem/Update", 120, [](BenchmarkState& state)
+		{
+			ParticleSystem particleSystem;
+			ParticleProperties& properties = particleSystem.GetProperties();
+			properties.MaxParticles = ParticleSystem::ParallelSimulationThreshold * 4;
+			properties.RateOverTime = properties.MaxParticles;
+			properties.StartLifetime = 1.0f;
+			particleSystem.Play();
+
+			// Fill it up before measuring, so every iteration simulates a full system
+			const glm::vec3 position(0.0f);
+			for (uint32_t i = 0; i < 60; ++i)
+				particleSystem.OnUpdate(s_FrameTime, position);
+
+			while (state.Next())
+				particleSystem.OnUpdate(s_FrameTime, position);
+
+			state.SetCounter("particles", static_cast<double>(particleSystem.GetActiveParticleCount()));
+		});
+
+		// Loads through the cooked cache, which is what every load after the first one does
+		runner.Register("Mesh/LoadCooked", 30, [](BenchmarkState& state)
+		{
+			const std::string filepath = SceneGenerator::GetMesh()->GetFilepath();
+			while (state.Next())
+			{
+				Mesh mesh;
+				mesh.Load(filepath.c_str());
+			}
+		});
+
+		// Imports the .obj and writes the cooked copy again
+		runner.Register("Mesh/LoadCold", 10, [](BenchmarkState& state)
+		{
+			const std::string filepath = SceneGenerator::GetMesh()->GetFilepath();
+			while (state.Next())
+			{
+				state.PauseTiming();
+				std::error_code error;
+				std::filesystem::remove(Mesh::GetCookedPath(filepath), error);
+				state.ResumeTiming();
+
+				Mesh mesh;
+				mesh.Load(filepath.c_str());
+			}
+		});
+	}
+}
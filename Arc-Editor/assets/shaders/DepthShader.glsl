@@ -7,11 +7,15 @@ layout(location = 2) in vec3 a_Normal;
 layout(location = 3) in float a_ObjectID;
 
 uniform mat4 u_ViewProjection;
-uniform mat4 u_Model;
+
+layout (std140, binding = 3) uniform Instances
+{
+	mat4 u_Models[256];
+};
 
 void main()
 {
-	gl_Position = u_ViewProjection * u_Model * vec4(a_Position, 1.0);
+	gl_Position = u_ViewProjection * u_Models[gl_InstanceID] * vec4(a_Position, 1.0);
 }
 
 #type fragment
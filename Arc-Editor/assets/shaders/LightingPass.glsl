@@ -31,8 +31,8 @@ layout(location = 0) out vec4 o_FragColor;
 const float PI = 3.141592653589793;
 const float EPSILON = 1.17549435E-38;
 
-const int MAX_NUM_LIGHTS = 200;
 const int MAX_NUM_DIR_LIGHTS = 3;
+const int MAX_NUM_CASCADES = 4;
 
 layout (std140, binding = 0) uniform Camera
 {
@@ -63,10 +63,22 @@ struct PointLight
     vec4 u_LightDir;
 };
 
-layout (std140, binding = 1) uniform PointLightBuffer
+layout (std430, binding = 1) readonly buffer PointLightBuffer
 {
-    PointLight u_PointLights[MAX_NUM_LIGHTS];
-    uint u_NumPointLights;
+    PointLight u_PointLights[];
+};
+
+// Point and spot lights sorted into clusters of the view frustum
+layout (std430, binding = 5) readonly buffer LightClusterBuffer
+{
+	// xyz: cluster counts, w: number of point and spot lights
+	uvec4 u_ClusterSize;
+
+	// slice = log(viewDepth) * x - y
+	vec4 u_ClusterDepthParams;
+
+	// First index and light count of every cluster, followed by the light indices of all clusters
+	uint u_ClusterData[];
 };
 
 struct DirectionalLight
@@ -78,10 +90,16 @@ struct DirectionalLight
 	*/
     vec4 u_Color;
     
-    // Used for directional and spot lights
+    // xyz: direction, w: cascade count
     vec4 u_LightDir;
+
+	// View space depth where each cascade ends
+	vec4 u_CascadeSplits;
+
+	// Tile of each cascade in the shadow atlas, xy: offset, zw: scale. Zero scale for cascades without a shadow map
+	vec4 u_ShadowAtlasRects[MAX_NUM_CASCADES];
 	
-	mat4 u_DirLightViewProj;
+	mat4 u_CascadeViewProj[MAX_NUM_CASCADES];
 };
 
 layout (std140, binding = 2) uniform DirectionalLightBuffer
@@ -168,7 +186,7 @@ uniform sampler2D u_Depth;
 uniform samplerCube u_IrradianceMap;
 uniform samplerCube u_RadianceMap;
 uniform sampler2D u_BRDFLutMap;
-uniform sampler2D u_DirectionalShadowMap[MAX_NUM_DIR_LIGHTS];
+uniform sampler2D u_ShadowAtlas;
 
 uniform float u_IrradianceIntensity;
 uniform float u_EnvironmentRotation;
@@ -214,23 +232,30 @@ vec3 FresnelSchlickRoughness(float cosTheta, vec3 F0, float roughness)
 	return F0 + (max(vec3(1.0 - roughness), F0) - F0) * pow(1.0 - cosTheta, 5.0);
 }
 
-float CalculateHardShadows(int shadowmapIndex, vec3 shadowCoords, float bias)
+// Samples the depth at uv inside the tile, offsets are clamped so that filtering never reads a neighbouring tile
+float SampleShadow(vec4 atlasRect, vec2 uv, vec2 offset, float depth, float bias)
+{
+	vec2 halfTexel = 0.5 / textureSize(u_ShadowAtlas, 0);
+	vec2 atlasUV = clamp(atlasRect.xy + uv * atlasRect.zw + offset, atlasRect.xy + halfTexel, atlasRect.xy + atlasRect.zw - halfTexel);
+	float z = texture(u_ShadowAtlas, atlasUV).r;
+	return depth - bias > z ? 0.0 : 1.0;
+}
+
+float CalculateHardShadows(vec4 atlasRect, vec3 shadowCoords, float bias)
 {
-	float z = texture(u_DirectionalShadowMap[shadowmapIndex], shadowCoords.xy).r;
-	return shadowCoords.z - bias > z ? 0.0 : 1.0;
+	return SampleShadow(atlasRect, shadowCoords.xy, vec2(0.0), shadowCoords.z, bias);
 }
 
-float CalculateSoftShadows(int shadowmapIndex, vec3 shadowCoords, float bias)
+float CalculateSoftShadows(vec4 atlasRect, vec3 shadowCoords, float bias)
 {
-	vec2 texelSize = 1.0 / textureSize(u_DirectionalShadowMap[shadowmapIndex], 0);
+	vec2 texelSize = 1.0 / textureSize(u_ShadowAtlas, 0);
 	int sampleCount = 1;
 	float shadow = 0.0;
 	for(int x = -sampleCount; x <= sampleCount; ++x)
 	{
 		for(int y = -sampleCount; y <= sampleCount; ++y)
 		{
-			float z = texture(u_DirectionalShadowMap[shadowmapIndex], shadowCoords.xy + vec2(x, y) * texelSize).r;
-			shadow += shadowCoords.z - bias > z ? 0.0 : 1.0;
+			shadow += SampleShadow(atlasRect, shadowCoords.xy, vec2(x, y) * texelSize, shadowCoords.z, bias);
 		}
 	}
     float tmp = sampleCount * 2 + 1;
@@ -238,35 +263,51 @@ float CalculateSoftShadows(int shadowmapIndex, vec3 shadowCoords, float bias)
 	return shadow;
 }
 
-float CalculatePCSS(int shadowmapIndex, vec3 shadowCoords, float bias)
+float CalculatePCSS(vec4 atlasRect, vec3 shadowCoords, float bias)
 {
-	vec2 texelSizeMultiplier = 3.0 / textureSize(u_DirectionalShadowMap[shadowmapIndex], 0);
+	vec2 texelSizeMultiplier = 3.0 / textureSize(u_ShadowAtlas, 0);
 	float shadow = 0.0;
 	for (int i = 0; i < PCF_SAMPLES; i++)
 	{
 		vec2 offset = gPoissonDisk[i] * texelSizeMultiplier;
-		float z = texture(u_DirectionalShadowMap[shadowmapIndex], shadowCoords.xy + offset).r;
-		shadow += shadowCoords.z - bias > z ? 0.0 : 1.0;
+		shadow += SampleShadow(atlasRect, shadowCoords.xy, offset, shadowCoords.z, bias);
 	}
 	return shadow / float(PCF_SAMPLES);
 }
 
-float CalcDirectionalShadowFactor(DirectionalLight directionalLight, const float NdotL, int shadowmapIndex)
+float CalcDirectionalShadowFactor(DirectionalLight directionalLight, const float NdotL)
 {
-	vec4 dirLightViewProj = directionalLight.u_DirLightViewProj * vec4(m_Params.WorldPos, 1);
+	// Pick the first cascade that reaches the fragment, past the last one there are no shadows
+	float viewDepth = -(u_View * vec4(m_Params.WorldPos, 1.0)).z;
+	int cascadeCount = int(directionalLight.u_LightDir.w);
+	int cascade = 0;
+	while (cascade < cascadeCount && viewDepth > directionalLight.u_CascadeSplits[cascade])
+		++cascade;
+	if (cascade == cascadeCount)
+		return 1.0;
+
+	vec4 atlasRect = directionalLight.u_ShadowAtlasRects[cascade];
+	if (atlasRect.z == 0.0)
+		return 1.0;
+
+	vec4 dirLightViewProj = directionalLight.u_CascadeViewProj[cascade] * vec4(m_Params.WorldPos, 1);
 	vec3 projCoords = dirLightViewProj.xyz / dirLightViewProj.w;
 	projCoords = (projCoords * 0.5) + 0.5;
 	
 	if(projCoords.z > 1.0)
         return 0.0;
 
+	// Outside of the tile there is no shadow information
+	if (any(lessThan(projCoords.xy, vec2(0.0))) || any(greaterThan(projCoords.xy, vec2(1.0))))
+		return 1.0;
+
 	float bias = max(0.0008 * (1.0 - NdotL), 0.0008);
 	int shadowQuality = int(directionalLight.u_Position.w);
 	switch (shadowQuality)
 	{
-		case 0: return CalculateHardShadows(shadowmapIndex, projCoords, bias);
-		case 1: return CalculateSoftShadows(shadowmapIndex, projCoords, bias);
-		case 2: return CalculatePCSS(shadowmapIndex, projCoords, bias);
+		case 0: return CalculateHardShadows(atlasRect, projCoords, bias);
+		case 1: return CalculateSoftShadows(atlasRect, projCoords, bias);
+		case 2: return CalculatePCSS(atlasRect, projCoords, bias);
 	}
 }
 
@@ -378,7 +419,7 @@ void main()
 		DirectionalLight light = u_DirectionalLights[i];
 		vec3 L = -1.0 * normalize(light.u_LightDir.xyz);
 		float NdotL = max(dot(m_Params.Normal, L), 0.0);
-		float shadow = CalcDirectionalShadowFactor(light, NdotL, i);
+		float shadow = CalcDirectionalShadowFactor(light, NdotL);
 
 		if (shadow <= EPSILON)
 			continue;
@@ -399,9 +440,17 @@ void main()
         Lo += (kD * (m_Params.Albedo / PI) + specular) * radiance * NdotL;
 	}
 
-    for (int i = 0; i < u_NumPointLights; ++i)
+	float viewDepth = -(u_View * vec4(m_Params.WorldPos, 1.0)).z;
+	uvec3 cluster = uvec3(v_TexCoord * vec2(u_ClusterSize.xy), max(log(viewDepth) * u_ClusterDepthParams.x - u_ClusterDepthParams.y, 0.0));
+	cluster = min(cluster, u_ClusterSize.xyz - 1);
+	uint clusterIndex = cluster.x + u_ClusterSize.x * (cluster.y + u_ClusterSize.y * cluster.z);
+	uint lightIndicesStart = u_ClusterSize.x * u_ClusterSize.y * u_ClusterSize.z * 2;
+	uint firstLight = lightIndicesStart + u_ClusterData[clusterIndex * 2];
+	uint clusterLightCount = u_ClusterData[clusterIndex * 2 + 1];
+
+    for (uint i = 0; i < clusterLightCount; ++i)
     {
-		PointLight light = u_PointLights[i];
+		PointLight light = u_PointLights[u_ClusterData[firstLight + i]];
         uint type = uint(round(light.u_AttenFactors.w));
 
         vec3 L;
@@ -18,7 +18,10 @@ layout (std140, binding = 0) uniform Camera
     vec3 u_CameraPosition;
 };
 
-uniform mat4 u_Model;
+layout (std140, binding = 3) uniform Instances
+{
+    mat4 u_Models[256];
+};
 
 struct VertexOutput
 {
@@ -33,12 +36,14 @@ layout(location = 0) out VertexOutput Output;
 
 void main()
 {
+    mat4 model = u_Models[gl_InstanceID];
+
     Output.TexCoord = a_TexCoord;
-    Output.Normal = mat3(u_Model) * a_Normal;
-	Output.WorldNormals = mat3(u_Model) * mat3(a_Tangent, a_Bitangent, a_Normal);
-	Output.WorldTransform = mat3(u_Model);
+    Output.Normal = mat3(model) * a_Normal;
+	Output.WorldNormals = mat3(model) * mat3(a_Tangent, a_Bitangent, a_Normal);
+	Output.WorldTransform = mat3(model);
 
-	gl_Position = u_ViewProjection * u_Model * vec4(a_Position, 1.0);
+	gl_Position = u_ViewProjection * model * vec4(a_Position, 1.0);
 }
 
 #type fragment
@@ -47,23 +52,25 @@ void main()
 const float PI = 3.141592653589793;
 const float EPSILON = 0.000000000000001;
 
-struct Properties
+layout (std140, binding = 4) uniform Material
 {
 	vec4 AlbedoColor;
-	float Roughness01;
-	float Metalness01;
 	vec3 EmissiveColor;
 	float EmissiveIntensity;
-	
+	float Roughness01;
+	float Metalness01;
+	bool UseNormalMap;
+} u_Material;
+
+struct MaterialTextures
+{
 	sampler2D AlbedoMap;
 	sampler2D NormalMap;
 	sampler2D MRAMap;
 	sampler2D EmissiveMap;
-
-	bool UseNormalMap;
 };
 
-uniform Properties u_Material;
+uniform MaterialTextures u_MaterialTextures;
 
 struct VertexOutput
 {
@@ -84,7 +91,7 @@ layout(location = 3) out vec4 o_Emission;
 
 vec3 GetNormalFromMap()
 {
-    vec3 tangentNormal = texture(u_Material.NormalMap, Input.TexCoord).rgb * 2.0 - 1.0;
+    vec3 tangentNormal = texture(u_MaterialTextures.NormalMap, Input.TexCoord).rgb * 2.0 - 1.0;
     return normalize(Input.WorldNormals * tangentNormal);
 }
 
@@ -108,19 +115,19 @@ vec2 Encode(in vec3 v)
 //////////////////////////////////////////////////////////////////////////////////////////////
 void main()
 {
-    vec4 albedoWithAlpha = pow(texture(u_Material.AlbedoMap, Input.TexCoord) * u_Material.AlbedoColor, vec4(2.2, 2.2, 2.2, 1.0));
+    vec4 albedoWithAlpha = pow(texture(u_MaterialTextures.AlbedoMap, Input.TexCoord) * u_Material.AlbedoColor, vec4(2.2, 2.2, 2.2, 1.0));
 	if (albedoWithAlpha.a < 0.01)
 		discard;
 
     vec3 outAlbedo	= albedoWithAlpha.rgb;
     vec3 outNormal = u_Material.UseNormalMap ? GetNormalFromMap() : normalize(Input.Normal);
-    vec3 outEmission = texture(u_Material.EmissiveMap, Input.TexCoord).rgb * u_Material.EmissiveColor;
+    vec3 outEmission = texture(u_MaterialTextures.EmissiveMap, Input.TexCoord).rgb * u_Material.EmissiveColor;
 
-	float outRoughness = u_Material.Roughness01 * texture(u_Material.MRAMap, Input.TexCoord).g;
+	float outRoughness = u_Material.Roughness01 * texture(u_MaterialTextures.MRAMap, Input.TexCoord).g;
 	outRoughness = max(outRoughness, 0.05); // Minimum roughness of 0.05 to keep specular highlight
 	
-	float outMetalness = u_Material.Metalness01 * texture(u_Material.MRAMap, Input.TexCoord).r;
-	float outAO = texture(u_Material.MRAMap, Input.TexCoord).b;
+	float outMetalness = u_Material.Metalness01 * texture(u_MaterialTextures.MRAMap, Input.TexCoord).r;
+	float outAO = texture(u_MaterialTextures.MRAMap, Input.TexCoord).b;
 
     o_Albedo = vec4(outAlbedo, 1.0);
 	o_Normal = Encode(outNormal);
@@ -101,6 +101,9 @@ namespace ArcEngine
 			}
 		}
 
+		if (m_SceneLoader && m_SceneLoader->Update())
+			FinishSceneLoad();
+
 		m_SceneHierarchyPanel.OnUpdate(ts);
 
 		const bool useEditorCamera = m_SceneState == SceneState::Edit || m_SceneState == SceneState::Pause || m_SceneState == SceneState::Step;
@@ -432,6 +435,12 @@ namespace ArcEngine
 
 					if (ImGui::BeginMenuBar())
 					{
+						if (m_SceneLoader)
+						{
+							ImGui::ProgressBar(m_SceneLoader->GetProgress().GetFraction(), ImVec2(200.0f, 0.0f), "Loading scene");
+							ImGui::Spacing();
+						}
+
 						const ConsolePanel::Message* message = m_ConsolePanel.GetRecentMessage();
 						if (message != nullptr)
 						{
@@ -660,6 +669,8 @@ namespace ArcEngine
 				Ctrl+P				Play
 				Ctrl+Shift+P		Pause
 				Ctrl+Alt+P			Step
+				F5					Quick save while playing
+				F9					Quick load while playing
 
 			Scene:
 				Ctrl+N				Load new scene
@@ -785,6 +796,24 @@ namespace ArcEngine
 				}
 				break;
 			}
+			case Key::F5:
+			{
+				if (m_SceneState != SceneState::Edit)
+				{
+					OnSceneQuickSave();
+					return true;
+				}
+				break;
+			}
+			case Key::F9:
+			{
+				if (m_SceneState != SceneState::Edit && m_QuickSave)
+				{
+					OnSceneQuickLoad();
+					return true;
+				}
+				break;
+			}
 			case Key::Delete:
 			{
 				if (GImGui->ActiveId == 0 && m_SelectedContext.GetType() == EditorContextType::Entity)
@@ -856,6 +885,7 @@ namespace ArcEngine
 		for (const auto& propertyPanel : m_Properties)
 			propertyPanel->ForceSetContext(m_SelectedContext);
 
+		m_SceneLoader = nullptr;
 		m_ActiveScene = CreateRef<Scene>();
 		m_ActiveScene->MarkViewportDirty();
 		m_EditorScene = m_ActiveScene;
@@ -887,14 +917,25 @@ namespace ArcEngine
 		if (!m_Viewports.empty())
 			m_Viewports[0]->SetContext(m_ActiveScene, m_SceneHierarchyPanel);
 
-		const SceneSerializer serializer(m_ActiveScene);
-		if (!serializer.Deserialize(filepath))
-			ARC_CORE_ERROR("Could not deserialize scene!");
+		// Entities show up over the next frames, as their assets arrive
+		m_SceneLoader = CreateScope<SceneLoader>(m_ActiveScene, filepath);
 		m_ScenePath = filepath;
 	}
+
+	void EditorLayer::FinishSceneLoad()
+	{
+		if (!m_SceneLoader)
+			return;
+
+		if (!m_SceneLoader->Finish())
+			ARC_CORE_ERROR("Could not deserialize scene!");
+		m_SceneLoader = nullptr;
+	}
 	
 	void EditorLayer::SaveScene()
 	{
+		FinishSceneLoad();
+
 		if (!m_ScenePath.empty())
 		{
 			const SceneSerializer serializer(m_ActiveScene);
@@ -911,6 +952,8 @@ namespace ArcEngine
 		const std::string filepath = FileDialogs::SaveFile("Arc Scene (*.arc)\0*.arc\0");
 		if (!filepath.empty())
 		{
+			FinishSceneLoad();
+
 			const SceneSerializer serializer(m_ActiveScene);
 			serializer.Serialize(filepath);
 			m_ScenePath = filepath;
@@ -919,6 +962,8 @@ namespace ArcEngine
 
 	void EditorLayer::OnScenePlay()
 	{
+		FinishSceneLoad();
+
 		ResetContext();
 
 		m_EditorScene = m_ActiveScene;
@@ -946,6 +991,7 @@ namespace ArcEngine
 		m_RuntimeScene = nullptr;
 		m_ActiveScene = nullptr;
 		m_ActiveScene = m_EditorScene;
+		m_QuickSave = nullptr;
 		ScriptEngine::SetScene(m_ActiveScene.get());
 
 		m_SceneHierarchyPanel.SetContext(m_ActiveScene);
@@ -971,4 +1017,35 @@ namespace ArcEngine
 		if (!m_Viewports.empty())
 			m_Viewports[0]->SetSimulation(true);
 	}
+
+	void EditorLayer::OnSceneQuickSave()
+	{
+		ARC_PROFILE_SCOPE()
+
+		m_QuickSave = SceneSnapshot::Capture(*m_ActiveScene);
+	}
+
+	void EditorLayer::OnSceneQuickLoad()
+	{
+		ARC_PROFILE_SCOPE()
+
+		ResetContext();
+
+		// The physics world and script instances are shared, so the running scene has to stop first
+		m_ActiveScene->OnRuntimeStop();
+		m_RuntimeScene = CreateRef<Scene>();
+		m_ActiveScene = m_RuntimeScene;
+		if (!m_QuickSave->Restore(*m_ActiveScene))
+		{
+			ARC_CORE_ERROR("Failed to restore the quick save, restarting the scene");
+			m_QuickSave = nullptr;
+			m_ActiveScene = m_EditorScene;
+			OnScenePlay();
+			return;
+		}
+
+		m_SceneHierarchyPanel.SetContext(m_ActiveScene);
+		if (!m_Viewports.empty())
+			m_Viewports[0]->SetContext(m_ActiveScene, m_SceneHierarchyPanel);
+	}
 }
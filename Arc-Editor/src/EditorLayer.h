@@ -44,6 +44,7 @@ namespace ArcEngine
 		void SaveProject(const std::filesystem::path& path) const;
 
 		void NewScene();
+		void FinishSceneLoad();
 		void SaveScene();
 		void SaveSceneAs();
 
@@ -51,11 +52,15 @@ namespace ArcEngine
 		void OnSceneStop();
 		void OnScenePause();
 		void OnSceneUnpause();
+		void OnSceneQuickSave();
+		void OnSceneQuickLoad();
 
 	private:
 		Ref<Scene> m_ActiveScene;
 		Ref<Scene> m_EditorScene;
 		Ref<Scene> m_RuntimeScene;
+		Ref<SceneSnapshot> m_QuickSave;
+		Scope<SceneLoader> m_SceneLoader;
 		enum class SceneState { Edit, Play, Pause, Step };
 		SceneState m_SceneState = SceneState::Edit;
 		std::filesystem::path m_ScenePath = std::filesystem::path();
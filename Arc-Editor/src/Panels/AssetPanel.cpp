@@ -653,7 +653,7 @@ namespace ArcEngine
 						else if (!textureCreated)
 						{
 							textureCreated = true;
-							file.Thumbnail = AssetManager::GetTexture2D(file.Filepath);
+							file.Thumbnail = AssetManager::GetTexture2D(file.Filepath, AssetLoadPriority::Low);
 							textureId = file.Thumbnail->GetRendererID();
 						}
 						else
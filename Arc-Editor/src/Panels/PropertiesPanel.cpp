@@ -436,6 +436,7 @@ namespace ArcEngine
 					{
 						current = Scene::LayerCollisionMask.at(layer).Name.c_str();
 						tag.Layer = layer;
+						entity.PatchComponent<TagComponent>();
 					}
 
 					if (isSelected)
@@ -509,15 +510,17 @@ namespace ArcEngine
 			UI::EndProperties();
 		});
 		
-		DrawComponent<SpriteRendererComponent>(ICON_MDI_IMAGE_SIZE_SELECT_ACTUAL " Sprite Renderer", entity, [&entity](SpriteRendererComponent& component)
+		DrawComponent<SpriteRendererComponent>(ICON_MDI_IMAGE_SIZE_SELECT_ACTUAL " Sprite Renderer", entity, [entity](SpriteRendererComponent& component)
 		{
 			UI::BeginProperties();
-			UI::PropertyVector("Color", component.Color, true);
-			UI::Property("Texture", component.Texture);
-			if (UI::Property("Sorting Order", component.SortingOrder))
-				entity.GetScene()->SortForSprites();
-			UI::Property("Tiling Factor", component.TilingFactor);
+			bool changed = UI::PropertyVector("Color", component.Color, true);
+			changed |= UI::Property("Texture", component.Texture);
+			changed |= UI::Property("Sorting Order", component.SortingOrder);
+			changed |= UI::Property("Tiling Factor", component.TilingFactor);
 			UI::EndProperties();
+
+			if (changed)
+				entity.PatchComponent<SpriteRendererComponent>();
 		});
 
 		DrawComponent<MeshComponent>(ICON_MDI_VECTOR_SQUARE " Mesh", entity, [](MeshComponent& component)
@@ -579,7 +582,7 @@ namespace ArcEngine
 			UI::EndProperties();
 		});
 
-		DrawComponent<LightComponent>(ICON_MDI_LIGHTBULB " Light", entity, [](LightComponent& component)
+		DrawComponent<LightComponent>(ICON_MDI_LIGHTBULB " Light", entity, [entity](LightComponent& component)
 		{
 			UI::BeginProperties();
 			const char* lightTypeStrings[] = { "Directional", "Point", "Spot" };
@@ -632,14 +635,30 @@ namespace ArcEngine
 			}
 			else
 			{
+				UI::Property("Cast Shadows", component.CastShadows);
+
+				ImGui::BeginDisabled(!component.CastShadows);
 				const char* shadowQualityTypeStrings[] = { "Hard", "Soft", "Ultra Soft" };
 				int shadowQualityType = static_cast<int>(component.ShadowQuality);
 
 				if (UI::Property("Shadow Quality Type", shadowQualityType, shadowQualityTypeStrings, 3))
 					component.ShadowQuality = static_cast<LightComponent::ShadowQualityType>(shadowQualityType);
+				ImGui::EndDisabled();
 
-				const uint64_t textureID = component.ShadowMapFramebuffer->GetDepthAttachmentRendererID();
-				ImGui::Image(reinterpret_cast<ImTextureID>(textureID), ImVec2{ 256, 256 }, ImVec2{ 0, 1 }, ImVec2{ 1, 0 });
+				// The light's cascades in the shared shadow atlas, from the last rendered frame
+				const ShadowAtlas& shadowAtlas = Renderer3D::GetShadowAtlas();
+				if (shadowAtlas.GetFramebuffer())
+				{
+					const uint64_t textureID = shadowAtlas.GetFramebuffer()->GetDepthAttachmentRendererID();
+					for (const Renderer3D::ShadowMap& shadowMap : Renderer3D::GetShadowMaps(entity))
+					{
+						if (shadowMap.CascadeIndex != 0)
+							ImGui::SameLine();
+
+						const glm::vec4 uvRect = shadowAtlas.GetUVRect(shadowMap.Tile);
+						ImGui::Image(reinterpret_cast<ImTextureID>(textureID), ImVec2{ 128, 128 }, ImVec2{ uvRect.x, uvRect.y + uvRect.w }, ImVec2{ uvRect.x + uvRect.z, uvRect.y });
+					}
+				}
 			}
 
 			UI::EndProperties();
@@ -1106,7 +1125,7 @@ namespace ArcEngine
 					const char* path = static_cast<char*>(payload->Data);
 					const auto ext = StringUtils::GetExtension(path);
 					if (ext == "mp3" || ext == "wav")
-						component.Source = CreateRef<AudioSource>(path);
+						component.Source = AssetManager::LoadAudioSource(path, AssetLoadPriority::High);
 				}
 				ImGui::EndDragDropTarget();
 			}
@@ -52,6 +52,18 @@ namespace ArcEngine
 				ImGui::TreePop();
 			}
 
+			if (ImGui::TreeNodeEx("Shadows", treeNodeFlags))
+			{
+				UI::BeginProperties();
+				UI::Property("Cascade Count", Renderer3D::ShadowCascadeCount, 1u, ShadowCascades::MaxCascades, "Number of shadow maps each directional light splits the view into.");
+				if (UI::Property("Shadow Distance", Renderer3D::ShadowDistance, 0.0f, 0.0f, "Directional lights cast shadows up to this distance from the camera.") && Renderer3D::ShadowDistance <= 1.0f)
+					Renderer3D::ShadowDistance = 1.0f;
+				UI::Property("Split Lambda", Renderer3D::ShadowSplitLambda, 0.0f, 1.0f, "Blends cascade splits from uniform (0) to logarithmic (1). Higher values give more resolution close to the camera.");
+				UI::EndProperties();
+
+				ImGui::TreePop();
+			}
+
 			if (ImGui::TreeNodeEx("FXAA", treeNodeFlags))
 			{
 				UI::BeginProperties();
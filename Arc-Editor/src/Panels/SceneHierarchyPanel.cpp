@@ -355,6 +355,9 @@ namespace ArcEngine
 				for (const auto& childId : rc.Children)
 				{
 					Entity child = m_Context->GetEntity(childId);
+					if (!child)
+						continue;
+
 					const float HorizontalTreeLineSize = child.GetRelationship().Children.empty() ? 18.0f : 9.0f; //chosen arbitrarily
 					const ImRect childRect = DrawEntityNode(child, depth + 1, forceExpandTree, isPartOfPrefab);
 
@@ -404,15 +407,15 @@ namespace ArcEngine
 				}
 				else if (ext == "hdr")
 				{
-					m_Context->CreateEntity(name).AddComponent<SkyLightComponent>().Texture = AssetManager::GetTextureCubemap(path);
+					m_Context->CreateEntity(name).AddComponent<SkyLightComponent>().Texture = AssetManager::GetTextureCubemap(path, AssetLoadPriority::High);
 				}
 				else if (ext == "png" || ext == "jpg" || ext == "jpeg" || ext == "bmp")
 				{
-					m_Context->CreateEntity(name).AddComponent<SpriteRendererComponent>().Texture = AssetManager::GetTexture2D(path);
+					m_Context->CreateEntity(name).AddComponent<SpriteRendererComponent>().Texture = AssetManager::GetTexture2D(path, AssetLoadPriority::High);
 				}
 				else if (ext == "obj" || ext == "fbx")
 				{
-					const auto& mesh = AssetManager::GetMesh(path);
+					const auto& mesh = AssetManager::GetMesh(path, AssetLoadPriority::Immediate);
 					const Entity parent = m_Context->CreateEntity(mesh->GetName());
 					const size_t meshCount = mesh->GetSubmeshCount();
 					if (meshCount == 1)
@@ -497,7 +500,7 @@ namespace ArcEngine
 				}
 				if (filepath)
 				{
-					const auto& mesh = AssetManager::GetMesh(filepath);
+					const auto& mesh = AssetManager::GetMesh(filepath, AssetLoadPriority::Immediate);
 					toSelect = m_Context->CreateEntity(mesh->GetName());
 					auto& meshComponent = toSelect.AddComponent<MeshComponent>();
 					meshComponent.MeshGeometry = mesh;
@@ -61,6 +61,23 @@ namespace ArcEngine
 				ImGui::SameLine();
 				ImGui::PushItemWidth(-1);
 				ImGui::Text("Indices: %d", stats.IndexCount);
+
+				ImGui::Text("Instances: %d", stats.InstanceCount);
+			}
+
+			ImGui::Separator();
+
+			{
+				const auto stats = JobSystem::GetStatistics();
+				ImGui::Text("Jobs (%u workers)", JobSystem::GetWorkerCount());
+
+				ImGui::Text("Jobs: %llu", static_cast<unsigned long long>(stats.JobCount));
+				ImGui::SameLine();
+				ImGui::PushItemWidth(-1);
+				ImGui::Text("Wait (ms): %.2f", static_cast<double>(stats.WaitTime));
+				ImGui::SameLine();
+				ImGui::PushItemWidth(-1);
+				ImGui::Text("Idle (ms): %.2f", static_cast<double>(stats.IdleTime));
 			}
 
 			UI::BeginProperties();
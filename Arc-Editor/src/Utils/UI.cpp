@@ -192,7 +192,7 @@ namespace ArcEngine
 			if (const ImGuiPayload* payload = ImGui::AcceptDragDropPayload("CONTENT_BROWSER_ITEM"))
 			{
 				const char* path = static_cast<char*>(payload->Data);
-				texture = AssetManager::GetTextureCubemap(path);
+				texture = AssetManager::GetTextureCubemap(path, AssetLoadPriority::High);
 				changed = true;
 			}
 			ImGui::EndDragDropTarget();
@@ -250,7 +250,7 @@ namespace ArcEngine
 			if (const ImGuiPayload* payload = ImGui::AcceptDragDropPayload("CONTENT_BROWSER_ITEM"))
 			{
 				const char* path = static_cast<char*>(payload->Data);
-				texture = AssetManager::GetTexture2D(path);
+				texture = AssetManager::GetTexture2D(path, AssetLoadPriority::High);
 				changed = true;
 			}
 			ImGui::EndDragDropTarget();
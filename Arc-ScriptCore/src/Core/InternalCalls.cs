@@ -8,11 +8,20 @@ internal static class InternalCalls
 		#region Entity
 
 		[MethodImpl(MethodImplOptions.InternalCall)]
-		internal static extern void Entity_AddComponent(ulong entityID, Type type);
+		internal static extern void Entity_AddComponent(ulong handle, Type type);
 		[MethodImpl(MethodImplOptions.InternalCall)]
-		internal static extern bool Entity_HasComponent(ulong entityID, Type type);
+		internal static extern bool Entity_HasComponent(ulong handle, Type type);
 		[MethodImpl(MethodImplOptions.InternalCall)]
-		internal static extern object Entity_GetComponent(ulong entityID, Type type);
+		internal static extern object Entity_GetComponent(ulong handle, Type type);
+		[MethodImpl(MethodImplOptions.InternalCall)]
+		internal static extern ulong Entity_GetHandle(ulong entityID);
+
+		#endregion
+
+		#region Scene
+
+		[MethodImpl(MethodImplOptions.InternalCall)]
+		internal static extern ulong[] Scene_Query(Type[] types, out ulong[] entityIDs);
 
 		#endregion
 
@@ -37,199 +46,215 @@ internal static class InternalCalls
 		#region TagComponent
 
 		[MethodImpl(MethodImplOptions.InternalCall)]
-		internal static extern string TagComponent_GetTag(ulong entityID);
+		internal static extern string TagComponent_GetTag(ulong handle);
 		[MethodImpl(MethodImplOptions.InternalCall)]
-		internal static extern void TagComponent_SetTag(ulong entityID, string value);
+		internal static extern void TagComponent_SetTag(ulong handle, string value);
 
 		#endregion
 
 		#region TransformComponent
 
 		[MethodImpl(MethodImplOptions.InternalCall)]
-		internal static extern void TransformComponent_GetTransform(ulong entityID, out Transform transform);
+		internal static extern void TransformComponent_GetTransform(ulong handle, out Transform transform);
+		[MethodImpl(MethodImplOptions.InternalCall)]
+		internal static extern void TransformComponent_SetTransform(ulong handle, ref Transform transform);
 		[MethodImpl(MethodImplOptions.InternalCall)]
-		internal static extern void TransformComponent_SetTransform(ulong entityID, ref Transform transform);
+		internal static extern void TransformComponent_GetTranslation(ulong handle, out Vector3 translation);
 		[MethodImpl(MethodImplOptions.InternalCall)]
-		internal static extern void TransformComponent_GetTranslation(ulong entityID, out Vector3 translation);
+		internal static extern void TransformComponent_SetTranslation(ulong handle, ref Vector3 translation);
 		[MethodImpl(MethodImplOptions.InternalCall)]
-		internal static extern void TransformComponent_SetTranslation(ulong entityID, ref Vector3 translation);
+		internal static extern void TransformComponent_GetRotation(ulong handle, out Vector3 eulerAngles);
 		[MethodImpl(MethodImplOptions.InternalCall)]
-		internal static extern void TransformComponent_GetRotation(ulong entityID, out Vector3 eulerAngles);
+		internal static extern void TransformComponent_SetRotation(ulong handle, ref Vector3 eulerAngles);
 		[MethodImpl(MethodImplOptions.InternalCall)]
-		internal static extern void TransformComponent_SetRotation(ulong entityID, ref Vector3 eulerAngles);
+		internal static extern void TransformComponent_GetScale(ulong handle, out Vector3 scale);
 		[MethodImpl(MethodImplOptions.InternalCall)]
-		internal static extern void TransformComponent_GetScale(ulong entityID, out Vector3 scale);
+		internal static extern void TransformComponent_SetScale(ulong handle, ref Vector3 scale);
 		[MethodImpl(MethodImplOptions.InternalCall)]
-		internal static extern void TransformComponent_SetScale(ulong entityID, ref Vector3 scale);
+		internal static extern void TransformComponent_GetTransforms(ulong[] handles, Transform[] transforms);
+		[MethodImpl(MethodImplOptions.InternalCall)]
+		internal static extern void TransformComponent_SetTransforms(ulong[] handles, Transform[] transforms);
+		[MethodImpl(MethodImplOptions.InternalCall)]
+		internal static extern void TransformComponent_GetTranslations(ulong[] handles, Vector3[] translations);
+		[MethodImpl(MethodImplOptions.InternalCall)]
+		internal static extern void TransformComponent_SetTranslations(ulong[] handles, Vector3[] translations);
+		[MethodImpl(MethodImplOptions.InternalCall)]
+		internal static extern void TransformComponent_GetRotations(ulong[] handles, Vector3[] eulerAngles);
+		[MethodImpl(MethodImplOptions.InternalCall)]
+		internal static extern void TransformComponent_SetRotations(ulong[] handles, Vector3[] eulerAngles);
 		
 		#endregion
 
 		#region SpriteRendererComponent
 
 		[MethodImpl(MethodImplOptions.InternalCall)]
-		internal static extern void SpriteRendererComponent_GetColor(ulong entityID, out Color tint);
+		internal static extern void SpriteRendererComponent_GetColor(ulong handle, out Color tint);
 		[MethodImpl(MethodImplOptions.InternalCall)]
-		internal static extern void SpriteRendererComponent_SetColor(ulong entityID, ref Color tint);
+		internal static extern void SpriteRendererComponent_SetColor(ulong handle, ref Color tint);
 		[MethodImpl(MethodImplOptions.InternalCall)]
-		internal static extern void SpriteRendererComponent_GetTilingFactor(ulong entityID, out float tiling);
+		internal static extern void SpriteRendererComponent_GetTilingFactor(ulong handle, out float tiling);
 		[MethodImpl(MethodImplOptions.InternalCall)]
-		internal static extern void SpriteRendererComponent_SetTilingFactor(ulong entityID, ref float tiling);
+		internal static extern void SpriteRendererComponent_SetTilingFactor(ulong handle, ref float tiling);
 
 		#endregion
 
 		#region Rigidbody2DComponent
 
 		[MethodImpl(MethodImplOptions.InternalCall)]
-		internal static extern void Rigidbody2DComponent_GetBodyType(ulong entityID, out int v);
+		internal static extern void Rigidbody2DComponent_GetBodyType(ulong handle, out int v);
 		[MethodImpl(MethodImplOptions.InternalCall)]
-		internal static extern void Rigidbody2DComponent_SetBodyType(ulong entityID, ref int v);
+		internal static extern void Rigidbody2DComponent_SetBodyType(ulong handle, ref int v);
 		[MethodImpl(MethodImplOptions.InternalCall)]
-		internal static extern void Rigidbody2DComponent_GetAutoMass(ulong entityID, out bool v);
+		internal static extern void Rigidbody2DComponent_GetAutoMass(ulong handle, out bool v);
 		[MethodImpl(MethodImplOptions.InternalCall)]
-		internal static extern void Rigidbody2DComponent_SetAutoMass(ulong entityID, ref bool v);
+		internal static extern void Rigidbody2DComponent_SetAutoMass(ulong handle, ref bool v);
 		[MethodImpl(MethodImplOptions.InternalCall)]
-		internal static extern void Rigidbody2DComponent_GetMass(ulong entityID, out float v);
+		internal static extern void Rigidbody2DComponent_GetMass(ulong handle, out float v);
 		[MethodImpl(MethodImplOptions.InternalCall)]
-		internal static extern void Rigidbody2DComponent_SetMass(ulong entityID, ref float v);
+		internal static extern void Rigidbody2DComponent_SetMass(ulong handle, ref float v);
 		[MethodImpl(MethodImplOptions.InternalCall)]
-		internal static extern void Rigidbody2DComponent_GetLinearDrag(ulong entityID, out float v);
+		internal static extern void Rigidbody2DComponent_GetLinearDrag(ulong handle, out float v);
 		[MethodImpl(MethodImplOptions.InternalCall)]
-		internal static extern void Rigidbody2DComponent_SetLinearDrag(ulong entityID, ref float v);
+		internal static extern void Rigidbody2DComponent_SetLinearDrag(ulong handle, ref float v);
 		[MethodImpl(MethodImplOptions.InternalCall)]
-		internal static extern void Rigidbody2DComponent_GetAngularDrag(ulong entityID, out float v);
+		internal static extern void Rigidbody2DComponent_GetAngularDrag(ulong handle, out float v);
 		[MethodImpl(MethodImplOptions.InternalCall)]
-		internal static extern void Rigidbody2DComponent_SetAngularDrag(ulong entityID, ref float v);
+		internal static extern void Rigidbody2DComponent_SetAngularDrag(ulong handle, ref float v);
 		[MethodImpl(MethodImplOptions.InternalCall)]
-		internal static extern void Rigidbody2DComponent_GetAllowSleep(ulong entityID, out bool v);
+		internal static extern void Rigidbody2DComponent_GetAllowSleep(ulong handle, out bool v);
 		[MethodImpl(MethodImplOptions.InternalCall)]
-		internal static extern void Rigidbody2DComponent_SetAllowSleep(ulong entityID, ref bool v);
+		internal static extern void Rigidbody2DComponent_SetAllowSleep(ulong handle, ref bool v);
 		[MethodImpl(MethodImplOptions.InternalCall)]
-		internal static extern void Rigidbody2DComponent_GetAwake(ulong entityID, out bool v);
+		internal static extern void Rigidbody2DComponent_GetAwake(ulong handle, out bool v);
 		[MethodImpl(MethodImplOptions.InternalCall)]
-		internal static extern void Rigidbody2DComponent_SetAwake(ulong entityID, ref bool v);
+		internal static extern void Rigidbody2DComponent_SetAwake(ulong handle, ref bool v);
 		[MethodImpl(MethodImplOptions.InternalCall)]
-		internal static extern void Rigidbody2DComponent_GetContinuous(ulong entityID, out bool v);
+		internal static extern void Rigidbody2DComponent_GetContinuous(ulong handle, out bool v);
 		[MethodImpl(MethodImplOptions.InternalCall)]
-		internal static extern void Rigidbody2DComponent_SetContinuous(ulong entityID, ref bool v);
+		internal static extern void Rigidbody2DComponent_SetContinuous(ulong handle, ref bool v);
 		[MethodImpl(MethodImplOptions.InternalCall)]
-		internal static extern void Rigidbody2DComponent_GetFreezeRotation(ulong entityID, out bool v);
+		internal static extern void Rigidbody2DComponent_GetFreezeRotation(ulong handle, out bool v);
 		[MethodImpl(MethodImplOptions.InternalCall)]
-		internal static extern void Rigidbody2DComponent_SetFreezeRotation(ulong entityID, ref bool v);
+		internal static extern void Rigidbody2DComponent_SetFreezeRotation(ulong handle, ref bool v);
 		[MethodImpl(MethodImplOptions.InternalCall)]
-		internal static extern void Rigidbody2DComponent_GetGravityScale(ulong entityID, out float v);
+		internal static extern void Rigidbody2DComponent_GetGravityScale(ulong handle, out float v);
 		[MethodImpl(MethodImplOptions.InternalCall)]
-		internal static extern void Rigidbody2DComponent_SetGravityScale(ulong entityID, ref float v);
+		internal static extern void Rigidbody2DComponent_SetGravityScale(ulong handle, ref float v);
 
 		[MethodImpl(MethodImplOptions.InternalCall)]
-		internal static extern void Rigidbody2DComponent_ApplyForceAtCenter(ulong entityID, ref Vector2 f);
+		internal static extern void Rigidbody2DComponent_ApplyForceAtCenter(ulong handle, ref Vector2 f);
+		[MethodImpl(MethodImplOptions.InternalCall)]
+		internal static extern void Rigidbody2DComponent_ApplyForce(ulong handle, ref Vector2 f, ref Vector2 p);
+		[MethodImpl(MethodImplOptions.InternalCall)]
+		internal static extern void Rigidbody2DComponent_ApplyLinearImpulseAtCenter(ulong handle, ref Vector2 i);
 		[MethodImpl(MethodImplOptions.InternalCall)]
-		internal static extern void Rigidbody2DComponent_ApplyForce(ulong entityID, ref Vector2 f, ref Vector2 p);
+		internal static extern void Rigidbody2DComponent_ApplyLinearImpulse(ulong handle, ref Vector2 i, ref Vector2 p);
 		[MethodImpl(MethodImplOptions.InternalCall)]
-		internal static extern void Rigidbody2DComponent_ApplyLinearImpulseAtCenter(ulong entityID, ref Vector2 i);
+		internal static extern void Rigidbody2DComponent_ApplyAngularImpulse(ulong handle, ref float i);
 		[MethodImpl(MethodImplOptions.InternalCall)]
-		internal static extern void Rigidbody2DComponent_ApplyLinearImpulse(ulong entityID, ref Vector2 i, ref Vector2 p);
+		internal static extern void Rigidbody2DComponent_ApplyTorque(ulong handle, ref float t);
 		[MethodImpl(MethodImplOptions.InternalCall)]
-		internal static extern void Rigidbody2DComponent_ApplyAngularImpulse(ulong entityID, ref float i);
+		internal static extern void Rigidbody2DComponent_IsAwake(ulong handle, out bool v);
 		[MethodImpl(MethodImplOptions.InternalCall)]
-		internal static extern void Rigidbody2DComponent_ApplyTorque(ulong entityID, ref float t);
+		internal static extern void Rigidbody2DComponent_IsSleeping(ulong handle, out bool v);
 		[MethodImpl(MethodImplOptions.InternalCall)]
-		internal static extern void Rigidbody2DComponent_IsAwake(ulong entityID, out bool v);
+		internal static extern void Rigidbody2DComponent_MovePosition(ulong handle, ref Vector2 p);
 		[MethodImpl(MethodImplOptions.InternalCall)]
-		internal static extern void Rigidbody2DComponent_IsSleeping(ulong entityID, out bool v);
+		internal static extern void Rigidbody2DComponent_MoveRotation(ulong handle, ref float r);
 		[MethodImpl(MethodImplOptions.InternalCall)]
-		internal static extern void Rigidbody2DComponent_MovePosition(ulong entityID, ref Vector2 p);
+		internal static extern void Rigidbody2DComponent_GetVelocity(ulong handle, out Vector2 v);
 		[MethodImpl(MethodImplOptions.InternalCall)]
-		internal static extern void Rigidbody2DComponent_MoveRotation(ulong entityID, ref float r);
+		internal static extern void Rigidbody2DComponent_SetVelocity(ulong handle, ref Vector2 v);
 		[MethodImpl(MethodImplOptions.InternalCall)]
-		internal static extern void Rigidbody2DComponent_GetVelocity(ulong entityID, out Vector2 v);
+		internal static extern void Rigidbody2DComponent_GetVelocities(ulong[] handles, Vector2[] velocities);
 		[MethodImpl(MethodImplOptions.InternalCall)]
-		internal static extern void Rigidbody2DComponent_SetVelocity(ulong entityID, ref Vector2 v);
+		internal static extern void Rigidbody2DComponent_SetVelocities(ulong[] handles, Vector2[] velocities);
 		[MethodImpl(MethodImplOptions.InternalCall)]
-		internal static extern void Rigidbody2DComponent_GetAngularVelocity(ulong entityID, out float v);
+		internal static extern void Rigidbody2DComponent_GetAngularVelocity(ulong handle, out float v);
 		[MethodImpl(MethodImplOptions.InternalCall)]
-		internal static extern void Rigidbody2DComponent_SetAngularVelocity(ulong entityID, ref float v);
+		internal static extern void Rigidbody2DComponent_SetAngularVelocity(ulong handle, ref float v);
 		[MethodImpl(MethodImplOptions.InternalCall)]
-		internal static extern void Rigidbody2DComponent_Sleep(ulong entityID);
+		internal static extern void Rigidbody2DComponent_Sleep(ulong handle);
 		[MethodImpl(MethodImplOptions.InternalCall)]
-		internal static extern void Rigidbody2DComponent_WakeUp(ulong entityID);
+		internal static extern void Rigidbody2DComponent_WakeUp(ulong handle);
 
 		#endregion
 
 		#region AudioSourceComponent
 
 		[MethodImpl(MethodImplOptions.InternalCall)]
-		internal static extern void AudioSource_GetVolume(ulong entityID, out float v);
+		internal static extern void AudioSource_GetVolume(ulong handle, out float v);
 		[MethodImpl(MethodImplOptions.InternalCall)]
-		internal static extern void AudioSource_SetVolume(ulong entityID, ref float v);
+		internal static extern void AudioSource_SetVolume(ulong handle, ref float v);
 		[MethodImpl(MethodImplOptions.InternalCall)]
-		internal static extern void AudioSource_GetPitch(ulong entityID, out float p);
+		internal static extern void AudioSource_GetPitch(ulong handle, out float p);
 		[MethodImpl(MethodImplOptions.InternalCall)]
-		internal static extern void AudioSource_SetPitch(ulong entityID, ref float p);
+		internal static extern void AudioSource_SetPitch(ulong handle, ref float p);
 		[MethodImpl(MethodImplOptions.InternalCall)]
-		internal static extern void AudioSource_GetPlayOnAwake(ulong entityID, out bool v);
+		internal static extern void AudioSource_GetPlayOnAwake(ulong handle, out bool v);
 		[MethodImpl(MethodImplOptions.InternalCall)]
-		internal static extern void AudioSource_SetPlayOnAwake(ulong entityID, ref bool v);
+		internal static extern void AudioSource_SetPlayOnAwake(ulong handle, ref bool v);
 		[MethodImpl(MethodImplOptions.InternalCall)]
-		internal static extern void AudioSource_GetLooping(ulong entityID, out bool v);
+		internal static extern void AudioSource_GetLooping(ulong handle, out bool v);
 		[MethodImpl(MethodImplOptions.InternalCall)]
-		internal static extern void AudioSource_SetLooping(ulong entityID, ref bool v);
+		internal static extern void AudioSource_SetLooping(ulong handle, ref bool v);
 		[MethodImpl(MethodImplOptions.InternalCall)]
-		internal static extern void AudioSource_GetSpatialization(ulong entityID, out bool v);
+		internal static extern void AudioSource_GetSpatialization(ulong handle, out bool v);
 		[MethodImpl(MethodImplOptions.InternalCall)]
-		internal static extern void AudioSource_SetSpatialization(ulong entityID, ref bool v);
+		internal static extern void AudioSource_SetSpatialization(ulong handle, ref bool v);
 		[MethodImpl(MethodImplOptions.InternalCall)]
-		internal static extern void AudioSource_GetAttenuationModel(ulong entityID, out int v);
+		internal static extern void AudioSource_GetAttenuationModel(ulong handle, out int v);
 		[MethodImpl(MethodImplOptions.InternalCall)]
-		internal static extern void AudioSource_SetAttenuationModel(ulong entityID, ref int v);
+		internal static extern void AudioSource_SetAttenuationModel(ulong handle, ref int v);
 		[MethodImpl(MethodImplOptions.InternalCall)]
-		internal static extern void AudioSource_GetRollOff(ulong entityID, out float v);
+		internal static extern void AudioSource_GetRollOff(ulong handle, out float v);
 		[MethodImpl(MethodImplOptions.InternalCall)]
-		internal static extern void AudioSource_SetRollOff(ulong entityID, ref float v);
+		internal static extern void AudioSource_SetRollOff(ulong handle, ref float v);
 		[MethodImpl(MethodImplOptions.InternalCall)]
-		internal static extern void AudioSource_GetMinGain(ulong entityID, out float v);
+		internal static extern void AudioSource_GetMinGain(ulong handle, out float v);
 		[MethodImpl(MethodImplOptions.InternalCall)]
-		internal static extern void AudioSource_SetMinGain(ulong entityID, ref float v);
+		internal static extern void AudioSource_SetMinGain(ulong handle, ref float v);
 		[MethodImpl(MethodImplOptions.InternalCall)]
-		internal static extern void AudioSource_GetMaxGain(ulong entityID, out float v);
+		internal static extern void AudioSource_GetMaxGain(ulong handle, out float v);
 		[MethodImpl(MethodImplOptions.InternalCall)]
-		internal static extern void AudioSource_SetMaxGain(ulong entityID, ref float v);
+		internal static extern void AudioSource_SetMaxGain(ulong handle, ref float v);
 		[MethodImpl(MethodImplOptions.InternalCall)]
-		internal static extern void AudioSource_GetMinDistance(ulong entityID, out float v);
+		internal static extern void AudioSource_GetMinDistance(ulong handle, out float v);
 		[MethodImpl(MethodImplOptions.InternalCall)]
-		internal static extern void AudioSource_SetMinDistance(ulong entityID, ref float v);
+		internal static extern void AudioSource_SetMinDistance(ulong handle, ref float v);
 		[MethodImpl(MethodImplOptions.InternalCall)]
-		internal static extern void AudioSource_GetMaxDistance(ulong entityID, out float v);
+		internal static extern void AudioSource_GetMaxDistance(ulong handle, out float v);
 		[MethodImpl(MethodImplOptions.InternalCall)]
-		internal static extern void AudioSource_SetMaxDistance(ulong entityID, ref float v);
+		internal static extern void AudioSource_SetMaxDistance(ulong handle, ref float v);
 		[MethodImpl(MethodImplOptions.InternalCall)]
-		internal static extern void AudioSource_GetConeInnerAngle(ulong entityID, out float v);
+		internal static extern void AudioSource_GetConeInnerAngle(ulong handle, out float v);
 		[MethodImpl(MethodImplOptions.InternalCall)]
-		internal static extern void AudioSource_SetConeInnerAngle(ulong entityID, ref float v);
+		internal static extern void AudioSource_SetConeInnerAngle(ulong handle, ref float v);
 		[MethodImpl(MethodImplOptions.InternalCall)]
-		internal static extern void AudioSource_GetConeOuterAngle(ulong entityID, out float v);
+		internal static extern void AudioSource_GetConeOuterAngle(ulong handle, out float v);
 		[MethodImpl(MethodImplOptions.InternalCall)]
-		internal static extern void AudioSource_SetConeOuterAngle(ulong entityID, ref float v);
+		internal static extern void AudioSource_SetConeOuterAngle(ulong handle, ref float v);
 		[MethodImpl(MethodImplOptions.InternalCall)]
-		internal static extern void AudioSource_GetConeOuterGain(ulong entityID, out float v);
+		internal static extern void AudioSource_GetConeOuterGain(ulong handle, out float v);
 		[MethodImpl(MethodImplOptions.InternalCall)]
-		internal static extern void AudioSource_SetConeOuterGain(ulong entityID, ref float v);
+		internal static extern void AudioSource_SetConeOuterGain(ulong handle, ref float v);
 		[MethodImpl(MethodImplOptions.InternalCall)]
-		internal static extern void AudioSource_SetCone(ulong entityID, ref float innerConeAngle, ref float outerConeAngle, ref float outerConeGain);
+		internal static extern void AudioSource_SetCone(ulong handle, ref float innerConeAngle, ref float outerConeAngle, ref float outerConeGain);
 		[MethodImpl(MethodImplOptions.InternalCall)]
-		internal static extern void AudioSource_GetDopplerFactor(ulong entityID, out float v);
+		internal static extern void AudioSource_GetDopplerFactor(ulong handle, out float v);
 		[MethodImpl(MethodImplOptions.InternalCall)]
-		internal static extern void AudioSource_SetDopplerFactor(ulong entityID, ref float v);
+		internal static extern void AudioSource_SetDopplerFactor(ulong handle, ref float v);
 
 		[MethodImpl(MethodImplOptions.InternalCall)]
-		internal static extern void AudioSource_IsPlaying(ulong entityID, out bool v);
+		internal static extern void AudioSource_IsPlaying(ulong handle, out bool v);
 		[MethodImpl(MethodImplOptions.InternalCall)]
-		internal static extern void AudioSource_Play(ulong entityID);
+		internal static extern void AudioSource_Play(ulong handle);
 		[MethodImpl(MethodImplOptions.InternalCall)]
-		internal static extern void AudioSource_Pause(ulong entityID);
+		internal static extern void AudioSource_Pause(ulong handle);
 		[MethodImpl(MethodImplOptions.InternalCall)]
-		internal static extern void AudioSource_UnPause(ulong entityID);
+		internal static extern void AudioSource_UnPause(ulong handle);
 		[MethodImpl(MethodImplOptions.InternalCall)]
-		internal static extern void AudioSource_Stop(ulong entityID);
+		internal static extern void AudioSource_Stop(ulong handle);
 
 		#endregion
 	}
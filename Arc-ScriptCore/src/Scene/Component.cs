@@ -9,19 +9,25 @@ public interface IComponent
 		[MethodImpl(MethodImplOptions.AggressiveInlining)]
 		ulong GetEntityID();
 		[MethodImpl(MethodImplOptions.AggressiveInlining)]
-		void SetEntity(ulong id);
+		void SetEntity(ulong id, ulong handle);
 	}
 
 	[UsedImplicitly(ImplicitUseKindFlags.Default, ImplicitUseTargetFlags.WithMembers)]
 	public abstract class Component : IComponent
 	{
 		internal ulong entityID;
+		// Native entity handle, internal calls take it instead of the ID
+		internal ulong handle;
 
 		[MethodImpl(MethodImplOptions.AggressiveInlining)]
 		ulong IComponent.GetEntityID() => entityID;
 
 		[MethodImpl(MethodImplOptions.AggressiveInlining)]
-		void IComponent.SetEntity(ulong id) => entityID = id;
+		void IComponent.SetEntity(ulong id, ulong handle)
+		{
+			entityID = id;
+			this.handle = handle;
+		}
 	}
 
 	/// <summary>
@@ -36,9 +42,9 @@ public class TagComponent : Component
 		public string tag
 		{
 			[MethodImpl(MethodImplOptions.AggressiveInlining)]
-			get => InternalCalls.TagComponent_GetTag(entityID);
+			get => InternalCalls.TagComponent_GetTag(handle);
 			[MethodImpl(MethodImplOptions.AggressiveInlining)]
-			set => InternalCalls.TagComponent_SetTag(entityID, value);
+			set => InternalCalls.TagComponent_SetTag(handle, value);
 		}
 	}
 
@@ -56,11 +62,11 @@ public Transform transform
 			[MethodImpl(MethodImplOptions.AggressiveInlining)]
 			get
 			{
-				InternalCalls.TransformComponent_GetTransform(entityID, out Transform v);
+				InternalCalls.TransformComponent_GetTransform(handle, out Transform v);
 				return v;
 			}
 			[MethodImpl(MethodImplOptions.AggressiveInlining)]
-			set => InternalCalls.TransformComponent_SetTransform(entityID, ref value);
+			set => InternalCalls.TransformComponent_SetTransform(handle, ref value);
 		}
 
 		/// <summary>
@@ -71,11 +77,11 @@ public Vector3 translation
 			[MethodImpl(MethodImplOptions.AggressiveInlining)]
 			get
 			{
-				InternalCalls.TransformComponent_GetTranslation(entityID, out Vector3 v);
+				InternalCalls.TransformComponent_GetTranslation(handle, out Vector3 v);
 				return v;
 			}
 			[MethodImpl(MethodImplOptions.AggressiveInlining)]
-			set => InternalCalls.TransformComponent_SetTranslation(entityID, ref value);
+			set => InternalCalls.TransformComponent_SetTranslation(handle, ref value);
 		}
 
 		/// <summary>
@@ -86,11 +92,11 @@ public Vector3 rotation
 			[MethodImpl(MethodImplOptions.AggressiveInlining)]
 			get
 			{
-				InternalCalls.TransformComponent_GetRotation(entityID, out Vector3 v);
+				InternalCalls.TransformComponent_GetRotation(handle, out Vector3 v);
 				return v;
 			}
 			[MethodImpl(MethodImplOptions.AggressiveInlining)]
-			set => InternalCalls.TransformComponent_SetRotation(entityID, ref value);
+			set => InternalCalls.TransformComponent_SetRotation(handle, ref value);
 		}
 
 		/// <summary>
@@ -101,11 +107,11 @@ public Vector3 scale
 			[MethodImpl(MethodImplOptions.AggressiveInlining)]
 			get
 			{
-				InternalCalls.TransformComponent_GetScale(entityID, out Vector3 v);
+				InternalCalls.TransformComponent_GetScale(handle, out Vector3 v);
 				return v;
 			}
 			[MethodImpl(MethodImplOptions.AggressiveInlining)]
-			set => InternalCalls.TransformComponent_SetScale(entityID, ref value);
+			set => InternalCalls.TransformComponent_SetScale(handle, ref value);
 		}
 	}
 	
@@ -123,11 +129,11 @@ public Color tint
 			[MethodImpl(MethodImplOptions.AggressiveInlining)]
 			get
 			{
-				InternalCalls.SpriteRendererComponent_GetColor(entityID, out Color v);
+				InternalCalls.SpriteRendererComponent_GetColor(handle, out Color v);
 				return v;
 			}
 			[MethodImpl(MethodImplOptions.AggressiveInlining)]
-			set => InternalCalls.SpriteRendererComponent_SetColor(entityID, ref value);
+			set => InternalCalls.SpriteRendererComponent_SetColor(handle, ref value);
 		}
 
 		/// <summary>
@@ -138,11 +144,11 @@ public float tilingFactor
 			[MethodImpl(MethodImplOptions.AggressiveInlining)]
 			get
 			{
-				InternalCalls.SpriteRendererComponent_GetTilingFactor(entityID, out float v);
+				InternalCalls.SpriteRendererComponent_GetTilingFactor(handle, out float v);
 				return v;
 			}
 			[MethodImpl(MethodImplOptions.AggressiveInlining)]
-			set => InternalCalls.SpriteRendererComponent_SetTilingFactor(entityID, ref value);
+			set => InternalCalls.SpriteRendererComponent_SetTilingFactor(handle, ref value);
 		}
 	}
 
@@ -169,14 +175,14 @@ public BodyType type
 			[MethodImpl(MethodImplOptions.AggressiveInlining)]
 			get
 			{
-				InternalCalls.Rigidbody2DComponent_GetBodyType(entityID, out int v);
+				InternalCalls.Rigidbody2DComponent_GetBodyType(handle, out int v);
 				return (BodyType)v;
 			}
 			[MethodImpl(MethodImplOptions.AggressiveInlining)]
 			set
 			{
 				int v = (int)value;
-				InternalCalls.Rigidbody2DComponent_SetBodyType(entityID, ref v);
+				InternalCalls.Rigidbody2DComponent_SetBodyType(handle, ref v);
 			}
 		}
 
@@ -188,11 +194,11 @@ public bool autoMass
 			[MethodImpl(MethodImplOptions.AggressiveInlining)]
 			get
 			{
-				InternalCalls.Rigidbody2DComponent_GetAutoMass(entityID, out bool v);
+				InternalCalls.Rigidbody2DComponent_GetAutoMass(handle, out bool v);
 				return v;
 			}
 			[MethodImpl(MethodImplOptions.AggressiveInlining)]
-			set => InternalCalls.Rigidbody2DComponent_SetAutoMass(entityID, ref value);
+			set => InternalCalls.Rigidbody2DComponent_SetAutoMass(handle, ref value);
 		}
 
 		/// <summary>
@@ -203,11 +209,11 @@ public float mass
 			[MethodImpl(MethodImplOptions.AggressiveInlining)]
 			get
 			{
-				InternalCalls.Rigidbody2DComponent_GetMass(entityID, out float v);
+				InternalCalls.Rigidbody2DComponent_GetMass(handle, out float v);
 				return v;
 			}
 			[MethodImpl(MethodImplOptions.AggressiveInlining)]
-			set => InternalCalls.Rigidbody2DComponent_SetMass(entityID, ref value);
+			set => InternalCalls.Rigidbody2DComponent_SetMass(handle, ref value);
 		}
 
 		/// <summary>
@@ -218,11 +224,11 @@ public float linearDrag
 			[MethodImpl(MethodImplOptions.AggressiveInlining)]
 			get
 			{
-				InternalCalls.Rigidbody2DComponent_GetLinearDrag(entityID, out float v);
+				InternalCalls.Rigidbody2DComponent_GetLinearDrag(handle, out float v);
 				return v;
 			}
 			[MethodImpl(MethodImplOptions.AggressiveInlining)]
-			set => InternalCalls.Rigidbody2DComponent_SetLinearDrag(entityID, ref value);
+			set => InternalCalls.Rigidbody2DComponent_SetLinearDrag(handle, ref value);
 		}
 
 		/// <summary>
@@ -233,11 +239,11 @@ public float angularDrag
 			[MethodImpl(MethodImplOptions.AggressiveInlining)]
 			get
 			{
-				InternalCalls.Rigidbody2DComponent_GetAngularDrag(entityID, out float v);
+				InternalCalls.Rigidbody2DComponent_GetAngularDrag(handle, out float v);
 				return v;
 			}
 			[MethodImpl(MethodImplOptions.AggressiveInlining)]
-			set => InternalCalls.Rigidbody2DComponent_SetAngularDrag(entityID, ref value);
+			set => InternalCalls.Rigidbody2DComponent_SetAngularDrag(handle, ref value);
 		}
 
 		/// <summary>
@@ -248,11 +254,11 @@ public float gravityScale
 			[MethodImpl(MethodImplOptions.AggressiveInlining)]
 			get
 			{
-				InternalCalls.Rigidbody2DComponent_GetGravityScale(entityID, out float v);
+				InternalCalls.Rigidbody2DComponent_GetGravityScale(handle, out float v);
 				return v;
 			}
 			[MethodImpl(MethodImplOptions.AggressiveInlining)]
-			set => InternalCalls.Rigidbody2DComponent_SetGravityScale(entityID, ref value);
+			set => InternalCalls.Rigidbody2DComponent_SetGravityScale(handle, ref value);
 		}
 
 		/// <summary>
@@ -264,11 +270,11 @@ public bool allowSleep
 			[MethodImpl(MethodImplOptions.AggressiveInlining)]
 			get
 			{
-				InternalCalls.Rigidbody2DComponent_GetAllowSleep(entityID, out bool v);
+				InternalCalls.Rigidbody2DComponent_GetAllowSleep(handle, out bool v);
 				return v;
 			}
 			[MethodImpl(MethodImplOptions.AggressiveInlining)]
-			set => InternalCalls.Rigidbody2DComponent_SetAllowSleep(entityID, ref value);
+			set => InternalCalls.Rigidbody2DComponent_SetAllowSleep(handle, ref value);
 		}
 
 		/// <summary>
@@ -279,11 +285,11 @@ public bool awake
 			[MethodImpl(MethodImplOptions.AggressiveInlining)]
 			get
 			{
-				InternalCalls.Rigidbody2DComponent_GetAwake(entityID, out bool v);
+				InternalCalls.Rigidbody2DComponent_GetAwake(handle, out bool v);
 				return v;
 			}
 			[MethodImpl(MethodImplOptions.AggressiveInlining)]
-			set => InternalCalls.Rigidbody2DComponent_SetAwake(entityID, ref value);
+			set => InternalCalls.Rigidbody2DComponent_SetAwake(handle, ref value);
 		}
 
 		/// <summary>
@@ -296,11 +302,11 @@ public bool continuous
 			[MethodImpl(MethodImplOptions.AggressiveInlining)]
 			get
 			{
-				InternalCalls.Rigidbody2DComponent_GetContinuous(entityID, out bool v);
+				InternalCalls.Rigidbody2DComponent_GetContinuous(handle, out bool v);
 				return v;
 			}
 			[MethodImpl(MethodImplOptions.AggressiveInlining)]
-			set => InternalCalls.Rigidbody2DComponent_SetContinuous(entityID, ref value);
+			set => InternalCalls.Rigidbody2DComponent_SetContinuous(handle, ref value);
 		}
 
 		/// <summary>
@@ -311,11 +317,11 @@ public bool freezeRotation
 			[MethodImpl(MethodImplOptions.AggressiveInlining)]
 			get
 			{
-				InternalCalls.Rigidbody2DComponent_GetFreezeRotation(entityID, out bool v);
+				InternalCalls.Rigidbody2DComponent_GetFreezeRotation(handle, out bool v);
 				return v;
 			}
 			[MethodImpl(MethodImplOptions.AggressiveInlining)]
-			set => InternalCalls.Rigidbody2DComponent_SetFreezeRotation(entityID, ref value);
+			set => InternalCalls.Rigidbody2DComponent_SetFreezeRotation(handle, ref value);
 		}
 
 		/// <summary>
@@ -326,11 +332,11 @@ public float angularVelocity
 			[MethodImpl(MethodImplOptions.AggressiveInlining)]
 			get
 			{
-				InternalCalls.Rigidbody2DComponent_GetAngularVelocity(entityID, out float v);
+				InternalCalls.Rigidbody2DComponent_GetAngularVelocity(handle, out float v);
 				return v;
 			}
 			[MethodImpl(MethodImplOptions.AggressiveInlining)]
-			set => InternalCalls.Rigidbody2DComponent_SetAngularVelocity(entityID, ref value);
+			set => InternalCalls.Rigidbody2DComponent_SetAngularVelocity(handle, ref value);
 		}
 
 		/// <summary>
@@ -341,11 +347,11 @@ public Vector2 velocity
 			[MethodImpl(MethodImplOptions.AggressiveInlining)]
 			get
 			{
-				InternalCalls.Rigidbody2DComponent_GetVelocity(entityID, out Vector2 v);
+				InternalCalls.Rigidbody2DComponent_GetVelocity(handle, out Vector2 v);
 				return v;
 			}
 			[MethodImpl(MethodImplOptions.AggressiveInlining)]
-			set => InternalCalls.Rigidbody2DComponent_SetVelocity(entityID, ref value);
+			set => InternalCalls.Rigidbody2DComponent_SetVelocity(handle, ref value);
 		}
 
 		/// <summary>
@@ -353,7 +359,7 @@ public Vector2 velocity
 		/// </summary>
 		/// <param name="force">Force to apply.</param>
 		[MethodImpl(MethodImplOptions.AggressiveInlining)]
-		public void ApplyForce(Vector2 force) => InternalCalls.Rigidbody2DComponent_ApplyForceAtCenter(entityID, ref force);
+		public void ApplyForce(Vector2 force) => InternalCalls.Rigidbody2DComponent_ApplyForceAtCenter(handle, ref force);
 
 		/// <summary>
 		/// Apply a force to the Rigidbody at a given position in space.
@@ -361,14 +367,14 @@ public Vector2 velocity
 		/// <param name="force">Force to apply.</param>
 		/// <param name="point">Point to apply force at.</param>
 		[MethodImpl(MethodImplOptions.AggressiveInlining)]
-		public void ApplyForce(Vector2 force, Vector2 point) => InternalCalls.Rigidbody2DComponent_ApplyForce(entityID, ref force, ref point);
+		public void ApplyForce(Vector2 force, Vector2 point) => InternalCalls.Rigidbody2DComponent_ApplyForce(handle, ref force, ref point);
 
 		/// <summary>
 		/// Apply a linear impulse to the Rigidbody.
 		/// </summary>
 		/// <param name="force">Impulse to apply.</param>
 		[MethodImpl(MethodImplOptions.AggressiveInlining)]
-		public void ApplyLinearImpulse(Vector2 force) => InternalCalls.Rigidbody2DComponent_ApplyLinearImpulseAtCenter(entityID, ref force);
+		public void ApplyLinearImpulse(Vector2 force) => InternalCalls.Rigidbody2DComponent_ApplyLinearImpulseAtCenter(handle, ref force);
 
 		/// <summary>
 		/// Apply a linear impulse to the Rigidbody at a given position in space.
@@ -376,21 +382,21 @@ public Vector2 velocity
 		/// <param name="force">Impulse to apply.</param>
 		/// <param name="point">Point to apply impulse at.</param>
 		[MethodImpl(MethodImplOptions.AggressiveInlining)]
-		public void ApplyLinearImpulse(Vector2 force, Vector2 point) => InternalCalls.Rigidbody2DComponent_ApplyLinearImpulse(entityID, ref force, ref point);
+		public void ApplyLinearImpulse(Vector2 force, Vector2 point) => InternalCalls.Rigidbody2DComponent_ApplyLinearImpulse(handle, ref force, ref point);
 
 		/// <summary>
 		/// Apply an angular impulse to the Rigidbody.
 		/// </summary>
 		/// <param name="force">Impulse to apply</param>
 		[MethodImpl(MethodImplOptions.AggressiveInlining)]
-		public void ApplyAngularImpulse(float force) => InternalCalls.Rigidbody2DComponent_ApplyAngularImpulse(entityID, ref force);
+		public void ApplyAngularImpulse(float force) => InternalCalls.Rigidbody2DComponent_ApplyAngularImpulse(handle, ref force);
 
 		/// <summary>
 		/// Apply a torque at the Rigidbody's centre of mass.
 		/// </summary>
 		/// <param name="torque"></param>
 		[MethodImpl(MethodImplOptions.AggressiveInlining)]
-		public void ApplyTorque(float torque) => InternalCalls.Rigidbody2DComponent_ApplyTorque(entityID, ref torque);
+		public void ApplyTorque(float torque) => InternalCalls.Rigidbody2DComponent_ApplyTorque(handle, ref torque);
 
 		/// <summary>
 		/// Is the Rigidbody "awake"?
@@ -399,7 +405,7 @@ public Vector2 velocity
 		[MethodImpl(MethodImplOptions.AggressiveInlining)]
 		public bool IsAwake()
 		{
-			InternalCalls.Rigidbody2DComponent_IsAwake(entityID, out bool v);
+			InternalCalls.Rigidbody2DComponent_IsAwake(handle, out bool v);
 			return v;
 		}
 
@@ -410,7 +416,7 @@ public bool IsAwake()
 		[MethodImpl(MethodImplOptions.AggressiveInlining)]
 		public bool IsSleeping()
 		{
-			InternalCalls.Rigidbody2DComponent_IsSleeping(entityID, out bool v);
+			InternalCalls.Rigidbody2DComponent_IsSleeping(handle, out bool v);
 			return v;
 		}
 
@@ -419,26 +425,26 @@ public bool IsSleeping()
 		/// </summary>
 		/// <param name="position">Target position</param>
 		[MethodImpl(MethodImplOptions.AggressiveInlining)]
-		public void MovePosition(Vector2 position) => InternalCalls.Rigidbody2DComponent_MovePosition(entityID, ref position);
+		public void MovePosition(Vector2 position) => InternalCalls.Rigidbody2DComponent_MovePosition(handle, ref position);
 
 		/// <summary>
 		/// Rotates the Rigidbody to angle (given in radians).
 		/// </summary>
 		/// <param name="rotationRadians">Target angle (in radians)</param>
 		[MethodImpl(MethodImplOptions.AggressiveInlining)]
-		public void MoveRotation(float rotationRadians) => InternalCalls.Rigidbody2DComponent_MoveRotation(entityID, ref rotationRadians);
+		public void MoveRotation(float rotationRadians) => InternalCalls.Rigidbody2DComponent_MoveRotation(handle, ref rotationRadians);
 
 		/// <summary>
 		/// Make the Rigidbody "sleep".
 		/// </summary>
 		[MethodImpl(MethodImplOptions.AggressiveInlining)]
-		public void Sleep() => InternalCalls.Rigidbody2DComponent_Sleep(entityID);
+		public void Sleep() => InternalCalls.Rigidbody2DComponent_Sleep(handle);
 
 		/// <summary>
 		/// Disables the "sleeping" state of a Rigidbody.
 		/// </summary>
 		[MethodImpl(MethodImplOptions.AggressiveInlining)]
-		public void WakeUp() => InternalCalls.Rigidbody2DComponent_WakeUp(entityID);
+		public void WakeUp() => InternalCalls.Rigidbody2DComponent_WakeUp(handle);
 	}
 
 	/// <summary>
@@ -470,11 +476,11 @@ public float volume
 			[MethodImpl(MethodImplOptions.AggressiveInlining)]
 			get
 			{
-				InternalCalls.AudioSource_GetVolume(entityID, out float v);
+				InternalCalls.AudioSource_GetVolume(handle, out float v);
 				return v;
 			}
 			[MethodImpl(MethodImplOptions.AggressiveInlining)]
-			set => InternalCalls.AudioSource_SetVolume(entityID, ref value);
+			set => InternalCalls.AudioSource_SetVolume(handle, ref value);
 		}
 
 		/// <summary>
@@ -485,11 +491,11 @@ public float pitch
 			[MethodImpl(MethodImplOptions.AggressiveInlining)]
 			get
 			{
-				InternalCalls.AudioSource_GetPitch(entityID, out float v);
+				InternalCalls.AudioSource_GetPitch(handle, out float v);
 				return v;
 			}
 			[MethodImpl(MethodImplOptions.AggressiveInlining)]
-			set => InternalCalls.AudioSource_SetPitch(entityID, ref value);
+			set => InternalCalls.AudioSource_SetPitch(handle, ref value);
 		}
 
 		/// <summary>
@@ -500,11 +506,11 @@ public bool playOnAwake
 			[MethodImpl(MethodImplOptions.AggressiveInlining)]
 			get
 			{
-				InternalCalls.AudioSource_GetPlayOnAwake(entityID, out bool v);
+				InternalCalls.AudioSource_GetPlayOnAwake(handle, out bool v);
 				return v;
 			}
 			[MethodImpl(MethodImplOptions.AggressiveInlining)]
-			set => InternalCalls.AudioSource_SetPlayOnAwake(entityID, ref value);
+			set => InternalCalls.AudioSource_SetPlayOnAwake(handle, ref value);
 		}
 
 		/// <summary>
@@ -515,11 +521,11 @@ public bool looping
 			[MethodImpl(MethodImplOptions.AggressiveInlining)]
 			get
 			{
-				InternalCalls.AudioSource_GetLooping(entityID, out bool v);
+				InternalCalls.AudioSource_GetLooping(handle, out bool v);
 				return v;
 			}
 			[MethodImpl(MethodImplOptions.AggressiveInlining)]
-			set => InternalCalls.AudioSource_SetLooping(entityID, ref value);
+			set => InternalCalls.AudioSource_SetLooping(handle, ref value);
 		}
 
 		/// <summary>
@@ -530,11 +536,11 @@ public bool spatialization
 			[MethodImpl(MethodImplOptions.AggressiveInlining)]
 			get
 			{
-				InternalCalls.AudioSource_GetSpatialization(entityID, out bool v);
+				InternalCalls.AudioSource_GetSpatialization(handle, out bool v);
 				return v;
 			}
 			[MethodImpl(MethodImplOptions.AggressiveInlining)]
-			set => InternalCalls.AudioSource_SetSpatialization(entityID, ref value);
+			set => InternalCalls.AudioSource_SetSpatialization(handle, ref value);
 		}
 
 		/// <summary>
@@ -545,14 +551,14 @@ public AttenuationModelType attenuationModel
 			[MethodImpl(MethodImplOptions.AggressiveInlining)]
 			get
 			{
-				InternalCalls.AudioSource_GetAttenuationModel(entityID, out int v);
+				InternalCalls.AudioSource_GetAttenuationModel(handle, out int v);
 				return (AttenuationModelType)v;
 			}
 			[MethodImpl(MethodImplOptions.AggressiveInlining)]
 			set
 			{
 				int v = (int)value;
-				InternalCalls.AudioSource_SetAttenuationModel(entityID, ref v);
+				InternalCalls.AudioSource_SetAttenuationModel(handle, ref v);
 			}
 		}
 
@@ -564,11 +570,11 @@ public float rollOff
 			[MethodImpl(MethodImplOptions.AggressiveInlining)]
 			get
 			{
-				InternalCalls.AudioSource_GetRollOff(entityID, out float v);
+				InternalCalls.AudioSource_GetRollOff(handle, out float v);
 				return v;
 			}
 			[MethodImpl(MethodImplOptions.AggressiveInlining)]
-			set => InternalCalls.AudioSource_SetRollOff(entityID, ref value);
+			set => InternalCalls.AudioSource_SetRollOff(handle, ref value);
 		}
 
 		/// <summary>
@@ -579,11 +585,11 @@ public float minGain
 			[MethodImpl(MethodImplOptions.AggressiveInlining)]
 			get
 			{
-				InternalCalls.AudioSource_GetMinGain(entityID, out float v);
+				InternalCalls.AudioSource_GetMinGain(handle, out float v);
 				return v;
 			}
 			[MethodImpl(MethodImplOptions.AggressiveInlining)]
-			set => InternalCalls.AudioSource_SetMinGain(entityID, ref value);
+			set => InternalCalls.AudioSource_SetMinGain(handle, ref value);
 		}
 
 		/// <summary>
@@ -594,11 +600,11 @@ public float maxGain
 			[MethodImpl(MethodImplOptions.AggressiveInlining)]
 			get
 			{
-				InternalCalls.AudioSource_GetMaxGain(entityID, out float v);
+				InternalCalls.AudioSource_GetMaxGain(handle, out float v);
 				return v;
 			}
 			[MethodImpl(MethodImplOptions.AggressiveInlining)]
-			set => InternalCalls.AudioSource_SetMaxGain(entityID, ref value);
+			set => InternalCalls.AudioSource_SetMaxGain(handle, ref value);
 		}
 
 		/// <summary>
@@ -609,11 +615,11 @@ public float minDistance
 			[MethodImpl(MethodImplOptions.AggressiveInlining)]
 			get
 			{
-				InternalCalls.AudioSource_GetMinDistance(entityID, out float v);
+				InternalCalls.AudioSource_GetMinDistance(handle, out float v);
 				return v;
 			}
 			[MethodImpl(MethodImplOptions.AggressiveInlining)]
-			set => InternalCalls.AudioSource_SetMinDistance(entityID, ref value);
+			set => InternalCalls.AudioSource_SetMinDistance(handle, ref value);
 		}
 
 		/// <summary>
@@ -624,11 +630,11 @@ public float maxDistance
 			[MethodImpl(MethodImplOptions.AggressiveInlining)]
 			get
 			{
-				InternalCalls.AudioSource_GetMaxDistance(entityID, out float v);
+				InternalCalls.AudioSource_GetMaxDistance(handle, out float v);
 				return v;
 			}
 			[MethodImpl(MethodImplOptions.AggressiveInlining)]
-			set => InternalCalls.AudioSource_SetMaxDistance(entityID, ref value);
+			set => InternalCalls.AudioSource_SetMaxDistance(handle, ref value);
 		}
 
 		/// <summary>
@@ -639,11 +645,11 @@ public float coneInnerAngle
 			[MethodImpl(MethodImplOptions.AggressiveInlining)]
 			get
 			{
-				InternalCalls.AudioSource_GetConeInnerAngle(entityID, out float v);
+				InternalCalls.AudioSource_GetConeInnerAngle(handle, out float v);
 				return v;
 			}
 			[MethodImpl(MethodImplOptions.AggressiveInlining)]
-			set => InternalCalls.AudioSource_SetConeInnerAngle(entityID, ref value);
+			set => InternalCalls.AudioSource_SetConeInnerAngle(handle, ref value);
 		}
 
 		/// <summary>
@@ -654,11 +660,11 @@ public float coneOuterAngle
 			[MethodImpl(MethodImplOptions.AggressiveInlining)]
 			get
 			{
-				InternalCalls.AudioSource_GetConeOuterAngle(entityID, out float v);
+				InternalCalls.AudioSource_GetConeOuterAngle(handle, out float v);
 				return v;
 			}
 			[MethodImpl(MethodImplOptions.AggressiveInlining)]
-			set => InternalCalls.AudioSource_SetConeOuterAngle(entityID, ref value);
+			set => InternalCalls.AudioSource_SetConeOuterAngle(handle, ref value);
 		}
 
 		/// <summary>
@@ -669,11 +675,11 @@ public float coneOuterGain
 			[MethodImpl(MethodImplOptions.AggressiveInlining)]
 			get
 			{
-				InternalCalls.AudioSource_GetConeOuterGain(entityID, out float v);
+				InternalCalls.AudioSource_GetConeOuterGain(handle, out float v);
 				return v;
 			}
 			[MethodImpl(MethodImplOptions.AggressiveInlining)]
-			set => InternalCalls.AudioSource_SetConeOuterGain(entityID, ref value);
+			set => InternalCalls.AudioSource_SetConeOuterGain(handle, ref value);
 		}
 
 		/// <summary>
@@ -684,11 +690,11 @@ public float dopplerFactor
 			[MethodImpl(MethodImplOptions.AggressiveInlining)]
 			get
 			{
-				InternalCalls.AudioSource_GetDopplerFactor(entityID, out float v);
+				InternalCalls.AudioSource_GetDopplerFactor(handle, out float v);
 				return v;
 			}
 			[MethodImpl(MethodImplOptions.AggressiveInlining)]
-			set => InternalCalls.AudioSource_SetDopplerFactor(entityID, ref value);
+			set => InternalCalls.AudioSource_SetDopplerFactor(handle, ref value);
 		}
 
 		/// <summary>
@@ -698,7 +704,7 @@ public float dopplerFactor
 		[MethodImpl(MethodImplOptions.AggressiveInlining)]
 		public bool IsPlaying()
 		{
-			InternalCalls.AudioSource_IsPlaying(entityID, out bool v);
+			InternalCalls.AudioSource_IsPlaying(handle, out bool v);
 			return v;
 		}
 
@@ -706,24 +712,24 @@ public bool IsPlaying()
 		/// Plays the clip.
 		/// </summary>
 		[MethodImpl(MethodImplOptions.AggressiveInlining)]
-		public void Play() => InternalCalls.AudioSource_Play(entityID);
+		public void Play() => InternalCalls.AudioSource_Play(handle);
 
 		/// <summary>
 		/// 	Pauses playing the clip.
 		/// </summary>
 		[MethodImpl(MethodImplOptions.AggressiveInlining)]
-		public void Pause() => InternalCalls.AudioSource_Pause(entityID);
+		public void Pause() => InternalCalls.AudioSource_Pause(handle);
 
 		/// <summary>
 		/// Unpause the paused playback of this AudioSource.
 		/// </summary>
 		[MethodImpl(MethodImplOptions.AggressiveInlining)]
-		public void UnPause() => InternalCalls.AudioSource_UnPause(entityID);
+		public void UnPause() => InternalCalls.AudioSource_UnPause(handle);
 
 		/// <summary>
 		/// Stops playing the clip.
 		/// </summary>
 		[MethodImpl(MethodImplOptions.AggressiveInlining)]
-		public void Stop() => InternalCalls.AudioSource_Stop(entityID);
+		public void Stop() => InternalCalls.AudioSource_Stop(handle);
 	}
 }
@@ -15,6 +15,16 @@ public class Entity : IComponent, IEqualityComparer<Entity>
 	{
 		internal ulong ID { get; private set; }
 
+		private ulong handle;
+
+		// Native handle the internal calls resolve without a lookup by ID, fetched on first use
+		// for entities created on the managed side
+		internal ulong Handle
+		{
+			[MethodImpl(MethodImplOptions.AggressiveInlining)]
+			get => handle != 0 ? handle : handle = InternalCalls.Entity_GetHandle(ID);
+		}
+
 		#region CollisionCallbacks
 
 		/// <summary>
@@ -27,6 +37,13 @@ public struct CollisionData
 			public Vector2 relativeVelocity;
 
 			public Entity entity => new Entity(entityID);
+
+			[MethodImpl(MethodImplOptions.AggressiveInlining)]
+			internal CollisionData(ulong entityID, Vector2 relativeVelocity)
+			{
+				this.entityID = entityID;
+				this.relativeVelocity = relativeVelocity;
+			}
 		}
 
 		protected event Action<CollisionData> OnCollisionEnter2D;
@@ -50,6 +67,13 @@ private Entity(ulong id)
 			ID = id;
 		}
 
+		[MethodImpl(MethodImplOptions.AggressiveInlining)]
+		internal Entity(ulong id, ulong handle)
+		{
+			ID = id;
+			this.handle = handle;
+		}
+
 		#endregion
 
 		#region PublicMethods
@@ -62,7 +86,7 @@ private Entity(ulong id)
 		[MethodImpl(MethodImplOptions.AggressiveInlining)]
 		public bool HasComponent<T>() where T : class, IComponent
 		{
-			return InternalCalls.Entity_HasComponent(ID, typeof(T));
+			return InternalCalls.Entity_HasComponent(Handle, typeof(T));
 		}
 
 		/// <summary>
@@ -79,9 +103,9 @@ public T AddComponent<T>() where T : class, IComponent, new()
 				return GetComponent<T>();
 			}
 
-			InternalCalls.Entity_AddComponent(ID, typeof(T));
+			InternalCalls.Entity_AddComponent(Handle, typeof(T));
 			T component = new T();
-			component.SetEntity(ID);
+			component.SetEntity(ID, Handle);
 			return component;
 		}
 
@@ -97,10 +121,10 @@ public T GetComponent<T>() where T : class, IComponent, new()
 				return null;
 			
 			if (typeof(T).BaseType == typeof(Entity))
-				return (T)InternalCalls.Entity_GetComponent(ID, typeof(T));
+				return (T)InternalCalls.Entity_GetComponent(Handle, typeof(T));
 
 			T component = new T();
-			component.SetEntity(ID);
+			component.SetEntity(ID, Handle);
 			return component;
 		}
 
@@ -110,13 +134,15 @@ public T GetComponent<T>() where T : class, IComponent, new()
 
 		#region CollisionHandlingMethods
 
-		private void HandleOnCollisionEnter2D(CollisionData data) => OnCollisionEnter2D?.Invoke(data);
+		// Called from the engine through unmanaged thunks, which take primitives without boxing them
+
+		private void HandleOnCollisionEnter2D(ulong entityID, float velocityX, float velocityY) => OnCollisionEnter2D?.Invoke(new CollisionData(entityID, new Vector2(velocityX, velocityY)));
 
-		private void HandleOnCollisionExit2D(CollisionData data) => OnCollisionExit2D?.Invoke(data);
+		private void HandleOnCollisionExit2D(ulong entityID, float velocityX, float velocityY) => OnCollisionExit2D?.Invoke(new CollisionData(entityID, new Vector2(velocityX, velocityY)));
 
-		private void HandleOnSensorEnter2D(CollisionData data) => OnSensorEnter2D?.Invoke(data);
+		private void HandleOnSensorEnter2D(ulong entityID, float velocityX, float velocityY) => OnSensorEnter2D?.Invoke(new CollisionData(entityID, new Vector2(velocityX, velocityY)));
 
-		private void HandleOnSensorExit2D(CollisionData data) => OnSensorExit2D?.Invoke(data);
+		private void HandleOnSensorExit2D(ulong entityID, float velocityX, float velocityY) => OnSensorExit2D?.Invoke(new CollisionData(entityID, new Vector2(velocityX, velocityY)));
 
 		#endregion
 
@@ -129,9 +155,10 @@ ulong IComponent.GetEntityID()
 		}
 
 		[MethodImpl(MethodImplOptions.AggressiveInlining)]
-		void IComponent.SetEntity(ulong id)
+		void IComponent.SetEntity(ulong id, ulong handle)
 		{
 			ID = id;
+			this.handle = handle;
 		}
 
 		#endregion
@@ -0,0 +1,169 @@
+﻿using System;
+using System.Collections;
+using System.Collections.Generic;
+using System.Runtime.CompilerServices;
+using JetBrains.Annotations;
+
+namespace ArcEngine
+{
+	/// <summary>
+	/// Entities that have all of the given components, collected from the scene in a single call.
+	/// The bulk accessors read or write one component of every entity in the query with a single call as well,
+	/// instead of one call per entity.
+	/// </summary>
+	/// <remarks>
+	/// A query is a snapshot: entities created afterwards are not in it, destroyed ones are skipped by the bulk accessors.
+	/// Only built-in components can be queried.
+	/// </remarks>
+	[UsedImplicitly(ImplicitUseKindFlags.Default, ImplicitUseTargetFlags.WithMembers)]
+	public sealed class EntityQuery : IEnumerable<Entity>
+	{
+		private readonly ulong[] handles;
+		private readonly ulong[] entityIDs;
+
+		[MethodImpl(MethodImplOptions.AggressiveInlining)]
+		private EntityQuery(params Type[] types)
+		{
+			handles = InternalCalls.Scene_Query(types, out entityIDs);
+		}
+
+		#region Constructors
+
+		/// <summary>
+		/// Entities with a component of Type T.
+		/// </summary>
+		[MethodImpl(MethodImplOptions.AggressiveInlining)]
+		public static EntityQuery With<T>() where T : Component
+			=> new EntityQuery(typeof(T));
+
+		/// <summary>
+		/// Entities with components of Type T1 and T2.
+		/// </summary>
+		[MethodImpl(MethodImplOptions.AggressiveInlining)]
+		public static EntityQuery With<T1, T2>() where T1 : Component where T2 : Component
+			=> new EntityQuery(typeof(T1), typeof(T2));
+
+		/// <summary>
+		/// Entities with components of Type T1, T2 and T3.
+		/// </summary>
+		[MethodImpl(MethodImplOptions.AggressiveInlining)]
+		public static EntityQuery With<T1, T2, T3>() where T1 : Component where T2 : Component where T3 : Component
+			=> new EntityQuery(typeof(T1), typeof(T2), typeof(T3));
+
+		#endregion
+
+		#region PublicMethods
+
+		/// <summary>
+		/// Number of entities in the query.
+		/// </summary>
+		public int Count
+		{
+			[MethodImpl(MethodImplOptions.AggressiveInlining)]
+			get => handles.Length;
+		}
+
+		/// <summary>
+		/// Entity at index, in the same order as the arrays of the bulk accessors.
+		/// </summary>
+		public Entity this[int index]
+		{
+			[MethodImpl(MethodImplOptions.AggressiveInlining)]
+			get => new Entity(entityIDs[index], handles[index]);
+		}
+
+		// The arrays passed to the bulk accessors need one element per entity, any further elements are left alone
+
+		/// <summary>
+		/// Copies the transform of every entity into transforms.
+		/// </summary>
+		[MethodImpl(MethodImplOptions.AggressiveInlining)]
+		public void GetTransforms(Transform[] transforms) => InternalCalls.TransformComponent_GetTransforms(handles, transforms);
+
+		/// <summary>
+		/// Sets the transform of every entity from transforms.
+		/// </summary>
+		[MethodImpl(MethodImplOptions.AggressiveInlining)]
+		public void SetTransforms(Transform[] transforms) => InternalCalls.TransformComponent_SetTransforms(handles, transforms);
+
+		/// <summary>
+		/// Copies the translation of every entity into translations.
+		/// </summary>
+		[MethodImpl(MethodImplOptions.AggressiveInlining)]
+		public void GetTranslations(Vector3[] translations) => InternalCalls.TransformComponent_GetTranslations(handles, translations);
+
+		/// <summary>
+		/// Sets the translation of every entity from translations.
+		/// </summary>
+		[MethodImpl(MethodImplOptions.AggressiveInlining)]
+		public void SetTranslations(Vector3[] translations) => InternalCalls.TransformComponent_SetTranslations(handles, translations);
+
+		/// <summary>
+		/// Copies the rotation of every entity into eulerAngles (radians).
+		/// </summary>
+		[MethodImpl(MethodImplOptions.AggressiveInlining)]
+		public void GetRotations(Vector3[] eulerAngles) => InternalCalls.TransformComponent_GetRotations(handles, eulerAngles);
+
+		/// <summary>
+		/// Sets the rotation of every entity from eulerAngles (radians).
+		/// </summary>
+		[MethodImpl(MethodImplOptions.AggressiveInlining)]
+		public void SetRotations(Vector3[] eulerAngles) => InternalCalls.TransformComponent_SetRotations(handles, eulerAngles);
+
+		/// <summary>
+		/// Copies the linear velocity of every entity's Rigidbody2DComponent into velocities.
+		/// </summary>
+		[MethodImpl(MethodImplOptions.AggressiveInlining)]
+		public void GetVelocities2D(Vector2[] velocities) => InternalCalls.Rigidbody2DComponent_GetVelocities(handles, velocities);
+
+		/// <summary>
+		/// Sets the linear velocity of every entity's Rigidbody2DComponent from velocities.
+		/// </summary>
+		[MethodImpl(MethodImplOptions.AggressiveInlining)]
+		public void SetVelocities2D(Vector2[] velocities) => InternalCalls.Rigidbody2DComponent_SetVelocities(handles, velocities);
+
+		#endregion
+
+		#region Enumeration
+
+		[MethodImpl(MethodImplOptions.AggressiveInlining)]
+		public Enumerator GetEnumerator() => new Enumerator(this);
+
+		IEnumerator<Entity> IEnumerable<Entity>.GetEnumerator() => GetEnumerator();
+
+		IEnumerator IEnumerable.GetEnumerator() => GetEnumerator();
+
+		public struct Enumerator : IEnumerator<Entity>
+		{
+			private readonly EntityQuery query;
+			private int index;
+
+			[MethodImpl(MethodImplOptions.AggressiveInlining)]
+			internal Enumerator(EntityQuery query)
+			{
+				this.query = query;
+				index = -1;
+			}
+
+			public Entity Current
+			{
+				[MethodImpl(MethodImplOptions.AggressiveInlining)]
+				get => query[index];
+			}
+
+			object IEnumerator.Current => Current;
+
+			[MethodImpl(MethodImplOptions.AggressiveInlining)]
+			public bool MoveNext() => ++index < query.Count;
+
+			[MethodImpl(MethodImplOptions.AggressiveInlining)]
+			public void Reset() => index = -1;
+
+			public void Dispose()
+			{
+			}
+		}
+
+		#endregion
+	}
+}
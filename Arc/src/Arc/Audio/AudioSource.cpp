@@ -7,61 +7,142 @@
 
 namespace ArcEngine
 {
-	AudioSource::AudioSource(const char* filepath)
+	AudioSource::AudioSource(const char* filepath, bool loadNow)
 		: m_Path(filepath)
 	{
 		ARC_PROFILE_SCOPE()
 
 		m_Sound = CreateScope<ma_sound>();
 
-		const ma_result result = ma_sound_init_from_file(static_cast<ma_engine*>(AudioEngine::GetEngine()), filepath, MA_SOUND_FLAG_NO_SPATIALIZATION, nullptr, nullptr, m_Sound.get());
-		if (result != MA_SUCCESS)
-			ARC_CORE_ERROR("Failed to initialize sound: {}", filepath);
+		if (loadNow)
+		{
+			Decode();
+			FinishLoad();
+		}
 	}
 
 	AudioSource::~AudioSource()
 	{
 		ARC_PROFILE_SCOPE()
 
-		ma_sound_uninit(m_Sound.get());
+		if (m_Decoded)
+			ma_sound_uninit(m_Sound.get());
 		m_Sound = nullptr;
 	}
 
-	void AudioSource::Play() const
+	bool AudioSource::Decode()
+	{
+		ARC_PROFILE_SCOPE()
+
+		ARC_CORE_ASSERT(!m_Decoded, "Sound is already decoded!")
+
+		const ma_result result = ma_sound_init_from_file(static_cast<ma_engine*>(AudioEngine::GetEngine()), m_Path.c_str(), MA_SOUND_FLAG_DECODE | MA_SOUND_FLAG_NO_SPATIALIZATION, nullptr, nullptr, m_Sound.get());
+		if (result != MA_SUCCESS)
+		{
+			ARC_CORE_ERROR("Failed to initialize sound: {}", m_Path);
+			return false;
+		}
+
+		m_Decoded = true;
+		return true;
+	}
+
+	void AudioSource::FinishLoad()
+	{
+		ARC_PROFILE_SCOPE()
+
+		if (!m_Decoded || m_Loaded)
+			return;
+
+		m_Loaded = true;
+
+		if (m_PendingConfig)
+		{
+			SetConfig(*m_PendingConfig);
+			m_PendingConfig.reset();
+		}
+
+		if (m_PlayOnLoad)
+		{
+			m_PlayOnLoad = false;
+			Play();
+		}
+
+		if (m_PendingCursor)
+		{
+			SetCursor(*m_PendingCursor);
+			m_PendingCursor.reset();
+		}
+	}
+
+	void AudioSource::Play()
 	{
 		ARC_PROFILE_SCOPE()
 
+		if (!m_Loaded)
+		{
+			m_PlayOnLoad = true;
+			return;
+		}
+
 		ma_sound_seek_to_pcm_frame(m_Sound.get(), 0);
 		ma_sound_start(m_Sound.get());
 	}
 
-	void AudioSource::Pause() const
+	void AudioSource::Pause()
 	{
 		ARC_PROFILE_SCOPE()
 
-		ma_sound_stop(m_Sound.get());
+		m_PlayOnLoad = false;
+		ma_sound_stop(GetSound());
 	}
 
 	void AudioSource::UnPause() const
 	{
 		ARC_PROFILE_SCOPE()
 
-		ma_sound_start(m_Sound.get());
+		ma_sound_start(GetSound());
 	}
 
-	void AudioSource::Stop() const
+	void AudioSource::Stop()
 	{
 		ARC_PROFILE_SCOPE()
 
-		ma_sound_stop(m_Sound.get());
-		ma_sound_seek_to_pcm_frame(m_Sound.get(), 0);
+		m_PlayOnLoad = false;
+		ma_sound_stop(GetSound());
+		ma_sound_seek_to_pcm_frame(GetSound(), 0);
 	}
 
 	bool AudioSource::IsPlaying() const
 	{
 		ARC_PROFILE_SCOPE()
 
-		return ma_sound_is_playing(m_Sound.get());
+		return m_PlayOnLoad || ma_sound_is_playing(GetSound());
+	}
+
+	uint64_t AudioSource::GetCursor() const
+	{
+		ARC_PROFILE_SCOPE()
+
+		if (!m_Loaded)
+			return m_PendingCursor.value_or(0);
+
+		ma_uint64 cursor = 0;
+		ma_sound_get_cursor_in_pcm_frames(m_Sound.get(), &cursor);
+		return cursor;
+	}
+
+	void AudioSource::SetCursor(uint64_t frame)
+	{
+		ARC_PROFILE_SCOPE()
+
+		if (!m_Loaded)
+		{
+			m_PendingCursor = frame;
+			return;
+		}
+
+		ma_sound_seek_to_pcm_frame(m_Sound.get(), frame);
 	}
 
 	static ma_attenuation_model GetAttenuationModel(const AttenuationModelType model)
@@ -83,6 +164,12 @@ namespace ArcEngine
 	{
 		ARC_PROFILE_SCOPE()
 
+		if (!m_Loaded)
+		{
+			m_PendingConfig = config;
+			return;
+		}
+
 		ma_sound* sound = m_Sound.get();
 		ma_sound_set_volume(sound, config.VolumeMultiplier);
 		ma_sound_set_pitch(sound, config.PitchMultiplier);
@@ -116,21 +203,21 @@ namespace ArcEngine
 	{
 		ARC_PROFILE_SCOPE()
 
-		ma_sound_set_volume(m_Sound.get(), volume);
+		ma_sound_set_volume(GetSound(), volume);
 	}
 
 	void AudioSource::SetPitch(const float pitch) const
 	{
 		ARC_PROFILE_SCOPE()
 
-		ma_sound_set_pitch(m_Sound.get(), pitch);
+		ma_sound_set_pitch(GetSound(), pitch);
 	}
 
 	void AudioSource::SetLooping(const bool state) const
 	{
 		ARC_PROFILE_SCOPE()
 
-		ma_sound_set_looping(m_Sound.get(), state);
+		ma_sound_set_looping(GetSound(), state);
 	}
 
 	void AudioSource::SetSpatialization(const bool state)
@@ -138,7 +225,7 @@ namespace ArcEngine
 		ARC_PROFILE_SCOPE()
 
 		m_Spatialization = state;
-		ma_sound_set_spatialization_enabled(m_Sound.get(), state);
+		ma_sound_set_spatialization_enabled(GetSound(), state);
 	}
 
 	void AudioSource::SetAttenuationModel(const AttenuationModelType type) const
@@ -146,78 +233,78 @@ namespace ArcEngine
 		ARC_PROFILE_SCOPE()
 
 		if (m_Spatialization)
-			ma_sound_set_attenuation_model(m_Sound.get(), GetAttenuationModel(type));
+			ma_sound_set_attenuation_model(GetSound(), GetAttenuationModel(type));
 		else
-			ma_sound_set_attenuation_model(m_Sound.get(), GetAttenuationModel(AttenuationModelType::None));
+			ma_sound_set_attenuation_model(GetSound(), GetAttenuationModel(AttenuationModelType::None));
 	}
 
 	void AudioSource::SetRollOff(const float rollOff) const
 	{
 		ARC_PROFILE_SCOPE()
 
-		ma_sound_set_rolloff(m_Sound.get(), rollOff);
+		ma_sound_set_rolloff(GetSound(), rollOff);
 	}
 
 	void AudioSource::SetMinGain(const float minGain) const
 	{
 		ARC_PROFILE_SCOPE()
 
-		ma_sound_set_min_gain(m_Sound.get(), minGain);
+		ma_sound_set_min_gain(GetSound(), minGain);
 	}
 
 	void AudioSource::SetMaxGain(const float maxGain) const
 	{
 		ARC_PROFILE_SCOPE()
 
-		ma_sound_set_max_gain(m_Sound.get(), maxGain);
+		ma_sound_set_max_gain(GetSound(), maxGain);
 	}
 
 	void AudioSource::SetMinDistance(const float minDistance) const
 	{
 		ARC_PROFILE_SCOPE()
 
-		ma_sound_set_min_distance(m_Sound.get(), minDistance);
+		ma_sound_set_min_distance(GetSound(), minDistance);
 	}
 
 	void AudioSource::SetMaxDistance(const float maxDistance) const
 	{
 		ARC_PROFILE_SCOPE()
 
-		ma_sound_set_max_distance(m_Sound.get(), maxDistance);
+		ma_sound_set_max_distance(GetSound(), maxDistance);
 	}
 
 	void AudioSource::SetCone(const float innerAngle, const float outerAngle, const float outerGain) const
 	{
 		ARC_PROFILE_SCOPE()
 
-		ma_sound_set_cone(m_Sound.get(), innerAngle, outerAngle, outerGain);
+		ma_sound_set_cone(GetSound(), innerAngle, outerAngle, outerGain);
 	}
 
 	void AudioSource::SetDopplerFactor(const float factor) const
 	{
 		ARC_PROFILE_SCOPE()
 
-		ma_sound_set_doppler_factor(m_Sound.get(), glm::max(factor, 0.0f));
+		ma_sound_set_doppler_factor(GetSound(), glm::max(factor, 0.0f));
 	}
 
 	void AudioSource::SetPosition(const glm::vec3& position) const
 	{
 		ARC_PROFILE_SCOPE()
 
-		ma_sound_set_position(m_Sound.get(), position.x, position.y, position.z);
+		ma_sound_set_position(GetSound(), position.x, position.y, position.z);
 	}
 
 	void AudioSource::SetDirection(const glm::vec3& forward) const
 	{
 		ARC_PROFILE_SCOPE()
 
-		ma_sound_set_direction(m_Sound.get(), forward.x, forward.y, forward.z);
+		ma_sound_set_direction(GetSound(), forward.x, forward.y, forward.z);
 	}
 
 	void AudioSource::SetVelocity(const glm::vec3& velocity) const
 	{
 		ARC_PROFILE_SCOPE()
 
-		ma_sound_set_velocity(m_Sound.get(), velocity.x, velocity.y, velocity.z);
+		ma_sound_set_velocity(GetSound(), velocity.x, velocity.y, velocity.z);
 	}
 }
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <optional>
+
 struct ma_sound;
 
 namespace ArcEngine
@@ -37,20 +39,31 @@ namespace ArcEngine
 	class AudioSource
 	{
 	public:
-		explicit AudioSource(const char* filepath);
+		// With loadNow unset the file is not read until Decode(), which can run on any thread.
+		// Until FinishLoad() has run on the main thread, the source is silent and only remembers
+		// the last config and whether it should start playing.
+		explicit AudioSource(const char* filepath, bool loadNow = true);
 		~AudioSource();
 
 		AudioSource(const AudioSource& other) = delete;
 		AudioSource(AudioSource&& other) = delete;
 
 		[[nodiscard]] const char* GetPath() const { return m_Path.c_str(); }
+		[[nodiscard]] bool IsLoaded() const { return m_Loaded; }
+
+		bool Decode();
+		void FinishLoad();
 
-		void Play() const;
-		void Pause() const;
+		void Play();
+		void Pause();
 		void UnPause() const;
-		void Stop() const;
+		void Stop();
 		[[nodiscard]] bool IsPlaying() const;
 
+		// Playback position in PCM frames
+		[[nodiscard]] uint64_t GetCursor() const;
+		void SetCursor(uint64_t frame);
+
 		void SetConfig(const AudioSourceConfig& config);
 
 		void SetVolume(float volume) const;
@@ -70,9 +83,18 @@ namespace ArcEngine
 		void SetDirection(const glm::vec3& forward) const;
 		void SetVelocity(const glm::vec3& velocity) const;
 
+	private:
+		[[nodiscard]] ma_sound* GetSound() const { return m_Loaded ? m_Sound.get() : nullptr; }
+
 	private:
 		std::string m_Path;
 		Scope<ma_sound> m_Sound;
 		bool m_Spatialization = false;
+
+		bool m_Decoded = false;
+		bool m_Loaded = false;
+		bool m_PlayOnLoad = false;
+		std::optional<AudioSourceConfig> m_PendingConfig;
+		std::optional<uint64_t> m_PendingCursor;
 	};
 }
@@ -2,6 +2,8 @@
 #include "Arc/Core/Application.h"
 
 #include "Arc/Audio/AudioEngine.h"
+#include "Arc/Core/AssetManager.h"
+#include "Arc/Core/JobSystem.h"
 #include "Arc/Renderer/Renderer.h"
 #include "Arc/Scripting/ScriptEngine.h"
 
@@ -28,8 +30,10 @@ namespace ArcEngine
 		m_Window = Window::Create(WindowProps(name));
 		m_Window->SetEventCallBack(ARC_BIND_EVENT_FN(Application::OnEvent));
 
+		JobSystem::Init();
 		Renderer::Init();
 		AudioEngine::Init();
+		AssetManager::Init();
 		ScriptEngine::Init();
 
 		m_LayerStack = new LayerStack();
@@ -46,8 +50,10 @@ namespace ArcEngine
 		delete m_LayerStack;
 
 		ScriptEngine::Shutdown();
+		AssetManager::Shutdown();
 		AudioEngine::Shutdown();
 		Renderer::Shutdown();
+		JobSystem::Shutdown();
 
 		OPTICK_SHUTDOWN()
 	}
@@ -63,6 +69,11 @@ namespace ArcEngine
 	{
 		return  Allocation::GetSize();
 	}
+
+	uint64_t Application::GetAllocationCount()
+	{
+		return Allocation::GetCount();
+	}
 	
 	void Application::OnEvent(Event& e)
 	{
@@ -91,6 +102,7 @@ namespace ArcEngine
 			const Timestep timestep = time - m_LastFrameTime;
 			m_LastFrameTime = time;
 
+			JobSystem::ResetStatistics();
 			ExecuteMainThreadQueue();
 
 			if(!m_Minimized)
@@ -118,9 +130,7 @@ namespace ArcEngine
 
 	void Application::SubmitToMainThread(const std::function<void()>& function)
 	{
-		std::scoped_lock<std::mutex> lock(m_MainThreadQueueMutex);
-
-		m_MainThreadQueue.emplace_back(function);
+		m_MainThreadQueue.Push(function);
 	}
 
 	bool Application::OnWindowClose([[maybe_unused]] const WindowCloseEvent& e)
@@ -149,11 +159,25 @@ namespace ArcEngine
 
 	void Application::ExecuteMainThreadQueue()
 	{
-		std::scoped_lock<std::mutex> lock(m_MainThreadQueueMutex);
+		ARC_PROFILE_SCOPE()
 
-		for (const auto& func : m_MainThreadQueue)
+		// Only run what was queued before this frame, functions queued from inside the loop wait for the next one
+		size_t remaining = m_MainThreadQueue.GetSize();
+		if (remaining == 0)
+			return;
+
+		const auto begin = std::chrono::steady_clock::now();
+		const std::chrono::duration<float, std::milli> budget(m_MainThreadQueueBudget);
+
+		std::function<void()> func;
+		while (remaining > 0 && m_MainThreadQueue.TryPop(func))
+		{
 			func();
+			--remaining;
 
-		m_MainThreadQueue.clear();
+			// At least one function runs every frame, so the queue keeps moving even with a tiny budget
+			if (m_MainThreadQueueBudget > 0.0f && std::chrono::steady_clock::now() - begin >= budget)
+				break;
+		}
 	}
 }
@@ -1,7 +1,5 @@
 #pragma once
 
-#include <mutex>
-
 #include "Arc/Core/Base.h"
 
 #include "Arc/Core/Window.h"
@@ -9,6 +7,7 @@
 #include "Arc/Events/ApplicationEvent.h"
 
 #include "Arc/ImGui/ImGuiLayer.h"
+#include "Arc/Utils/MPSCQueue.h"
 
 int main(int argc, char** argv);
 
@@ -37,10 +36,17 @@ namespace ArcEngine
 		[[nodiscard]] ImGuiLayer* GetImGuiLayer() const { return m_ImGuiLayer; }
 
 		[[nodiscard]] static size_t GetAllocatedMemorySize();
+		[[nodiscard]] static uint64_t GetAllocationCount();
 		[[nodiscard]] static Application& Get() { return *s_Instance; }
 		
+		// Can be called from any thread, the function runs at the start of a later frame
 		void SubmitToMainThread(const std::function<void()>& function);
 
+		// Time in milliseconds the main thread queue may take every frame, 0 runs everything that is queued
+		void SetMainThreadQueueBudget(float milliseconds) { m_MainThreadQueueBudget = milliseconds; }
+		[[nodiscard]] float GetMainThreadQueueBudget() const { return m_MainThreadQueueBudget; }
+		[[nodiscard]] size_t GetMainThreadQueueSize() const { return m_MainThreadQueue.GetSize(); }
+
 	private:
 		void Run();
 		[[nodiscard]] bool OnWindowClose([[maybe_unused]] const WindowCloseEvent& e);
@@ -54,8 +60,8 @@ namespace ArcEngine
 		LayerStack* m_LayerStack;
 		float m_LastFrameTime = 0.0f;
 
-		std::vector<std::function<void()>> m_MainThreadQueue;
-		std::mutex m_MainThreadQueueMutex;
+		MPSCQueue<std::function<void()>> m_MainThreadQueue;
+		float m_MainThreadQueueBudget = 4.0f;
 
 	private:
 		static Application* s_Instance;
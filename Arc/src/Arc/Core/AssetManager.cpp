@@ -3,105 +3,252 @@
 
 #include <stb_image.h>
 
-#include "Arc/Core/Application.h"
+#include "Arc/Audio/AudioSource.h"
 #include "Arc/Renderer/Mesh.h"
 #include "Arc/Renderer/Texture.h"
 #include "Arc/Utils/StringUtils.h"
 
 namespace ArcEngine
 {
+	static constexpr uint32_t s_MaxWorkerThreads = 4;
+	static constexpr uint32_t s_MaxPendingUploads = 32;
+
 	inline static std::unordered_map<std::string, Ref<Texture2D>, UM_StringTransparentEquality> m_Texture2DMap;
 	inline static std::unordered_map<std::string, Ref<TextureCubemap>, UM_StringTransparentEquality> m_TextureCubeMap;
 	inline static std::unordered_map<std::string, Ref<Mesh>, UM_StringTransparentEquality> m_MeshMap;
-	inline static std::vector<std::future<void>> m_Futures;
+
+	// Loads that have not been uploaded yet, keyed by the asset they fill in. Only touched on the main thread.
+	inline static std::unordered_map<const void*, AssetLoadHandle> m_PendingLoads;
+	inline static AssetWorkerPool m_WorkerPool;
 
 	void AssetManager::Init()
 	{
 		ARC_PROFILE_SCOPE()
 
-		/* Init stuff here */
+		const uint32_t threadCount = std::clamp(std::thread::hardware_concurrency() / 2, 1u, s_MaxWorkerThreads);
+		m_WorkerPool.Init(threadCount, s_MaxPendingUploads);
 	}
 
 	void AssetManager::Shutdown()
 	{
 		ARC_PROFILE_SCOPE()
 
+		for (const auto& [asset, handle] : m_PendingLoads)
+			handle.Cancel();
+		m_WorkerPool.Shutdown();
+
+		m_PendingLoads.clear();
 		m_Texture2DMap.clear();
 		m_TextureCubeMap.clear();
 		m_MeshMap.clear();
-		m_Futures.clear();
 	}
 
-	static void LoadTexture2D(Texture2D* tex, const std::string_view path)
+	static bool IsLoadPending(const void* asset)
 	{
-		ARC_PROFILE_THREAD("IO Thread")
+		return m_PendingLoads.contains(asset);
+	}
 
-		stbi_set_flip_vertically_on_load(1);
-		int width, height, channels;
-		stbi_uc* data = nullptr;
-		{
-			ARC_PROFILE_SCOPE("stbi_load Texture")
+	static void CancelLoad(const void* asset)
+	{
+		const auto it = m_PendingLoads.find(asset);
+		if (it == m_PendingLoads.end())
+			return;
 
-			data = stbi_load(path.data(), &width, &height, &channels, 0);
-		}
-		ARC_CORE_ASSERT(data, "Failed to load image!")
-		Application::Get().SubmitToMainThread([tex, path, width, height, data, channels]() { tex->Invalidate(path, width, height, data, channels); stbi_image_free(data); });
+		it->second.Cancel();
+		m_PendingLoads.erase(it);
+	}
+
+	static void CompleteLoad(const void* asset, const AssetLoadHandle& handle)
+	{
+		const auto it = m_PendingLoads.find(asset);
+		if (it != m_PendingLoads.end() && it->second == handle)
+			m_PendingLoads.erase(it);
+	}
+
+	// Loads that ran inline have already completed, tracking them would leave them pending forever
+	static void TrackLoad(const void* asset, bool ranInline, const AssetLoadHandle& handle)
+	{
+		if (!ranInline)
+			m_PendingLoads[asset] = handle;
 	}
 
-	Ref<Texture2D>& AssetManager::GetTexture2D(const std::string& path)
+	static void LoadTexture2D(const Ref<Texture2D>& texture, const std::string& path, AssetLoadPriority priority)
+	{
+		ARC_PROFILE_SCOPE()
+
+		bool ranInline = false;
+		const AssetLoadHandle handle = m_WorkerPool.Submit(priority, [texture, path](const AssetLoadHandle& loadHandle)
+		{
+			stbi_set_flip_vertically_on_load(1);
+			int width, height, channels;
+			stbi_uc* data = nullptr;
+			{
+				ARC_PROFILE_SCOPE("stbi_load Texture")
+
+				data = stbi_load(path.c_str(), &width, &height, &channels, 0);
+			}
+			if (!data)
+				ARC_CORE_ERROR("Failed to load image: {}", path);
+
+			const Ref<stbi_uc> pixels(data, stbi_image_free);
+			m_WorkerPool.SubmitUpload(loadHandle, [texture, path, width, height, pixels, channels, loadHandle]()
+			{
+				if (pixels)
+					texture->Invalidate(path, width, height, pixels.get(), channels);
+				CompleteLoad(texture.get(), loadHandle);
+			});
+		}, &ranInline);
+		TrackLoad(texture.get(), ranInline, handle);
+	}
+
+	Ref<Texture2D>& AssetManager::GetTexture2D(const std::string& path, AssetLoadPriority priority)
 	{
 		ARC_PROFILE_SCOPE()
 
 		const auto& it = m_Texture2DMap.find(path);
 		if (it != m_Texture2DMap.end())
+		{
+			if (priority == AssetLoadPriority::Immediate && IsLoadPending(it->second.get()))
+			{
+				CancelLoad(it->second.get());
+				LoadTexture2D(it->second, path, priority);
+			}
 			return it->second;
+		}
 
-		Ref<Texture2D> texture = Texture2D::Create();
-		m_Texture2DMap.emplace(path, texture);
-		m_Futures.push_back(std::async(std::launch::async, &LoadTexture2D, texture.get(), path));
-		return m_Texture2DMap[path];
+		Ref<Texture2D>& texture = m_Texture2DMap.emplace(path, Texture2D::Create()).first->second;
+		LoadTexture2D(texture, path, priority);
+		return texture;
 	}
 
-	static void LoadTextureCubemap(TextureCubemap* tex, const std::string_view path)
+	static void LoadTextureCubemap(const Ref<TextureCubemap>& texture, const std::string& path, AssetLoadPriority priority)
 	{
-		ARC_PROFILE_THREAD("IO Thread")
+		ARC_PROFILE_SCOPE()
 
-		stbi_set_flip_vertically_on_load(1);
-		int width, height, channels;
-		float* data = nullptr;
+		bool ranInline = false;
+		const AssetLoadHandle handle = m_WorkerPool.Submit(priority, [texture, path](const AssetLoadHandle& loadHandle)
 		{
-			ARC_PROFILE_SCOPE("stbi_load Texture")
-
-			data = stbi_loadf(path.data(), &width, &height, &channels, 0);
-		}
-		ARC_CORE_ASSERT(data, "Failed to load image!")
-		Application::Get().SubmitToMainThread([tex, path, width, height, data, channels]() { tex->Invalidate(path, width, height, data, channels); stbi_image_free(data); });
+			stbi_set_flip_vertically_on_load(1);
+			int width, height, channels;
+			float* data = nullptr;
+			{
+				ARC_PROFILE_SCOPE("stbi_load Texture")
+
+				data = stbi_loadf(path.c_str(), &width, &height, &channels, 0);
+			}
+			if (!data)
+				ARC_CORE_ERROR("Failed to load image: {}", path);
+
+			const Ref<float> pixels(data, stbi_image_free);
+			m_WorkerPool.SubmitUpload(loadHandle, [texture, path, width, height, pixels, channels, loadHandle]()
+			{
+				if (pixels)
+					texture->Invalidate(path, width, height, pixels.get(), channels);
+				CompleteLoad(texture.get(), loadHandle);
+			});
+		}, &ranInline);
+		TrackLoad(texture.get(), ranInline, handle);
 	}
 
-	Ref<TextureCubemap>& AssetManager::GetTextureCubemap(const std::string& path)
+	Ref<TextureCubemap>& AssetManager::GetTextureCubemap(const std::string& path, AssetLoadPriority priority)
 	{
 		ARC_PROFILE_SCOPE()
 
 		const auto& it = m_TextureCubeMap.find(path);
 		if (it != m_TextureCubeMap.end())
+		{
+			if (priority == AssetLoadPriority::Immediate && IsLoadPending(it->second.get()))
+			{
+				CancelLoad(it->second.get());
+				LoadTextureCubemap(it->second, path, priority);
+			}
 			return it->second;
+		}
 
-		Ref<TextureCubemap> texture = TextureCubemap::Create();
-		m_TextureCubeMap.emplace(path, texture);
-		m_Futures.push_back(std::async(std::launch::async, &LoadTextureCubemap, texture.get(), path));
-		return m_TextureCubeMap[path];
+		Ref<TextureCubemap>& texture = m_TextureCubeMap.emplace(path, TextureCubemap::Create()).first->second;
+		LoadTextureCubemap(texture, path, priority);
+		return texture;
 	}
 
-	Ref<Mesh>& AssetManager::GetMesh(const std::string& path)
+	static void LoadMesh(const Ref<Mesh>& mesh, const std::string& path, AssetLoadPriority priority)
+	{
+		ARC_PROFILE_SCOPE()
+
+		bool ranInline = false;
+		const AssetLoadHandle handle = m_WorkerPool.Submit(priority, [mesh, path](const AssetLoadHandle& loadHandle)
+		{
+			const Ref<MeshSource> source = Mesh::Decode(path.c_str());
+			m_WorkerPool.SubmitUpload(loadHandle, [mesh, source, loadHandle]()
+			{
+				if (source)
+					mesh->Upload(*source);
+				CompleteLoad(mesh.get(), loadHandle);
+			});
+		}, &ranInline);
+		TrackLoad(mesh.get(), ranInline, handle);
+	}
+
+	Ref<Mesh>& AssetManager::GetMesh(const std::string& path, AssetLoadPriority priority)
 	{
 		ARC_PROFILE_SCOPE()
 
 		const auto& it = m_MeshMap.find(path);
 		if (it != m_MeshMap.end())
+		{
+			if (priority == AssetLoadPriority::Immediate && IsLoadPending(it->second.get()))
+			{
+				CancelLoad(it->second.get());
+				LoadMesh(it->second, path, priority);
+			}
 			return it->second;
+		}
+
+		Ref<Mesh>& mesh = m_MeshMap.emplace(path, CreateRef<Mesh>()).first->second;
+		LoadMesh(mesh, path, priority);
+		return mesh;
+	}
+
+	Ref<AudioSource> AssetManager::LoadAudioSource(const std::string& path, AssetLoadPriority priority)
+	{
+		ARC_PROFILE_SCOPE()
 
-		Ref<Mesh> mesh = CreateRef<Mesh>(path.c_str());
-		m_MeshMap.emplace(path, mesh);
-		return m_MeshMap[path];
+		Ref<AudioSource> audioSource = CreateRef<AudioSource>(path.c_str(), false);
+		bool ranInline = false;
+		const AssetLoadHandle handle = m_WorkerPool.Submit(priority, [audioSource](const AssetLoadHandle& loadHandle)
+		{
+			audioSource->Decode();
+			m_WorkerPool.SubmitUpload(loadHandle, [audioSource, loadHandle]()
+			{
+				audioSource->FinishLoad();
+				CompleteLoad(audioSource.get(), loadHandle);
+			});
+		}, &ranInline);
+		TrackLoad(audioSource.get(), ranInline, handle);
+
+		return audioSource;
+	}
+
+	bool AssetManager::IsLoading(const void* asset)
+	{
+		return IsLoadPending(asset);
+	}
+
+	void AssetManager::CancelPendingLoads()
+	{
+		ARC_PROFILE_SCOPE()
+
+		m_WorkerPool.CancelAll();
+		for (const auto& [asset, handle] : m_PendingLoads)
+			handle.Cancel();
+
+		std::erase_if(m_Texture2DMap, [](const auto& entry) { return IsLoadPending(entry.second.get()); });
+		std::erase_if(m_TextureCubeMap, [](const auto& entry) { return IsLoadPending(entry.second.get()); });
+		std::erase_if(m_MeshMap, [](const auto& entry) { return IsLoadPending(entry.second.get()); });
+		m_PendingLoads.clear();
+	}
+
+	AssetWorkerPool& AssetManager::GetWorkerPool()
+	{
+		return m_WorkerPool;
 	}
 }
@@ -1,7 +1,10 @@
 #pragma once
 
+#include "Arc/Core/AssetWorkerPool.h"
+
 namespace ArcEngine
 {
+	class AudioSource;
 	class Mesh;
 	class TextureCubemap;
 	class Texture2D;
@@ -12,8 +15,21 @@ namespace ArcEngine
 		static void Init();
 		static void Shutdown();
 
-		[[nodiscard]] static Ref<Texture2D>& GetTexture2D(const std::string& path);
-		[[nodiscard]] static Ref<TextureCubemap>& GetTextureCubemap(const std::string& path);
-		[[nodiscard]] static Ref<Mesh>& GetMesh(const std::string& path);
+		// Assets are returned right away and filled in on the main thread once the workers have decoded them.
+		// Asking for an asset that is still loading with AssetLoadPriority::Immediate finishes it before returning.
+		[[nodiscard]] static Ref<Texture2D>& GetTexture2D(const std::string& path, AssetLoadPriority priority = AssetLoadPriority::Normal);
+		[[nodiscard]] static Ref<TextureCubemap>& GetTextureCubemap(const std::string& path, AssetLoadPriority priority = AssetLoadPriority::Normal);
+		[[nodiscard]] static Ref<Mesh>& GetMesh(const std::string& path, AssetLoadPriority priority = AssetLoadPriority::Normal);
+
+		// Audio sources are not shared, every call creates a new one
+		[[nodiscard]] static Ref<AudioSource> LoadAudioSource(const std::string& path, AssetLoadPriority priority = AssetLoadPriority::Normal);
+
+		// True from the request until the asset has been uploaded, failed or was cancelled
+		[[nodiscard]] static bool IsLoading(const void* asset);
+
+		// Cancels every load that has not been uploaded yet and forgets the assets, so asking for them again starts a new load
+		static void CancelPendingLoads();
+
+		[[nodiscard]] static AssetWorkerPool& GetWorkerPool();
 	};
 }
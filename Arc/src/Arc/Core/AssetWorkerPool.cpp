@@ -0,0 +1,191 @@
+#include "arcpch.h"
+#include "Arc/Core/AssetWorkerPool.h"
+
+#include "Arc/Core/Application.h"
+
+namespace ArcEngine
+{
+	static thread_local bool s_IsWorkerThread = false;
+
+	void AssetLoadHandle::Cancel() const
+	{
+		if (m_Cancelled)
+			m_Cancelled->store(true, std::memory_order_relaxed);
+	}
+
+	bool AssetLoadHandle::IsCancelled() const
+	{
+		return m_Cancelled && m_Cancelled->load(std::memory_order_relaxed);
+	}
+
+	AssetWorkerPool::~AssetWorkerPool()
+	{
+		Shutdown();
+	}
+
+	void AssetWorkerPool::Init(uint32_t threadCount, uint32_t maxPendingUploads)
+	{
+		ARC_PROFILE_SCOPE()
+
+		ARC_CORE_ASSERT(m_Threads.empty(), "Asset worker pool is already running!")
+		ARC_CORE_ASSERT(threadCount > 0 && maxPendingUploads > 0)
+
+		m_Running = true;
+		m_PendingUploads = 0;
+		m_MaxPendingUploads = maxPendingUploads;
+
+		m_Threads.reserve(threadCount);
+		for (uint32_t i = 0; i < threadCount; ++i)
+			m_Threads.emplace_back(&AssetWorkerPool::WorkerLoop, this);
+	}
+
+	void AssetWorkerPool::Shutdown()
+	{
+		ARC_PROFILE_SCOPE()
+
+		{
+			std::scoped_lock lock(m_Mutex);
+			if (!m_Running)
+				return;
+
+			m_Running = false;
+			for (std::deque<Job>& queue : m_Queues)
+			{
+				for (const Job& job : queue)
+					job.Handle.Cancel();
+				queue.clear();
+			}
+		}
+		m_Condition.notify_all();
+
+		for (std::thread& thread : m_Threads)
+			thread.join();
+		m_Threads.clear();
+	}
+
+	AssetLoadHandle AssetWorkerPool::Submit(AssetLoadPriority priority, const Task& task, bool* outRanInline)
+	{
+		ARC_PROFILE_SCOPE()
+
+		AssetLoadHandle handle;
+		handle.m_Cancelled = CreateRef<std::atomic<bool>>(false);
+
+		const bool runInline = priority == AssetLoadPriority::Immediate || m_Threads.empty();
+		if (outRanInline)
+			*outRanInline = runInline;
+
+		if (runInline)
+		{
+			task(handle);
+			return handle;
+		}
+
+		{
+			std::scoped_lock lock(m_Mutex);
+			m_Queues[static_cast<size_t>(priority) - 1].push_back({ task, handle });
+		}
+		m_Condition.notify_one();
+
+		return handle;
+	}
+
+	void AssetWorkerPool::SubmitUpload(const AssetLoadHandle& handle, const UploadTask& upload)
+	{
+		ARC_PROFILE_SCOPE()
+
+		// Loads that ran on the main thread can upload right away
+		if (!s_IsWorkerThread)
+		{
+			if (!handle.IsCancelled())
+				upload();
+			return;
+		}
+
+		{
+			std::scoped_lock lock(m_Mutex);
+			++m_PendingUploads;
+		}
+
+		Application::Get().SubmitToMainThread([this, handle, upload]()
+		{
+			if (!handle.IsCancelled())
+				upload();
+			OnUploadFinished();
+		});
+	}
+
+	void AssetWorkerPool::CancelAll()
+	{
+		ARC_PROFILE_SCOPE()
+
+		std::scoped_lock lock(m_Mutex);
+		for (std::deque<Job>& queue : m_Queues)
+		{
+			for (const Job& job : queue)
+				job.Handle.Cancel();
+			queue.clear();
+		}
+	}
+
+	size_t AssetWorkerPool::GetQueuedCount() const
+	{
+		std::scoped_lock lock(m_Mutex);
+
+		size_t count = 0;
+		for (const std::deque<Job>& queue : m_Queues)
+			count += queue.size();
+		return count;
+	}
+
+	uint32_t AssetWorkerPool::GetPendingUploadCount() const
+	{
+		std::scoped_lock lock(m_Mutex);
+
+		return m_PendingUploads;
+	}
+
+	void AssetWorkerPool::WorkerLoop()
+	{
+		ARC_PROFILE_THREAD("IO Thread")
+
+		s_IsWorkerThread = true;
+
+		while (true)
+		{
+			Job job;
+			{
+				std::unique_lock lock(m_Mutex);
+				m_Condition.wait(lock, [this]() { return !m_Running || (m_PendingUploads < m_MaxPendingUploads && HasQueuedJobs()); });
+				if (!m_Running)
+					return;
+
+				for (std::deque<Job>& queue : m_Queues)
+				{
+					if (!queue.empty())
+					{
+						job = std::move(queue.front());
+						queue.pop_front();
+						break;
+					}
+				}
+			}
+
+			if (!job.Handle.IsCancelled())
+				job.Function(job.Handle);
+		}
+	}
+
+	void AssetWorkerPool::OnUploadFinished()
+	{
+		{
+			std::scoped_lock lock(m_Mutex);
+			--m_PendingUploads;
+		}
+		m_Condition.notify_one();
+	}
+
+	bool AssetWorkerPool::HasQueuedJobs() const
+	{
+		return std::ranges::any_of(m_Queues, [](const std::deque<Job>& queue) { return !queue.empty(); });
+	}
+}
@@ -0,0 +1,92 @@
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+namespace ArcEngine
+{
+	enum class AssetLoadPriority : uint8_t
+	{
+		Immediate = 0,		// Loaded on the calling thread before returning
+		High,
+		Normal,
+		Low
+	};
+
+	// Shared by a queued load and everyone that may want to cancel it.
+	// A cancelled load is dropped before it starts, or its upload is skipped if it already ran.
+	class AssetLoadHandle
+	{
+	public:
+		void Cancel() const;
+		[[nodiscard]] bool IsCancelled() const;
+		[[nodiscard]] bool IsValid() const { return m_Cancelled != nullptr; }
+
+		bool operator==(const AssetLoadHandle& other) const = default;
+
+	private:
+		friend class AssetWorkerPool;
+
+		Ref<std::atomic<bool>> m_Cancelled;
+	};
+
+	// Fixed set of threads doing file reads and decoding for the asset manager.
+	// Workers take queued loads in priority order, and stop taking new ones while too many
+	// decoded assets are still waiting for their upload on the main thread.
+	class AssetWorkerPool
+	{
+	public:
+		using Task = std::function<void(const AssetLoadHandle&)>;
+		using UploadTask = std::function<void()>;
+
+		AssetWorkerPool() = default;
+		~AssetWorkerPool();
+
+		AssetWorkerPool(const AssetWorkerPool& other) = delete;
+		AssetWorkerPool(AssetWorkerPool&& other) = delete;
+
+		void Init(uint32_t threadCount, uint32_t maxPendingUploads);
+
+		// Drops every queued load and waits for the running ones to finish
+		void Shutdown();
+
+		// Immediate loads, and every load when there are no worker threads, run on the calling thread.
+		// outRanInline is set when the task has already run by the time Submit returns.
+		AssetLoadHandle Submit(AssetLoadPriority priority, const Task& task, bool* outRanInline = nullptr);
+
+		// Hands decoded data over to the main thread, the upload is skipped if the load has been cancelled
+		void SubmitUpload(const AssetLoadHandle& handle, const UploadTask& upload);
+
+		void CancelAll();
+
+		[[nodiscard]] uint32_t GetThreadCount() const { return static_cast<uint32_t>(m_Threads.size()); }
+		[[nodiscard]] size_t GetQueuedCount() const;
+		[[nodiscard]] uint32_t GetPendingUploadCount() const;
+
+	private:
+		struct Job
+		{
+			Task Function;
+			AssetLoadHandle Handle;
+		};
+
+		// Number of queues, one per priority that goes through the workers
+		static constexpr size_t QueueCount = 3;
+
+		void WorkerLoop();
+		void OnUploadFinished();
+		[[nodiscard]] bool HasQueuedJobs() const;
+
+	private:
+		std::vector<std::thread> m_Threads;
+		std::array<std::deque<Job>, QueueCount> m_Queues;
+
+		mutable std::mutex m_Mutex;
+		std::condition_variable m_Condition;
+		uint32_t m_PendingUploads = 0;
+		uint32_t m_MaxPendingUploads = 0;
+		bool m_Running = false;
+	};
+}
@@ -67,4 +67,33 @@ namespace ArcEngine
 		stream << buffer.c_str();
 		stream.close();
 	}
+
+	// Writes to a temporary file first so readers never see a partially written file
+	bool Filesystem::WriteFileBinary(const std::filesystem::path& filepath, const void* data, uint64_t size)
+	{
+		ARC_PROFILE_SCOPE()
+
+		std::filesystem::path tempPath = filepath;
+		tempPath += ".tmp";
+
+		{
+			std::ofstream stream(tempPath, std::ios::out | std::ios::binary | std::ios::trunc);
+			if (!stream)
+				return false;
+
+			stream.write(static_cast<const char*>(data), static_cast<std::streamsize>(size));
+			if (!stream)
+				return false;
+		}
+
+		std::error_code error;
+		std::filesystem::rename(tempPath, filepath, error);
+		if (error)
+		{
+			std::filesystem::remove(tempPath, error);
+			return false;
+		}
+
+		return true;
+	}
 }
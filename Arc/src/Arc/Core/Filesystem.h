@@ -11,5 +11,6 @@ namespace ArcEngine
 		[[nodiscard]] static Buffer ReadFileBinary(const std::filesystem::path& filepath);
 		[[nodiscard]] static std::string ReadFileText(const std::filesystem::path& filepath);
 		static void WriteFileText(const std::filesystem::path& filepath, const std::string& buffer);
+		static bool WriteFileBinary(const std::filesystem::path& filepath, const void* data, uint64_t size);
 	};
 }
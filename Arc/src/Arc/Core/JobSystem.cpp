@@ -0,0 +1,202 @@
+#include "arcpch.h"
+#include "Arc/Core/JobSystem.h"
+
+#include <condition_variable>
+#include <deque>
+#include <thread>
+
+namespace ArcEngine
+{
+	struct QueuedJob
+	{
+		JobSystem::JobFunction Function;
+		JobCounter* Counter = nullptr;
+	};
+
+	struct JobSystemData
+	{
+		std::vector<std::thread> Workers;
+		std::deque<QueuedJob> Queue;
+		bool Running = false;
+
+		std::mutex Mutex;
+		std::condition_variable WorkAvailable;
+		std::condition_variable JobFinished;
+
+		// Waiters only sleep when the queue is empty, they need a wake up when new work arrives
+		std::atomic<uint32_t> SleepingWaiters = 0;
+
+		std::atomic<uint64_t> JobCount = 0;
+		std::atomic<uint64_t> WaitTime = 0;		// Nanoseconds
+		std::atomic<uint64_t> IdleTime = 0;		// Nanoseconds
+	};
+
+	static JobSystemData s_Data;
+	static thread_local bool s_IsWorkerThread = false;
+
+	static uint64_t GetElapsedNanoseconds(std::chrono::steady_clock::time_point begin)
+	{
+		return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - begin).count());
+	}
+
+	void JobSystem::Execute(const JobFunction& job, JobCounter* counter)
+	{
+		job();
+		s_Data.JobCount.fetch_add(1, std::memory_order_relaxed);
+
+		if (counter && counter->m_Pending.fetch_sub(1, std::memory_order_acq_rel) == 1)
+		{
+			// Taking the lock makes sure a waiter is either still checking its counter or already asleep
+			{
+				std::scoped_lock lock(s_Data.Mutex);
+			}
+			s_Data.JobFinished.notify_all();
+		}
+	}
+
+	void JobSystem::Init(uint32_t workerCount)
+	{
+		ARC_PROFILE_SCOPE()
+
+		ARC_CORE_ASSERT(s_Data.Workers.empty(), "Job system is already running!")
+
+		if (workerCount == 0)
+			workerCount = glm::max(std::thread::hardware_concurrency(), 2u) - 1;
+
+		s_Data.Running = true;
+		s_Data.Workers.reserve(workerCount);
+		for (uint32_t i = 0; i < workerCount; ++i)
+			s_Data.Workers.emplace_back(&JobSystem::WorkerLoop);
+
+		ARC_CORE_INFO("Job system started with {} workers", workerCount);
+	}
+
+	void JobSystem::Shutdown()
+	{
+		ARC_PROFILE_SCOPE()
+
+		{
+			std::scoped_lock lock(s_Data.Mutex);
+			s_Data.Running = false;
+		}
+		s_Data.WorkAvailable.notify_all();
+
+		// Workers finish whatever is still queued before they exit
+		for (std::thread& worker : s_Data.Workers)
+			worker.join();
+		s_Data.Workers.clear();
+	}
+
+	void JobSystem::Submit(const JobFunction& job, JobCounter* counter)
+	{
+		// Without workers the job runs right away, which keeps tools that never start the job system working
+		if (s_Data.Workers.empty())
+		{
+			Execute(job, nullptr);
+			return;
+		}
+
+		if (counter)
+			counter->m_Pending.fetch_add(1, std::memory_order_relaxed);
+
+		{
+			std::scoped_lock lock(s_Data.Mutex);
+			s_Data.Queue.push_back({ job, counter });
+		}
+		s_Data.WorkAvailable.notify_one();
+
+		if (s_Data.SleepingWaiters.load(std::memory_order_relaxed) != 0)
+			s_Data.JobFinished.notify_all();
+	}
+
+	void JobSystem::Wait(JobCounter& counter)
+	{
+		ARC_PROFILE_SCOPE()
+
+		while (!counter.IsDone())
+		{
+			if (TryExecuteJob())
+				continue;
+
+			const auto begin = std::chrono::steady_clock::now();
+			{
+				std::unique_lock lock(s_Data.Mutex);
+				s_Data.SleepingWaiters.fetch_add(1, std::memory_order_relaxed);
+				s_Data.JobFinished.wait(lock, [&counter]() { return counter.IsDone() || !s_Data.Queue.empty(); });
+				s_Data.SleepingWaiters.fetch_sub(1, std::memory_order_relaxed);
+			}
+			s_Data.WaitTime.fetch_add(GetElapsedNanoseconds(begin), std::memory_order_relaxed);
+		}
+	}
+
+	bool JobSystem::TryExecuteJob()
+	{
+		QueuedJob job;
+		{
+			std::scoped_lock lock(s_Data.Mutex);
+			if (s_Data.Queue.empty())
+				return false;
+
+			job = std::move(s_Data.Queue.front());
+			s_Data.Queue.pop_front();
+		}
+
+		Execute(job.Function, job.Counter);
+		return true;
+	}
+
+	void JobSystem::WorkerLoop()
+	{
+		ARC_PROFILE_THREAD("Job Worker")
+
+		s_IsWorkerThread = true;
+
+		while (true)
+		{
+			QueuedJob job;
+			{
+				std::unique_lock lock(s_Data.Mutex);
+				if (s_Data.Queue.empty() && s_Data.Running)
+				{
+					const auto begin = std::chrono::steady_clock::now();
+					s_Data.WorkAvailable.wait(lock, []() { return !s_Data.Running || !s_Data.Queue.empty(); });
+					s_Data.IdleTime.fetch_add(GetElapsedNanoseconds(begin), std::memory_order_relaxed);
+				}
+
+				if (s_Data.Queue.empty())
+					return;
+
+				job = std::move(s_Data.Queue.front());
+				s_Data.Queue.pop_front();
+			}
+
+			Execute(job.Function, job.Counter);
+		}
+	}
+
+	uint32_t JobSystem::GetWorkerCount()
+	{
+		return static_cast<uint32_t>(s_Data.Workers.size());
+	}
+
+	bool JobSystem::IsWorkerThread()
+	{
+		return s_IsWorkerThread;
+	}
+
+	JobSystem::Statistics JobSystem::GetStatistics()
+	{
+		Statistics stats;
+		stats.JobCount = s_Data.JobCount.load(std::memory_order_relaxed);
+		stats.WaitTime = static_cast<float>(s_Data.WaitTime.load(std::memory_order_relaxed)) * 1e-6f;
+		stats.IdleTime = static_cast<float>(s_Data.IdleTime.load(std::memory_order_relaxed)) * 1e-6f;
+		return stats;
+	}
+
+	void JobSystem::ResetStatistics()
+	{
+		s_Data.JobCount.store(0, std::memory_order_relaxed);
+		s_Data.WaitTime.store(0, std::memory_order_relaxed);
+		s_Data.IdleTime.store(0, std::memory_order_relaxed);
+	}
+}
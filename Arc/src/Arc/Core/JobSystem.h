@@ -0,0 +1,85 @@
+#pragma once
+
+#include <atomic>
+
+namespace ArcEngine
+{
+	// Tracks a group of submitted jobs so that they can be waited on together
+	class JobCounter
+	{
+	public:
+		JobCounter() = default;
+		JobCounter(const JobCounter& other) = delete;
+		JobCounter(JobCounter&& other) = delete;
+
+		[[nodiscard]] bool IsDone() const { return m_Pending.load(std::memory_order_acquire) == 0; }
+
+	private:
+		friend class JobSystem;
+
+		std::atomic<uint32_t> m_Pending = 0;
+	};
+
+	// Engine wide pool of worker threads, created once by the application.
+	// Threads that wait on a counter run queued jobs instead of sleeping, so jobs may wait on other jobs.
+	class JobSystem
+	{
+	public:
+		using JobFunction = std::function<void()>;
+
+		struct Statistics
+		{
+			uint64_t JobCount = 0;
+			float WaitTime = 0.0f;		// Milliseconds callers spent blocked in Wait
+			float IdleTime = 0.0f;		// Milliseconds workers spent without work, summed over all workers
+		};
+
+		// Uses one thread less than the hardware has when workerCount is 0, the main thread makes up for it
+		static void Init(uint32_t workerCount = 0);
+		static void Shutdown();
+
+		static void Submit(const JobFunction& job, JobCounter* counter = nullptr);
+		static void Wait(JobCounter& counter);
+
+		// Splits [0, count) into ranges of at least minBatchSize and calls fn(begin, end) for each of them,
+		// the calling thread takes the first range
+		template<typename Fn>
+		static void ParallelFor(uint32_t count, uint32_t minBatchSize, Fn&& fn)
+		{
+			ARC_PROFILE_SCOPE()
+
+			const uint32_t batchCount = glm::min(GetWorkerCount() + 1, (count + minBatchSize - 1) / glm::max(minBatchSize, 1u));
+			if (batchCount <= 1)
+			{
+				if (count != 0)
+					fn(0u, count);
+				return;
+			}
+
+			const uint32_t batchSize = (count + batchCount - 1) / batchCount;
+
+			JobCounter counter;
+			for (uint32_t begin = batchSize; begin < count; begin += batchSize)
+			{
+				const uint32_t end = glm::min(begin + batchSize, count);
+				Submit([&fn, begin, end]() { fn(begin, end); }, &counter);
+			}
+
+			fn(0u, batchSize);
+			Wait(counter);
+		}
+
+		[[nodiscard]] static uint32_t GetWorkerCount();
+		[[nodiscard]] static bool IsWorkerThread();
+
+		[[nodiscard]] static Statistics GetStatistics();
+		static void ResetStatistics();
+
+		// Runs one queued job on the calling thread, returns false if there was none
+		static bool TryExecuteJob();
+
+	private:
+		static void Execute(const JobFunction& job, JobCounter* counter);
+		static void WorkerLoop();
+	};
+}
@@ -11,10 +11,13 @@ namespace ArcEngine
 	std::shared_ptr<spdlog::logger> Log::s_CoreLogger;
 	std::shared_ptr<spdlog::logger> Log::s_ClientLogger;
 	
-	void Log::Init()
+	void Log::Init(bool consoleToStderr)
 	{
 		std::vector<spdlog::sink_ptr> logSinks;
-		logSinks.emplace_back(std::make_shared<spdlog::sinks::stdout_color_sink_mt>());
+		if (consoleToStderr)
+			logSinks.emplace_back(std::make_shared<spdlog::sinks::stderr_color_sink_mt>());
+		else
+			logSinks.emplace_back(std::make_shared<spdlog::sinks::stdout_color_sink_mt>());
 		logSinks.emplace_back(std::make_shared<ExternalConsoleSink>(true));
 		logSinks.emplace_back(std::make_shared<spdlog::sinks::basic_file_sink_mt>("ArcEngine.log", true));
 
@@ -22,7 +22,8 @@ namespace ArcEngine
 		};
 
 	public:
-		static void Init();
+		// Tools that write their output to stdout can send the console log to stderr instead
+		static void Init(bool consoleToStderr = false);
 		
 		static std::shared_ptr<spdlog::logger>& GetCoreLogger() { return s_CoreLogger; }
 		static std::shared_ptr<spdlog::logger>& GetClientLogger() { return  s_ClientLogger; }
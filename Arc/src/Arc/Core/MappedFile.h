@@ -0,0 +1,31 @@
+#pragma once
+
+namespace ArcEngine
+{
+	// Read-only view of a whole file mapped into memory, pages are loaded by the OS on first access
+	class MappedFile
+	{
+	public:
+		MappedFile() = default;
+		explicit MappedFile(const std::filesystem::path& filepath) { Open(filepath); }
+		~MappedFile() { Close(); }
+
+		MappedFile(const MappedFile& other) = delete;
+		MappedFile& operator=(const MappedFile& other) = delete;
+
+		bool Open(const std::filesystem::path& filepath);
+		void Close();
+
+		[[nodiscard]] const uint8_t* GetData() const { return m_Data; }
+		[[nodiscard]] uint64_t GetSize() const { return m_Size; }
+
+		operator bool() const { return m_Data; }
+
+	private:
+		const uint8_t* m_Data = nullptr;
+		uint64_t m_Size = 0;
+
+		void* m_FileHandle = nullptr;
+		void* m_MappingHandle = nullptr;
+	};
+}
@@ -0,0 +1,171 @@
+#include "arcpch.h"
+#include "Arc/Physics/JoltJobSystem.h"
+
+#include <condition_variable>
+
+#include "Arc/Core/JobSystem.h"
+
+namespace ArcEngine
+{
+	class JoltJobSystem::BarrierImpl final : public Barrier
+	{
+	public:
+		~BarrierImpl() override
+		{
+			ARC_CORE_ASSERT(m_Jobs.empty(), "Barrier destroyed while it still has jobs")
+		}
+
+		void AddJob(const JobHandle& inJob) override
+		{
+			Job* job = inJob.GetPtr();
+
+			// Counted before the barrier is set, the job may finish right after that
+			m_Pending.fetch_add(1, std::memory_order_relaxed);
+			if (!job->SetBarrier(this))
+			{
+				m_Pending.fetch_sub(1, std::memory_order_relaxed);
+				return;
+			}
+
+			job->AddRef();
+			std::scoped_lock lock(m_Mutex);
+			m_Jobs.push_back(job);
+		}
+
+		void AddJobs(const JobHandle* inHandles, JPH::uint inNumHandles) override
+		{
+			for (JPH::uint i = 0; i < inNumHandles; ++i)
+				AddJob(inHandles[i]);
+		}
+
+		// Runs jobs of this barrier that are ready on the calling thread, then helps with the engine queue
+		void Wait()
+		{
+			ARC_PROFILE_SCOPE()
+
+			while (m_Pending.load(std::memory_order_acquire) > 0)
+			{
+				Job* ready = nullptr;
+				{
+					std::scoped_lock lock(m_Mutex);
+					for (Job* job : m_Jobs)
+					{
+						if (job->CanBeExecuted())
+						{
+							ready = job;
+							break;
+						}
+					}
+				}
+
+				// Execute does nothing if another thread got to the job first
+				if (ready)
+				{
+					ready->Execute();
+					continue;
+				}
+
+				if (ArcEngine::JobSystem::TryExecuteJob())
+					continue;
+
+				std::unique_lock lock(m_Mutex);
+				m_JobFinished.wait_for(lock, std::chrono::microseconds(100), [this]() { return m_Pending.load(std::memory_order_acquire) <= 0; });
+			}
+
+			std::scoped_lock lock(m_Mutex);
+			for (Job* job : m_Jobs)
+				job->Release();
+			m_Jobs.clear();
+		}
+
+	protected:
+		void OnJobFinished([[maybe_unused]] Job* inJob) override
+		{
+			m_Pending.fetch_sub(1, std::memory_order_release);
+			{
+				std::scoped_lock lock(m_Mutex);
+			}
+			m_JobFinished.notify_one();
+		}
+
+	private:
+		std::vector<Job*> m_Jobs;
+		std::atomic<int> m_Pending = 0;
+
+		std::mutex m_Mutex;
+		std::condition_variable m_JobFinished;
+	};
+
+	JoltJobSystem::JoltJobSystem(JPH::uint maxJobs)
+	{
+		ARC_PROFILE_SCOPE()
+
+		m_Jobs.Init(maxJobs, maxJobs);
+	}
+
+	int JoltJobSystem::GetMaxConcurrency() const
+	{
+		return static_cast<int>(ArcEngine::JobSystem::GetWorkerCount()) + 1;
+	}
+
+	JoltJobSystem::JobHandle JoltJobSystem::CreateJob(const char* inName, JPH::ColorArg inColor, const JobFunction& inJobFunction, JPH::uint32 inNumDependencies)
+	{
+		ARC_PROFILE_SCOPE()
+
+		JPH::uint32 index;
+		while (true)
+		{
+			index = m_Jobs.ConstructObject(inName, inColor, this, inJobFunction, inNumDependencies);
+			if (index != JPH::FixedSizeFreeList<Job>::cInvalidObjectIndex)
+				break;
+
+			ARC_CORE_WARN("Out of physics jobs, waiting for one to finish");
+			std::this_thread::sleep_for(std::chrono::microseconds(100));
+		}
+
+		Job* job = &m_Jobs.Get(index);
+
+		// Take a reference before queueing, the job may complete immediately
+		JobHandle handle(job);
+		if (inNumDependencies == 0)
+			QueueJob(job);
+
+		return handle;
+	}
+
+	JPH::JobSystem::Barrier* JoltJobSystem::CreateBarrier()
+	{
+		return new BarrierImpl();
+	}
+
+	void JoltJobSystem::DestroyBarrier(Barrier* inBarrier)
+	{
+		delete static_cast<BarrierImpl*>(inBarrier);
+	}
+
+	void JoltJobSystem::WaitForJobs(Barrier* inBarrier)
+	{
+		static_cast<BarrierImpl*>(inBarrier)->Wait();
+	}
+
+	void JoltJobSystem::QueueJob(Job* inJob)
+	{
+		inJob->AddRef();
+		ArcEngine::JobSystem::Submit([inJob]()
+		{
+			inJob->Execute();
+			inJob->Release();
+		});
+	}
+
+	void JoltJobSystem::QueueJobs(Job** inJobs, JPH::uint inNumJobs)
+	{
+		for (JPH::uint i = 0; i < inNumJobs; ++i)
+			QueueJob(inJobs[i]);
+	}
+
+	void JoltJobSystem::FreeJob(Job* inJob)
+	{
+		m_Jobs.DestructObject(inJob);
+	}
+}
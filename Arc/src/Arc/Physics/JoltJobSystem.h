@@ -0,0 +1,31 @@
+#pragma once
+
+#include <Jolt/Jolt.h>
+#include <Jolt/Core/FixedSizeFreeList.h>
+#include <Jolt/Core/JobSystem.h>
+
+namespace ArcEngine
+{
+	// Runs Jolt's jobs on the engine job system instead of a thread pool of its own
+	class JoltJobSystem final : public JPH::JobSystem
+	{
+	public:
+		JoltJobSystem(JPH::uint maxJobs);
+
+		[[nodiscard]] int GetMaxConcurrency() const override;
+		[[nodiscard]] JobHandle CreateJob(const char* inName, JPH::ColorArg inColor, const JobFunction& inJobFunction, JPH::uint32 inNumDependencies = 0) override;
+		[[nodiscard]] Barrier* CreateBarrier() override;
+		void DestroyBarrier(Barrier* inBarrier) override;
+		void WaitForJobs(Barrier* inBarrier) override;
+
+	protected:
+		void QueueJob(Job* inJob) override;
+		void QueueJobs(Job** inJobs, JPH::uint inNumJobs) override;
+		void FreeJob(Job* inJob) override;
+
+	private:
+		class BarrierImpl;
+
+		JPH::FixedSizeFreeList<Job> m_Jobs;
+	};
+}
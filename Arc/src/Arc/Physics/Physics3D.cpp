@@ -7,10 +7,10 @@
 #include <Jolt/RegisterTypes.h>
 #include <Jolt/Core/Factory.h>
 #include <Jolt/Core/TempAllocator.h>
-#include <Jolt/Core/JobSystemThreadPool.h>
 #include <Jolt/Physics/PhysicsSettings.h>
 #include <Jolt/Physics/PhysicsSystem.h>
 
+#include "Arc/Physics/JoltJobSystem.h"
 #include "Arc/Scene/Scene.h"
 
 namespace ArcEngine
@@ -122,7 +122,7 @@ namespace ArcEngine
 
 	JPH::PhysicsSystem* Physics3D::s_PhysicsSystem;
 	JPH::TempAllocator* Physics3D::s_TempAllocator;
-	JPH::JobSystemThreadPool* Physics3D::s_JobSystem;
+	JoltJobSystem* Physics3D::s_JobSystem;
 
 	BPLayerInterfaceImpl* Physics3D::s_BPLayerInterface;
 
@@ -137,7 +137,7 @@ namespace ArcEngine
 		JPH::RegisterTypes();
 
 		s_TempAllocator = new JPH::TempAllocatorImpl(10 * 1024 * 1024);
-		s_JobSystem = new JPH::JobSystemThreadPool(JPH::cMaxPhysicsJobs, JPH::cMaxPhysicsBarriers, static_cast<int>(JPH::thread::hardware_concurrency()) - 1);
+		s_JobSystem = new JoltJobSystem(JPH::cMaxPhysicsJobs);
 		constexpr JPH::uint cMaxBodies = 65536;
 		constexpr JPH::uint cNumBodyMutexes = 0;
 		constexpr JPH::uint cMaxBodyPairs = 65536;
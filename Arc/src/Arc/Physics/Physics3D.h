@@ -5,12 +5,12 @@ namespace JPH
 	class BodyInterface;
 	class PhysicsSystem;
 	class TempAllocator;
-	class JobSystemThreadPool;
 }
 
 namespace ArcEngine
 {
 	class BPLayerInterfaceImpl;
+	class JoltJobSystem;
 
 	class Physics3D
 	{
@@ -24,7 +24,7 @@ namespace ArcEngine
 	private:
 		static JPH::PhysicsSystem* s_PhysicsSystem;
 		static JPH::TempAllocator* s_TempAllocator;
-		static JPH::JobSystemThreadPool* s_JobSystem;
+		static JoltJobSystem* s_JobSystem;
 		static BPLayerInterfaceImpl* s_BPLayerInterface;
 	};
 }
@@ -4,6 +4,7 @@
 #include "Arc/Renderer/Renderer.h"
 
 #include "Platform/OpenGL/OpenGLBuffer.h"
+#include "Platform/Null/NullBuffer.h"
 
 namespace ArcEngine
 {
@@ -11,7 +12,7 @@ namespace ArcEngine
 	{
 		switch (Renderer::GetAPI())
 		{
-			case RendererAPI::API::None:	ARC_CORE_ASSERT(false, "RendererAPI::None is currently not supported!") return nullptr;
+			case RendererAPI::API::None:	return CreateRef<NullVertexBuffer>(size);
 			case RendererAPI::API::OpenGL:	return CreateRef<OpenGLVertexBuffer>(size);
 		}
 
@@ -23,7 +24,7 @@ namespace ArcEngine
 	{
 		switch (Renderer::GetAPI())
 		{
-			case RendererAPI::API::None:	ARC_CORE_ASSERT(false, "RendererAPI::None is currently not supported!") return nullptr;
+			case RendererAPI::API::None:	return CreateRef<NullVertexBuffer>(verticies, size);
 			case RendererAPI::API::OpenGL:	return CreateRef<OpenGLVertexBuffer>(verticies, size);
 		}
 
@@ -35,7 +36,7 @@ namespace ArcEngine
 	{
 		switch (Renderer::GetAPI())
 		{
-			case RendererAPI::API::None:	ARC_CORE_ASSERT(false, "RendererAPI::None is currently not supported!") return nullptr;
+			case RendererAPI::API::None:	return CreateRef<NullIndexBuffer>(indices, static_cast<uint32_t>(count));
 			case RendererAPI::API::OpenGL:	return CreateRef<OpenGLIndexBuffer>(indices, static_cast<uint32_t>(count));
 		}
 
@@ -47,11 +48,23 @@ namespace ArcEngine
 	{
 		switch (Renderer::GetAPI())
 		{
-			case RendererAPI::API::None:	ARC_CORE_ASSERT(false, "RendererAPI::None is currently not supported!") return nullptr;
+			case RendererAPI::API::None:	return CreateRef<NullUniformBuffer>();
 			case RendererAPI::API::OpenGL:	return CreateRef<OpenGLUniformBuffer>();
 		}
 
 		ARC_CORE_ASSERT(false, "Unknown RendererAPI!")
 		return nullptr;
 	}
+
+	Ref<StorageBuffer> StorageBuffer::Create()
+	{
+		switch (Renderer::GetAPI())
+		{
+			case RendererAPI::API::None:	return CreateRef<NullStorageBuffer>();
+			case RendererAPI::API::OpenGL:	return CreateRef<OpenGLStorageBuffer>();
+		}
+
+		ARC_CORE_ASSERT(false, "Unknown RendererAPI!")
+		return nullptr;
+	}
 }
@@ -141,10 +141,30 @@ namespace ArcEngine
 		virtual ~UniformBuffer() = default;
 
 		virtual void Bind() const = 0;
+		// Binds the buffer to a block index, for buffers that take turns on the same index
+		virtual void Bind(uint32_t blockIndex) const = 0;
 		virtual void Unbind() const = 0;
 		virtual void SetData(const void* data, uint32_t offset, uint32_t size) = 0;
 		virtual void SetLayout(const BufferLayout& layout, uint32_t blockIndex, uint32_t count = 1) = 0;
+		// Allocates size bytes for a block laid out by shader reflection instead of a BufferLayout
+		virtual void SetSize(uint32_t size) = 0;
 
 		[[nodiscard]] static Ref<UniformBuffer> Create();
 	};
+
+	// Shader storage buffer, for data that does not have a fixed size
+	class StorageBuffer
+	{
+	public:
+		// Sections of one buffer bound to different indices have to start at a multiple of this
+		static constexpr uint32_t OffsetAlignment = 256;
+
+		virtual ~StorageBuffer() = default;
+
+		virtual void Bind(uint32_t blockIndex, uint32_t offset, uint32_t size) const = 0;
+		// Replaces the contents with one upload, growing the buffer if it is too small
+		virtual void SetData(const void* data, uint32_t size) = 0;
+
+		[[nodiscard]] static Ref<StorageBuffer> Create();
+	};
 }
@@ -3,6 +3,7 @@
 
 #include "Arc/Renderer/Renderer.h"
 #include "Platform/OpenGL/OpenGLContext.h"
+#include "Platform/Null/NullContext.h"
 
 namespace ArcEngine
 {
@@ -10,7 +11,7 @@ namespace ArcEngine
 	{
 		switch(Renderer::GetAPI())
 		{
-			case RendererAPI::API::None:	ARC_CORE_ASSERT(false, "RendererAPI::None is currently not supported!") return nullptr;
+			case RendererAPI::API::None:	return CreateScope<NullContext>();
 			case RendererAPI::API::OpenGL:	return CreateScope<OpenGLContext>(static_cast<GLFWwindow*>(window));
 		}
 
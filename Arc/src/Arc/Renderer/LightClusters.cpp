@@ -0,0 +1,173 @@
+#include "arcpch.h"
+#include "Arc/Renderer/LightClusters.h"
+
+namespace ArcEngine
+{
+	// Logarithmic slices need a positive near depth, orthographic cameras can have zero or negative ones
+	static constexpr float s_MinNearDepth = 0.05f;
+
+	static bool SphereOverlaps(const AABB& aabb, const glm::vec3& center, float radius)
+	{
+		const glm::vec3 closest = glm::clamp(center, aabb.Min, aabb.Max);
+		const glm::vec3 d = closest - center;
+		return glm::dot(d, d) <= radius * radius;
+	}
+
+	uint32_t LightClusters::GetSlice(float viewDepth) const
+	{
+		if (viewDepth <= m_NearDepth)
+			return 0;
+
+		const float slice = glm::log(viewDepth) * m_DepthScale - m_DepthBias;
+		return glm::min(static_cast<uint32_t>(glm::max(slice, 0.0f)), GridZ - 1);
+	}
+
+	void LightClusters::Build(const glm::mat4& view, const glm::mat4& projection, std::span<const LightBounds> lights)
+	{
+		ARC_PROFILE_SCOPE()
+
+		if (projection != m_Projection || m_ClusterBounds.empty())
+		{
+			m_Projection = projection;
+			BuildClusterBounds();
+		}
+
+		// A degenerate projection, like the one of a scene without a camera, has no clusters to put lights in
+		if (!(m_FarDepth > m_NearDepth))
+			lights = {};
+
+		m_Assignments.clear();
+		for (uint32_t lightIndex = 0; lightIndex < static_cast<uint32_t>(lights.size()); ++lightIndex)
+		{
+			const LightBounds& light = lights[lightIndex];
+			const glm::vec3 center = glm::vec3(view * glm::vec4(light.Position, 1.0f));
+			const float radius = light.Range;
+			const float depth = -center.z;
+			if (radius <= 0.0f || depth + radius < m_NearDepth || depth - radius > m_FarDepth)
+				continue;
+
+			const uint32_t firstSlice = GetSlice(depth - radius);
+			const uint32_t lastSlice = GetSlice(depth + radius);
+
+			// Screen tiles under the projected bounds of the sphere, every tile if part of it is behind the camera
+			glm::uvec2 firstTile(0);
+			glm::uvec2 lastTile(GridX - 1, GridY - 1);
+			glm::vec2 ndcMin(std::numeric_limits<float>::max());
+			glm::vec2 ndcMax(std::numeric_limits<float>::lowest());
+			bool projected = true;
+			for (uint32_t corner = 0; corner < 8; ++corner)
+			{
+				const glm::vec3 offset = { (corner & 1) ? radius : -radius, (corner & 2) ? radius : -radius, (corner & 4) ? radius : -radius };
+				const glm::vec4 clip = projection * glm::vec4(center + offset, 1.0f);
+				if (clip.w <= 0.0f)
+				{
+					projected = false;
+					break;
+				}
+
+				const glm::vec2 ndc = glm::vec2(clip) / clip.w;
+				ndcMin = glm::min(ndcMin, ndc);
+				ndcMax = glm::max(ndcMax, ndc);
+			}
+			if (projected)
+			{
+				if (ndcMax.x < -1.0f || ndcMax.y < -1.0f || ndcMin.x > 1.0f || ndcMin.y > 1.0f)
+					continue;
+
+				const glm::vec2 gridSize = { static_cast<float>(GridX), static_cast<float>(GridY) };
+				const glm::vec2 minTile = glm::clamp((ndcMin * 0.5f + 0.5f) * gridSize, glm::vec2(0.0f), gridSize - 1.0f);
+				const glm::vec2 maxTile = glm::clamp((ndcMax * 0.5f + 0.5f) * gridSize, glm::vec2(0.0f), gridSize - 1.0f);
+				firstTile = glm::uvec2(minTile);
+				lastTile = glm::uvec2(maxTile);
+			}
+
+			for (uint32_t z = firstSlice; z <= lastSlice; ++z)
+			{
+				for (uint32_t y = firstTile.y; y <= lastTile.y; ++y)
+				{
+					for (uint32_t x = firstTile.x; x <= lastTile.x; ++x)
+					{
+						const uint32_t clusterIndex = GetClusterIndex(x, y, z);
+						if (SphereOverlaps(m_ClusterBounds[clusterIndex], center, radius))
+							m_Assignments.emplace_back(clusterIndex, lightIndex);
+					}
+				}
+			}
+		}
+
+		// Counting sort by cluster, keeps the lights of a cluster in submission order
+		m_Clusters.assign(ClusterCount, {});
+		for (const auto& [clusterIndex, lightIndex] : m_Assignments)
+			++m_Clusters[clusterIndex].Count;
+
+		uint32_t firstIndex = 0;
+		for (Cluster& cluster : m_Clusters)
+		{
+			cluster.FirstIndex = firstIndex;
+			firstIndex += cluster.Count;
+			cluster.Count = 0;
+		}
+
+		m_LightIndices.resize(m_Assignments.size());
+		for (const auto& [clusterIndex, lightIndex] : m_Assignments)
+		{
+			Cluster& cluster = m_Clusters[clusterIndex];
+			m_LightIndices[cluster.FirstIndex + cluster.Count++] = lightIndex;
+		}
+	}
+
+	void LightClusters::BuildClusterBounds()
+	{
+		ARC_PROFILE_SCOPE()
+
+		const glm::mat4 inverseProjection = glm::inverse(m_Projection);
+		const auto unproject = [&inverseProjection](const glm::vec3& ndc)
+		{
+			const glm::vec4 point = inverseProjection * glm::vec4(ndc, 1.0f);
+			return glm::vec3(point) / point.w;
+		};
+
+		const float cameraNear = -unproject({ 0.0f, 0.0f, -1.0f }).z;
+		const float cameraFar = -unproject({ 0.0f, 0.0f, 1.0f }).z;
+		m_NearDepth = glm::max(cameraNear, s_MinNearDepth);
+		m_FarDepth = glm::max(cameraFar, m_NearDepth * 2.0f);
+
+		const float logRatio = glm::log(m_FarDepth / m_NearDepth);
+		m_DepthScale = static_cast<float>(GridZ) / logRatio;
+		m_DepthBias = static_cast<float>(GridZ) * glm::log(m_NearDepth) / logRatio;
+
+		// Depth changes linearly along the edges of the frustum, so points at a depth are found by walking
+		// from the near to the far plane. This works for perspective and orthographic projections alike.
+		const float depthRange = cameraFar - cameraNear;
+		const auto pointAtDepth = [&](const glm::vec2& ndc, float depth)
+		{
+			const float t = depthRange != 0.0f ? (depth - cameraNear) / depthRange : 0.0f;
+			return glm::mix(unproject({ ndc, -1.0f }), unproject({ ndc, 1.0f }), t);
+		};
+
+		m_ClusterBounds.resize(ClusterCount);
+		for (uint32_t z = 0; z < GridZ; ++z)
+		{
+			const float sliceNear = m_NearDepth * glm::pow(m_FarDepth / m_NearDepth, static_cast<float>(z) / GridZ);
+			const float sliceFar = m_NearDepth * glm::pow(m_FarDepth / m_NearDepth, static_cast<float>(z + 1) / GridZ);
+			for (uint32_t y = 0; y < GridY; ++y)
+			{
+				for (uint32_t x = 0; x < GridX; ++x)
+				{
+					const glm::vec2 ndcMin = { static_cast<float>(x) / GridX * 2.0f - 1.0f, static_cast<float>(y) / GridY * 2.0f - 1.0f };
+					const glm::vec2 ndcMax = { static_cast<float>(x + 1) / GridX * 2.0f - 1.0f, static_cast<float>(y + 1) / GridY * 2.0f - 1.0f };
+
+					AABB bounds(glm::vec3(std::numeric_limits<float>::max()), glm::vec3(std::numeric_limits<float>::lowest()));
+					for (uint32_t corner = 0; corner < 4; ++corner)
+					{
+						const glm::vec2 ndc = { (corner & 1) ? ndcMax.x : ndcMin.x, (corner & 2) ? ndcMax.y : ndcMin.y };
+						bounds.Expand(pointAtDepth(ndc, sliceNear));
+						bounds.Expand(pointAtDepth(ndc, sliceFar));
+					}
+
+					m_ClusterBounds[GetClusterIndex(x, y, z)] = bounds;
+				}
+			}
+		}
+	}
+}
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <span>
+
+#include "Arc/Utils/AABB.h"
+
+namespace ArcEngine
+{
+	// Assigns point and spot lights to clusters of the view frustum: screen tiles split into depth slices that grow
+	// exponentially with distance. A pixel only has to shade the lights of the cluster it falls into.
+	// Runs on the CPU and does not need a renderer.
+	class LightClusters
+	{
+	public:
+		static constexpr uint32_t GridX = 16;
+		static constexpr uint32_t GridY = 9;
+		static constexpr uint32_t GridZ = 24;
+		static constexpr uint32_t ClusterCount = GridX * GridY * GridZ;
+
+		struct LightBounds
+		{
+			glm::vec3 Position;		// World space
+			float Range;
+		};
+
+		struct Cluster
+		{
+			uint32_t FirstIndex = 0;	// Into GetLightIndices
+			uint32_t Count = 0;
+		};
+
+		void Build(const glm::mat4& view, const glm::mat4& projection, std::span<const LightBounds> lights);
+
+		[[nodiscard]] const std::vector<Cluster>& GetClusters() const { return m_Clusters; }
+		[[nodiscard]] const std::vector<uint32_t>& GetLightIndices() const { return m_LightIndices; }
+
+		// slice = log(viewDepth) * scale - bias
+		[[nodiscard]] float GetDepthScale() const { return m_DepthScale; }
+		[[nodiscard]] float GetDepthBias() const { return m_DepthBias; }
+
+		[[nodiscard]] static constexpr uint32_t GetClusterIndex(uint32_t x, uint32_t y, uint32_t z) { return x + GridX * (y + GridY * z); }
+		[[nodiscard]] uint32_t GetSlice(float viewDepth) const;
+
+	private:
+		void BuildClusterBounds();
+
+	private:
+		glm::mat4 m_Projection = glm::mat4(0.0f);
+		float m_NearDepth = 0.0f;
+		float m_FarDepth = 0.0f;
+		float m_DepthScale = 0.0f;
+		float m_DepthBias = 0.0f;
+
+		std::vector<AABB> m_ClusterBounds;			// View space, only rebuilt when the projection changes
+		std::vector<Cluster> m_Clusters;
+		std::vector<uint32_t> m_LightIndices;
+		std::vector<std::pair<uint32_t, uint32_t>> m_Assignments;		// Cluster, light
+	};
+}
@@ -3,6 +3,7 @@
 
 #include <glm/gtc/type_ptr.hpp>
 
+#include "Buffer.h"
 #include "Renderer3D.h"
 #include "Shader.h"
 #include "Texture.h"
@@ -46,24 +47,32 @@ namespace ArcEngine
 
 		delete[] m_Buffer;
 
-		m_BufferSizeInBytes = 0;
 		const auto& materialProperties = m_Shader->GetMaterialProperties();
 
+		// Offsets come from the shader's std140 layout, so there may be padding between properties
+		m_BlockSizeInBytes = m_Shader->GetMaterialBlockSize();
+		m_BufferSizeInBytes = m_BlockSizeInBytes;
 		for (const auto& [_, property] : materialProperties)
-			m_BufferSizeInBytes += property.SizeInBytes;
+			m_BufferSizeInBytes = glm::max(m_BufferSizeInBytes, property.OffsetInBytes + property.SizeInBytes);
 
 		m_Buffer = new char[m_BufferSizeInBytes];
 		memset(m_Buffer, 0, m_BufferSizeInBytes);
+
+		m_UniformBuffer = nullptr;
+		if (m_BlockSizeInBytes != 0)
+		{
+			m_UniformBuffer = UniformBuffer::Create();
+			m_UniformBuffer->SetSize(static_cast<uint32_t>(m_BlockSizeInBytes));
+		}
+		m_Dirty = true;
 		
-		uint32_t slot = 0;
 		auto one = glm::vec4(1.0);
 		for (auto& [name, property] : materialProperties)
 		{
 			if (property.Type == MaterialPropertyType::Sampler2D)
 			{
-				memcpy(m_Buffer + property.OffsetInBytes, &slot, sizeof(uint32_t));
-				m_Textures.emplace(slot, nullptr);
-				slot++;
+				memcpy(m_Buffer + property.OffsetInBytes, &property.TextureSlot, sizeof(uint32_t));
+				m_Textures.emplace(property.TextureSlot, nullptr);
 			}
 			else if (property.Type == MaterialPropertyType::Float ||
 				property.Type == MaterialPropertyType::Float2 ||
@@ -82,52 +91,25 @@ namespace ArcEngine
 	{
 		ARC_PROFILE_SCOPE()
 
-		const auto& materialProperties = m_Shader->GetMaterialProperties();
-
 		m_Shader->Bind();
-		for (const auto& [name, property] : materialProperties)
+
+		if (m_UniformBuffer)
 		{
-			char* bufferStart = m_Buffer + property.OffsetInBytes;
-			uint32_t slot = *reinterpret_cast<uint32_t*>(bufferStart);
-			switch (property.Type)
+			if (m_Dirty)
 			{
-				case MaterialPropertyType::None : break;
-				case MaterialPropertyType::Sampler2D :
-				{
-					m_Shader->SetInt(name, static_cast<int>(slot));
-					if (m_Textures.at(slot))
-						m_Textures.at(slot)->Bind(slot);
-					else
-						s_WhiteTexture->Bind(slot);
-					break;
-				}
-				case MaterialPropertyType::Bool :
-				case MaterialPropertyType::Int :
-				{
-					m_Shader->SetInt(name, *reinterpret_cast<int32_t*>(bufferStart));
-					break;
-				}
-				case MaterialPropertyType::Float :
-				{
-					m_Shader->SetFloat(name, *reinterpret_cast<float*>(bufferStart));
-					break;
-				}
-				case MaterialPropertyType::Float2 :
-				{
-					m_Shader->SetFloat2(name, *reinterpret_cast<glm::vec2*>(bufferStart));
-					break;
-				}
-				case MaterialPropertyType::Float3 :
-				{
-					m_Shader->SetFloat3(name, *reinterpret_cast<glm::vec3*>(bufferStart));
-					break;
-				}
-				case MaterialPropertyType::Float4 :
-				{
-					m_Shader->SetFloat4(name, *reinterpret_cast<glm::vec4*>(bufferStart));
-					break;
-				}
+				m_UniformBuffer->SetData(m_Buffer, 0, static_cast<uint32_t>(m_BlockSizeInBytes));
+				m_Dirty = false;
 			}
+			m_UniformBuffer->Bind(BlockBinding);
+		}
+
+		// Sampler units are fixed by the shader, only the textures need binding
+		for (const auto& [slot, texture] : m_Textures)
+		{
+			if (texture)
+				texture->Bind(slot);
+			else
+				s_WhiteTexture->Bind(slot);
 		}
 	}
 
@@ -178,6 +160,9 @@ namespace ArcEngine
 		const auto& materialProperties = m_Shader->GetMaterialProperties();
 		const auto& property = m_Shader->GetMaterialProperties().find(name);
 		if (property != materialProperties.end())
+		{
 			memcpy(m_Buffer + property->second.OffsetInBytes, data, property->second.SizeInBytes);
+			m_Dirty = true;
+		}
 	}
 }
@@ -4,12 +4,16 @@ namespace ArcEngine
 {
 	class Texture2D;
 	class Shader;
+	class UniformBuffer;
 
 	class Material
 	{
 		using MaterialData = void*;
 
 	public:
+		// Must match the binding of the u_Material block in material shaders
+		static constexpr uint32_t BlockBinding = 4;
+
 		explicit Material(const std::filesystem::path& shaderPath = "assets/shaders/PBR.glsl");
 		virtual ~Material();
 
@@ -46,6 +50,11 @@ namespace ArcEngine
 		size_t m_BufferSizeInBytes = 0;
 		std::unordered_map<uint32_t, Ref<Texture2D>> m_Textures;
 
+		// The first GetMaterialBlockSize() bytes of m_Buffer, uploaded on Bind when they changed
+		Ref<UniformBuffer> m_UniformBuffer = nullptr;
+		size_t m_BlockSizeInBytes = 0;
+		mutable bool m_Dirty = true;
+
 		static Ref<Texture2D> s_WhiteTexture;
 	};
 }
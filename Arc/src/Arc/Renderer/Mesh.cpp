@@ -1,6 +1,8 @@
 #include "arcpch.h"
 #include "Mesh.h"
 
+#include <span>
+
 #define TINYOBJLOADER_IMPLEMENTATION
 #include <tiny_obj_loader.h>
 
@@ -8,6 +10,8 @@
 #include <glm/gtx/hash.hpp>
 
 #include "Arc/Core/AssetManager.h"
+#include "Arc/Core/Filesystem.h"
+#include "Arc/Core/MappedFile.h"
 #include "Arc/Renderer/Material.h"
 #include "Arc/Renderer/Shader.h"
 #include "Arc/Renderer/VertexArray.h"
@@ -40,18 +44,292 @@ namespace std
 	{
 		size_t operator()(ArcEngine::Vertex const& vertex) const noexcept
 		{
-			const std::size_t h1 = std::hash<glm::vec3>{}(vertex.Position);
-			const std::size_t h2 = std::hash<glm::vec2>{}(vertex.TexCoord);
-			const std::size_t h3 = std::hash<glm::vec3>{}(vertex.Normal);
-			const std::size_t h4 = std::hash<glm::vec3>{}(vertex.Tangent);
-			const std::size_t h5 = std::hash<glm::vec3>{}(vertex.Bitangent);
-			return h1 ^ (h2 << 1) ^ (h3 << 2) ^ (h4 << 3) ^ (h5 << 4);
+			// Combine every component, xor-ing shifted hashes of the attributes collides on symmetric data
+			size_t seed = 0;
+			const auto combine = [&seed](float value) { seed ^= std::hash<float>{}(value) + 0x9e3779b97f4a7c15ull + (seed << 6) + (seed >> 2); };
+			for (int i = 0; i < 3; ++i)
+				combine(vertex.Position[i]);
+			for (int i = 0; i < 2; ++i)
+				combine(vertex.TexCoord[i]);
+			for (int i = 0; i < 3; ++i)
+				combine(vertex.Normal[i]);
+			for (int i = 0; i < 3; ++i)
+				combine(vertex.Tangent[i]);
+			for (int i = 0; i < 3; ++i)
+				combine(vertex.Bitangent[i]);
+			return seed;
 		}
 	};
 }
 
 namespace ArcEngine
 {
+	// Cooked mesh file layout, all offsets are from the start of the file:
+	// header | submesh table | vertex stream | index stream | string table
+	static constexpr char s_MeshFileMagic[4] = { 'A', 'M', 'S', 'H' };
+	static constexpr uint32_t s_MeshFileVersion = 1;
+	static constexpr const char* s_MeshCacheDirectory = "Cache/Meshes";
+
+	struct MeshFileString
+	{
+		uint32_t Offset = 0;
+		uint32_t Length = 0;
+	};
+
+	struct MeshFileHeader
+	{
+		char Magic[4];
+		uint32_t Version;
+		uint32_t VertexStride;
+		uint32_t SubmeshCount;
+
+		// Source file the mesh was cooked from, used to detect stale files
+		uint64_t SourceSize;
+		int64_t SourceWriteTime;
+
+		uint64_t VertexCount;
+		uint64_t IndexCount;
+		uint64_t SubmeshTableOffset;
+		uint64_t VertexOffset;
+		uint64_t IndexOffset;
+		uint64_t StringTableOffset;
+		uint64_t StringTableSize;
+	};
+
+	struct MeshFileSubmesh
+	{
+		MeshFileString Name;
+		MeshFileString DiffuseTexture;
+		MeshFileString NormalTexture;
+		MeshFileString EmissiveTexture;
+
+		// Indices are relative to the first vertex of the submesh
+		uint64_t FirstVertex;
+		uint64_t VertexCount;
+		uint64_t FirstIndex;
+		uint64_t IndexCount;
+
+		glm::vec3 BoundsMin;
+		glm::vec3 BoundsMax;
+	};
+
+	// Submesh data in memory, either owned by an import or pointing into a mapped file
+	struct Mesh::SubmeshSource
+	{
+		std::string_view Name;
+		std::string_view DiffuseTexture;
+		std::string_view NormalTexture;
+		std::string_view EmissiveTexture;
+		std::span<const Vertex> Vertices;
+		std::span<const uint32_t> Indices;
+		AABB BoundingBox;
+	};
+
+	struct ImportedSubmesh
+	{
+		std::string Name;
+		std::string DiffuseTexture;
+		std::string NormalTexture;
+		std::string EmissiveTexture;
+		size_t FirstVertex = 0;
+		size_t VertexCount = 0;
+		size_t FirstIndex = 0;
+		size_t IndexCount = 0;
+		AABB BoundingBox;
+	};
+
+	struct ImportedMesh
+	{
+		std::vector<Vertex> Vertices;
+		std::vector<uint32_t> Indices;
+		std::vector<ImportedSubmesh> Submeshes;
+	};
+
+	// Decoded mesh waiting for its upload, the submeshes point into either the mapped cooked file or the import
+	struct MeshSource
+	{
+		std::string Filepath;
+		MappedFile File;
+		ImportedMesh Imported;
+		std::vector<Mesh::SubmeshSource> Submeshes;
+	};
+
+	static uint64_t AlignOffset(uint64_t offset)
+	{
+		return (offset + 7) & ~static_cast<uint64_t>(7);
+	}
+
+	static int64_t GetSourceWriteTime(const std::filesystem::path& path)
+	{
+		std::error_code error;
+		return static_cast<int64_t>(std::filesystem::last_write_time(path, error).time_since_epoch().count());
+	}
+
+	static bool ImportObj(const std::filesystem::path& path, ImportedMesh& outMesh)
+	{
+		ARC_PROFILE_SCOPE()
+
+		const std::string filepath = path.string();
+
+		tinyobj::ObjReaderConfig reader_config;
+		tinyobj::ObjReader reader;
+
+		if (!reader.ParseFromFile(filepath, reader_config))
+		{
+			if (!reader.Error().empty())
+			{
+				ARC_CORE_ERROR("Could not import the file: {0}. Error: {1}", filepath, reader.Error());
+				return false;
+			}
+		}
+
+		if (!reader.Warning().empty())
+			ARC_CORE_WARN("File: {0}. Warning: {1}", filepath, reader.Warning());
+
+		auto& attrib = reader.GetAttrib();
+		auto& shapes = reader.GetShapes();
+		auto& materials = reader.GetMaterials();
+		const std::filesystem::path dir = path.parent_path();
+
+		std::unordered_map<Vertex, uint32_t> uniqueVertices{};
+
+		// Loop over shapes
+		for (const auto& shape : shapes)
+		{
+			ImportedSubmesh& submesh = outMesh.Submeshes.emplace_back();
+			submesh.Name = shape.name;
+			submesh.FirstVertex = outMesh.Vertices.size();
+			submesh.FirstIndex = outMesh.Indices.size();
+
+			uniqueVertices.clear();
+			uniqueVertices.reserve(shape.mesh.indices.size());
+			AABB boundingBox(glm::vec3(std::numeric_limits<float>::max()), glm::vec3(std::numeric_limits<float>::lowest()));
+
+			// Loop over faces(polygon)
+			int materialId = -1;
+			size_t index_offset = 0;
+			for (size_t f = 0; f < shape.mesh.num_face_vertices.size(); f++)
+			{
+				auto fv = static_cast<size_t>(shape.mesh.num_face_vertices[f]);
+
+				// Loop over vertices in the face.
+				for (size_t v = 0; v < fv; v++)
+				{
+					// access to vertex
+					tinyobj::index_t idx = shape.mesh.indices[index_offset + v];
+
+					Vertex vertex;
+					vertex.Position.x = attrib.vertices[3 * static_cast<size_t>(idx.vertex_index) + 0];
+					vertex.Position.y = attrib.vertices[3 * static_cast<size_t>(idx.vertex_index) + 1];
+					vertex.Position.z = attrib.vertices[3 * static_cast<size_t>(idx.vertex_index) + 2];
+					if (idx.texcoord_index >= 0)
+					{
+						vertex.TexCoord.x = attrib.texcoords[2 * static_cast<size_t>(idx.texcoord_index) + 0];
+						vertex.TexCoord.y = attrib.texcoords[2 * static_cast<size_t>(idx.texcoord_index) + 1];
+					}
+					if (idx.normal_index >= 0)
+					{
+						vertex.Normal.x = attrib.normals[3 * static_cast<size_t>(idx.normal_index) + 0];
+						vertex.Normal.y = attrib.normals[3 * static_cast<size_t>(idx.normal_index) + 1];
+						vertex.Normal.z = attrib.normals[3 * static_cast<size_t>(idx.normal_index) + 2];
+					}
+
+					const auto [it, inserted] = uniqueVertices.try_emplace(vertex, static_cast<uint32_t>(outMesh.Vertices.size() - submesh.FirstVertex));
+					if (inserted)
+					{
+						outMesh.Vertices.push_back(vertex);
+						boundingBox.Expand(vertex.Position);
+					}
+
+					outMesh.Indices.push_back(it->second);
+				}
+				index_offset += fv;
+
+				// per-face material
+				materialId = shape.mesh.material_ids[f];
+			}
+
+			submesh.VertexCount = outMesh.Vertices.size() - submesh.FirstVertex;
+			submesh.IndexCount = outMesh.Indices.size() - submesh.FirstIndex;
+			submesh.BoundingBox = boundingBox.IsValid() ? boundingBox : AABB();
+
+			if (materialId >= 0)
+			{
+				const auto& material = materials.at(materialId);
+				if (!material.diffuse_texname.empty())
+					submesh.DiffuseTexture = (dir / material.diffuse_texname).string();
+				if (!material.normal_texname.empty())
+					submesh.NormalTexture = (dir / material.normal_texname).string();
+				else if (!material.bump_texname.empty())
+					submesh.NormalTexture = (dir / material.bump_texname).string();
+				if (!material.emissive_texname.empty())
+					submesh.EmissiveTexture = (dir / material.emissive_texname).string();
+			}
+		}
+
+		return true;
+	}
+
+	static bool WriteCookedMesh(const std::filesystem::path& cookedPath, const std::filesystem::path& sourcePath, const ImportedMesh& mesh)
+	{
+		ARC_PROFILE_SCOPE()
+
+		std::string stringTable;
+		const auto addString = [&stringTable](const std::string& str)
+		{
+			const MeshFileString result = { static_cast<uint32_t>(stringTable.size()), static_cast<uint32_t>(str.size()) };
+			stringTable += str;
+			return result;
+		};
+
+		std::vector<MeshFileSubmesh> submeshTable;
+		submeshTable.reserve(mesh.Submeshes.size());
+		for (const ImportedSubmesh& submesh : mesh.Submeshes)
+		{
+			MeshFileSubmesh& entry = submeshTable.emplace_back();
+			entry.Name = addString(submesh.Name);
+			entry.DiffuseTexture = addString(submesh.DiffuseTexture);
+			entry.NormalTexture = addString(submesh.NormalTexture);
+			entry.EmissiveTexture = addString(submesh.EmissiveTexture);
+			entry.FirstVertex = submesh.FirstVertex;
+			entry.VertexCount = submesh.VertexCount;
+			entry.FirstIndex = submesh.FirstIndex;
+			entry.IndexCount = submesh.IndexCount;
+			entry.BoundsMin = submesh.BoundingBox.Min;
+			entry.BoundsMax = submesh.BoundingBox.Max;
+		}
+
+		MeshFileHeader header{};
+		memcpy(header.Magic, s_MeshFileMagic, sizeof(header.Magic));
+		header.Version = s_MeshFileVersion;
+		header.VertexStride = sizeof(Vertex);
+		header.SubmeshCount = static_cast<uint32_t>(submeshTable.size());
+		header.SourceSize = std::filesystem::file_size(sourcePath);
+		header.SourceWriteTime = GetSourceWriteTime(sourcePath);
+		header.VertexCount = mesh.Vertices.size();
+		header.IndexCount = mesh.Indices.size();
+		header.SubmeshTableOffset = AlignOffset(sizeof(MeshFileHeader));
+		header.VertexOffset = AlignOffset(header.SubmeshTableOffset + submeshTable.size() * sizeof(MeshFileSubmesh));
+		header.IndexOffset = AlignOffset(header.VertexOffset + mesh.Vertices.size() * sizeof(Vertex));
+		header.StringTableOffset = AlignOffset(header.IndexOffset + mesh.Indices.size() * sizeof(uint32_t));
+		header.StringTableSize = stringTable.size();
+
+		std::vector<uint8_t> file(header.StringTableOffset + header.StringTableSize, 0);
+		memcpy(file.data(), &header, sizeof(MeshFileHeader));
+		if (!submeshTable.empty())
+			memcpy(file.data() + header.SubmeshTableOffset, submeshTable.data(), submeshTable.size() * sizeof(MeshFileSubmesh));
+		if (!mesh.Vertices.empty())
+			memcpy(file.data() + header.VertexOffset, mesh.Vertices.data(), mesh.Vertices.size() * sizeof(Vertex));
+		if (!mesh.Indices.empty())
+			memcpy(file.data() + header.IndexOffset, mesh.Indices.data(), mesh.Indices.size() * sizeof(uint32_t));
+		if (!stringTable.empty())
+			memcpy(file.data() + header.StringTableOffset, stringTable.data(), stringTable.size());
+
+		std::error_code error;
+		std::filesystem::create_directories(cookedPath.parent_path(), error);
+		return Filesystem::WriteFileBinary(cookedPath, file.data(), file.size());
+	}
+
 	Mesh::Mesh(const char* filepath)
 	{
 		ARC_PROFILE_SCOPE()
@@ -63,169 +341,270 @@ namespace ArcEngine
 	{
 		ARC_PROFILE_SCOPE()
 
+		if (const Ref<MeshSource> source = Decode(filepath))
+			Upload(*source);
+	}
+
+	Ref<MeshSource> Mesh::Decode(const char* filepath)
+	{
+		ARC_PROFILE_SCOPE()
+
 		std::filesystem::path path = filepath;
 
 		if (!std::filesystem::exists(path))
-			return;
+			return nullptr;
 
 		auto ext = path.extension();
-		bool supportedFile = ext == ".obj";
+		bool supportedFile = ext == ".obj" || ext == ".arcmesh";
 		if (!supportedFile)
 		{
 			ARC_CORE_ERROR("{} file(s) not supported: {}", ext, filepath);
-			return;
+			return nullptr;
 		}
 
-		if (ext == ".obj")
-		{
-			tinyobj::ObjReaderConfig reader_config;
-			tinyobj::ObjReader reader;
+		Ref<MeshSource> source = CreateRef<MeshSource>();
+		source->Filepath = filepath;
 
-			if (!reader.ParseFromFile(filepath, reader_config))
+		if (ext == ".arcmesh")
+		{
+			if (!DecodeCooked(*source, path, {}))
+			{
+				ARC_CORE_ERROR("Could not load cooked mesh: {}", filepath);
+				return nullptr;
+			}
+		}
+		else if (ext == ".obj")
+		{
+			// Import once, later loads map the cooked file and upload it directly
+			const std::filesystem::path cookedPath = GetCookedPath(path);
+			if (!DecodeCooked(*source, cookedPath, path))
 			{
-				if (!reader.Error().empty())
+				ImportedMesh& importedMesh = source->Imported;
+				if (!ImportObj(path, importedMesh))
+					return nullptr;
+
+				if (!WriteCookedMesh(cookedPath, path, importedMesh))
+					ARC_CORE_WARN("Could not write cooked mesh: {}", cookedPath);
+
+				for (const ImportedSubmesh& submesh : importedMesh.Submeshes)
 				{
-					ARC_CORE_ERROR("Could not import the file: {0}. Error: {1}", filepath, reader.Error());
-					return;
+					source->Submeshes.push_back({
+						submesh.Name,
+						submesh.DiffuseTexture,
+						submesh.NormalTexture,
+						submesh.EmissiveTexture,
+						{ importedMesh.Vertices.data() + submesh.FirstVertex, submesh.VertexCount },
+						{ importedMesh.Indices.data() + submesh.FirstIndex, submesh.IndexCount },
+						submesh.BoundingBox });
 				}
 			}
+		}
 
-			if (!reader.Warning().empty())
-				ARC_CORE_WARN("File: {0}. Warning: {1}", filepath, reader.Warning());
+		return source;
+	}
 
-			auto& attrib = reader.GetAttrib();
-			auto& shapes = reader.GetShapes();
-			auto& materials = reader.GetMaterials();
-			
-			// Loop over shapes
-			for (const auto& shape : shapes)
+	void Mesh::Upload(const MeshSource& source)
+	{
+		ARC_PROFILE_SCOPE()
+
+		m_Submeshes.clear();
+		m_Submeshes.reserve(source.Submeshes.size());
+		for (const SubmeshSource& submesh : source.Submeshes)
+			AddSubmesh(submesh);
+
+		m_Filepath = source.Filepath;
+		m_Name = StringUtils::GetName(source.Filepath);
+	}
+
+	std::filesystem::path Mesh::GetCookedPath(const std::filesystem::path& sourcePath)
+	{
+		std::error_code error;
+		const std::filesystem::path absolutePath = std::filesystem::weakly_canonical(sourcePath, error);
+		const size_t pathHash = std::hash<std::string>{}((error ? sourcePath : absolutePath).generic_string());
+
+		return std::filesystem::path(s_MeshCacheDirectory) / fmt::format("{}_{:016x}.arcmesh", sourcePath.stem().string(), pathHash);
+	}
+
+	// True if count elements of elementSize starting at offset lie within size, without wrapping around
+	static bool IsRangeInFile(uint64_t offset, uint64_t count, uint64_t elementSize, uint64_t size)
+	{
+		return offset <= size && count <= (size - offset) / elementSize;
+	}
+
+	static bool IsStringInTable(const MeshFileString& str, uint64_t stringTableSize)
+	{
+		return static_cast<uint64_t>(str.Offset) + str.Length <= stringTableSize;
+	}
+
+	static bool IsSubmeshValid(const MeshFileSubmesh& entry, const MeshFileHeader& header)
+	{
+		return entry.VertexCount <= header.VertexCount && entry.FirstVertex <= header.VertexCount - entry.VertexCount
+			&& entry.IndexCount <= header.IndexCount && entry.FirstIndex <= header.IndexCount - entry.IndexCount
+			&& IsStringInTable(entry.Name, header.StringTableSize)
+			&& IsStringInTable(entry.DiffuseTexture, header.StringTableSize)
+			&& IsStringInTable(entry.NormalTexture, header.StringTableSize)
+			&& IsStringInTable(entry.EmissiveTexture, header.StringTableSize);
+	}
+
+	// Checks everything DecodeCooked reads before any of it is used
+	static bool ReadCookedTables(const MappedFile& file, const std::filesystem::path& cookedPath, const std::filesystem::path& sourcePath,
+		MeshFileHeader& outHeader, std::vector<MeshFileSubmesh>& outSubmeshTable)
+	{
+		if (file.GetSize() < sizeof(MeshFileHeader))
+			return false;
+
+		MeshFileHeader& header = outHeader;
+		memcpy(&header, file.GetData(), sizeof(MeshFileHeader));
+
+		if (memcmp(header.Magic, s_MeshFileMagic, sizeof(header.Magic)) != 0 || header.Version != s_MeshFileVersion || header.VertexStride != sizeof(Vertex))
+			return false;
+
+		if (!sourcePath.empty())
+		{
+			std::error_code error;
+			if (header.SourceSize != std::filesystem::file_size(sourcePath, error) || header.SourceWriteTime != GetSourceWriteTime(sourcePath))
+				return false;
+		}
+
+		const uint64_t size = file.GetSize();
+		if (!IsRangeInFile(header.SubmeshTableOffset, header.SubmeshCount, sizeof(MeshFileSubmesh), size)
+			|| !IsRangeInFile(header.VertexOffset, header.VertexCount, sizeof(Vertex), size)
+			|| !IsRangeInFile(header.IndexOffset, header.IndexCount, sizeof(uint32_t), size)
+			|| !IsRangeInFile(header.StringTableOffset, header.StringTableSize, 1, size))
+		{
+			ARC_CORE_WARN("Cooked mesh is truncated: {}", cookedPath);
+			return false;
+		}
+
+		outSubmeshTable.resize(header.SubmeshCount);
+		memcpy(outSubmeshTable.data(), file.GetData() + header.SubmeshTableOffset, outSubmeshTable.size() * sizeof(MeshFileSubmesh));
+		for (const MeshFileSubmesh& entry : outSubmeshTable)
+		{
+			if (!IsSubmeshValid(entry, header))
 			{
-				std::vector<Vertex> vertices;
-				std::vector<uint32_t> indices;
-				std::unordered_map<Vertex, uint32_t> uniqueVertices{};
-
-				// Loop over faces(polygon)
-				int materialId = -1;
-				size_t index_offset = 0;
-				for (size_t f = 0; f < shape.mesh.num_face_vertices.size(); f++)
-				{
-					auto fv = static_cast<size_t>(shape.mesh.num_face_vertices[f]);
+				ARC_CORE_WARN("Cooked mesh is corrupt: {}", cookedPath);
+				return false;
+			}
+		}
 
-					// Loop over vertices in the face.
-					for (size_t v = 0; v < fv; v++)
-					{
-						// access to vertex
-						tinyobj::index_t idx = shape.mesh.indices[index_offset + v];
-
-						Vertex vertex;
-						vertex.Position.x = attrib.vertices[3 * static_cast<size_t>(idx.vertex_index) + 0];
-						vertex.Position.y = attrib.vertices[3 * static_cast<size_t>(idx.vertex_index) + 1];
-						vertex.Position.z = attrib.vertices[3 * static_cast<size_t>(idx.vertex_index) + 2];
-						if (idx.texcoord_index >= 0)
-						{
-							vertex.TexCoord.x = attrib.texcoords[2 * static_cast<size_t>(idx.texcoord_index) + 0];
-							vertex.TexCoord.y = attrib.texcoords[2 * static_cast<size_t>(idx.texcoord_index) + 1];
-						}
-						if (idx.normal_index >= 0)
-						{
-							vertex.Normal.x = attrib.normals[3 * static_cast<size_t>(idx.normal_index) + 0];
-							vertex.Normal.y = attrib.normals[3 * static_cast<size_t>(idx.normal_index) + 1];
-							vertex.Normal.z = attrib.normals[3 * static_cast<size_t>(idx.normal_index) + 2];
-						}
-
-						if (uniqueVertices.count(vertex) == 0)
-						{
-							uniqueVertices[vertex] = static_cast<uint32_t>(vertices.size());
-							vertices.push_back(vertex);
-						}
-
-						indices.push_back(uniqueVertices[vertex]);
-					}
-					index_offset += fv;
+		return true;
+	}
 
-					// per-face material
-					materialId = shape.mesh.material_ids[f];
-				}
+	// Returns false if the file is missing, corrupt, from another version or older than sourcePath.
+	// The submeshes point into the mapped file, which stays open for as long as the source lives.
+	bool Mesh::DecodeCooked(MeshSource& outSource, const std::filesystem::path& cookedPath, const std::filesystem::path& sourcePath)
+	{
+		ARC_PROFILE_SCOPE()
 
-				Ref<VertexArray> vertexArray = VertexArray::Create();
+		MappedFile& file = outSource.File;
+		if (!file.Open(cookedPath))
+			return false;
 
-				Ref<VertexBuffer> vertexBuffer = VertexBuffer::Create(reinterpret_cast<float*>(vertices.data()), (sizeof(Vertex) * vertices.size()));
-				vertexBuffer->SetLayout({
-					{ ShaderDataType::Float3, "a_Position" },
-					{ ShaderDataType::Float2, "a_TexCoord" },
-					{ ShaderDataType::Float3, "a_Normal" },
-					{ ShaderDataType::Float3, "a_Tangent" },
-					{ ShaderDataType::Float3, "a_Bitangent" },
-				});
-				vertexArray->AddVertexBuffer(vertexBuffer);
+		MeshFileHeader header;
+		std::vector<MeshFileSubmesh> submeshTable;
+		if (!ReadCookedTables(file, cookedPath, sourcePath, header, submeshTable))
+		{
+			// Unmapped, so that a fresh copy can be written over it
+			file.Close();
+			return false;
+		}
 
-				Ref<IndexBuffer> indexBuffer = IndexBuffer::Create(indices.data(), indices.size());
-				vertexArray->SetIndexBuffer(indexBuffer);
+		const uint64_t size = file.GetSize();
+		const auto* vertices = reinterpret_cast<const Vertex*>(file.GetData() + header.VertexOffset);
+		const auto* indices = reinterpret_cast<const uint32_t*>(file.GetData() + header.IndexOffset);
+		const std::string_view stringTable(reinterpret_cast<const char*>(file.GetData() + header.StringTableOffset), header.StringTableSize);
+		const auto getString = [&stringTable](const MeshFileString& str) { return stringTable.substr(str.Offset, str.Length); };
+
+		// Fault the pages in here, so that the upload does not end up reading the disk on the main thread
+		{
+			ARC_PROFILE_SCOPE("Prefetch Cooked Mesh")
+
+			constexpr uint64_t pageSize = 4096;
+			volatile uint8_t sink = 0;
+			for (uint64_t offset = 0; offset < size; offset += pageSize)
+				sink = sink + file.GetData()[offset];
+		}
+
+		outSource.Submeshes.reserve(submeshTable.size());
+		for (const MeshFileSubmesh& entry : submeshTable)
+		{
+			outSource.Submeshes.push_back({
+				getString(entry.Name),
+				getString(entry.DiffuseTexture),
+				getString(entry.NormalTexture),
+				getString(entry.EmissiveTexture),
+				{ vertices + entry.FirstVertex, entry.VertexCount },
+				{ indices + entry.FirstIndex, entry.IndexCount },
+				AABB(entry.BoundsMin, entry.BoundsMax) });
+		}
+
+		return true;
+	}
+
+	void Mesh::AddSubmesh(const SubmeshSource& source)
+	{
+		ARC_PROFILE_SCOPE()
 
-				const Submesh& submesh = m_Submeshes.emplace_back(shape.name, CreateRef<Material>(), vertexArray);
+		Ref<VertexArray> vertexArray = VertexArray::Create();
 
-				if (materialId >= 0)
+		Ref<VertexBuffer> vertexBuffer = VertexBuffer::Create(reinterpret_cast<const float*>(source.Vertices.data()), source.Vertices.size_bytes());
+		vertexBuffer->SetLayout({
+			{ ShaderDataType::Float3, "a_Position" },
+			{ ShaderDataType::Float2, "a_TexCoord" },
+			{ ShaderDataType::Float3, "a_Normal" },
+			{ ShaderDataType::Float3, "a_Tangent" },
+			{ ShaderDataType::Float3, "a_Bitangent" },
+		});
+		vertexArray->AddVertexBuffer(vertexBuffer);
+
+		Ref<IndexBuffer> indexBuffer = IndexBuffer::Create(source.Indices.data(), source.Indices.size());
+		vertexArray->SetIndexBuffer(indexBuffer);
+
+		m_BoundingBox = m_Submeshes.empty() ? source.BoundingBox : AABB::Merge(m_BoundingBox, source.BoundingBox);
+
+		const Submesh& submesh = m_Submeshes.emplace_back(std::string(source.Name), CreateRef<Material>(), vertexArray, source.BoundingBox);
+
+		if (source.DiffuseTexture.empty() && source.NormalTexture.empty() && source.EmissiveTexture.empty())
+			return;
+
+		const auto& materialProperties = submesh.Mat->GetShader()->GetMaterialProperties();
+		bool normalMapApplied = false;
+
+		for (const auto& [name, property] : materialProperties)
+		{
+			if (property.Type == MaterialPropertyType::Sampler2D)
+			{
+				auto slot = submesh.Mat->GetData<uint32_t>(name);
+
+				if (!source.DiffuseTexture.empty() &&
+					(name.find("albedo") != std::string::npos || name.find("Albedo") != std::string::npos ||
+						name.find("diff") != std::string::npos || name.find("Diff") != std::string::npos))
 				{
-					const auto& material = materials.at(materialId);
-					
-					
-					const auto& materialProperties = submesh.Mat->GetShader()->GetMaterialProperties();
-					bool normalMapApplied = false;
+					submesh.Mat->SetTexture(slot, AssetManager::GetTexture2D(std::string(source.DiffuseTexture)));
+				}
 
-					std::filesystem::path dir = path.parent_path();
+				if (!source.NormalTexture.empty() &&
+					(name.find("norm") != std::string::npos || name.find("Norm") != std::string::npos ||
+						name.find("height") != std::string::npos || name.find("Height") != std::string::npos))
+				{
+					submesh.Mat->SetTexture(slot, AssetManager::GetTexture2D(std::string(source.NormalTexture)));
+					normalMapApplied = true;
+				}
 
-					for (const auto& [name, property] : materialProperties)
-					{
-						if (property.Type == MaterialPropertyType::Sampler2D)
-						{
-							auto slot = submesh.Mat->GetData<uint32_t>(name);
-
-							if (!material.diffuse_texname.empty() &&
-								(name.find("albedo") != std::string::npos || name.find("Albedo") != std::string::npos ||
-									name.find("diff") != std::string::npos || name.find("Diff") != std::string::npos))
-							{
-								std::string pathStr = (dir / material.diffuse_texname).string();
-								submesh.Mat->SetTexture(slot, AssetManager::GetTexture2D(pathStr));
-							}
-
-							if (!material.normal_texname.empty() &&
-								(name.find("norm") != std::string::npos || name.find("Norm") != std::string::npos ||
-									name.find("height") != std::string::npos || name.find("Height") != std::string::npos))
-							{
-								std::string pathStr = (dir / material.normal_texname).string();
-								submesh.Mat->SetTexture(slot, AssetManager::GetTexture2D(pathStr));
-								normalMapApplied = true;
-							}
-							else if (!material.bump_texname.empty() &&
-								(name.find("norm") != std::string::npos || name.find("Norm") != std::string::npos ||
-									name.find("height") != std::string::npos || name.find("Height") != std::string::npos))
-							{
-								std::string pathStr = (dir / material.bump_texname).string();
-								submesh.Mat->SetTexture(slot, AssetManager::GetTexture2D(pathStr));
-								normalMapApplied = true;
-							}
-
-							if (!material.emissive_texname.empty() &&
-								(name.find("emissi") != std::string::npos || name.find("Emissi") != std::string::npos))
-							{
-								std::string pathStr = (dir / material.emissive_texname).string();
-								submesh.Mat->SetTexture(slot, AssetManager::GetTexture2D(pathStr));
-							}
-						}
-
-						if (property.Type == MaterialPropertyType::Bool && normalMapApplied &&
-							(name.find("norm") != std::string::npos || name.find("Norm") != std::string::npos ||
-								name.find("height") != std::string::npos || name.find("Height") != std::string::npos))
-						{
-							submesh.Mat->SetData(name, 1);
-						}
-					}
+				if (!source.EmissiveTexture.empty() &&
+					(name.find("emissi") != std::string::npos || name.find("Emissi") != std::string::npos))
+				{
+					submesh.Mat->SetTexture(slot, AssetManager::GetTexture2D(std::string(source.EmissiveTexture)));
 				}
 			}
-		}
 
-		m_Filepath = filepath;
-		m_Name = StringUtils::GetName(filepath);
+			if (property.Type == MaterialPropertyType::Bool && normalMapApplied &&
+				(name.find("norm") != std::string::npos || name.find("Norm") != std::string::npos ||
+					name.find("height") != std::string::npos || name.find("Height") != std::string::npos))
+			{
+				submesh.Mat->SetData(name, 1);
+			}
+		}
 	}
 
 	Submesh& Mesh::GetSubmesh(size_t index)
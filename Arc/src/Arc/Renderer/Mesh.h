@@ -1,5 +1,7 @@
 #pragma once
 
+#include "Arc/Utils/AABB.h"
+
 struct aiScene;
 struct aiNode;
 struct aiMesh;
@@ -8,15 +10,17 @@ namespace ArcEngine
 {
 	class VertexArray;
 	class Material;
+	struct MeshSource;
 
 	struct Submesh
 	{
 		std::string Name;
 		Ref<Material> Mat;
 		Ref<VertexArray> Geometry;
+		AABB BoundingBox;		// Object space
 
-		Submesh(const std::string& name, const Ref<Material>& material, const Ref<VertexArray>& geometry)
-			: Name(name), Mat(material), Geometry(geometry)
+		Submesh(const std::string& name, const Ref<Material>& material, const Ref<VertexArray>& geometry, const AABB& boundingBox = AABB())
+			: Name(name), Mat(material), Geometry(geometry), BoundingBox(boundingBox)
 		{
 		}
 	};
@@ -28,16 +32,35 @@ namespace ArcEngine
 		explicit Mesh(const char* filepath);
 		virtual ~Mesh() = default;
 
+		// Loads a .obj through its cooked copy in the mesh cache, or a cooked .arcmesh file directly
 		void Load(const char* filepath);
 
+		// Reads the file and builds the vertex data without touching the GPU, can run on any thread.
+		// Returns nullptr if the file could not be loaded.
+		[[nodiscard]] static Ref<MeshSource> Decode(const char* filepath);
+
+		// Creates the GPU resources of a decoded mesh, replacing the current submeshes
+		void Upload(const MeshSource& source);
+
 		[[nodiscard]] Submesh& GetSubmesh(size_t index);
 		[[nodiscard]] size_t GetSubmeshCount() const { return m_Submeshes.size(); }
 		[[nodiscard]] const char* GetName() const { return m_Name.c_str(); }
 		[[nodiscard]] const char* GetFilepath() const { return m_Filepath.c_str(); }
+		[[nodiscard]] const AABB& GetBoundingBox() const { return m_BoundingBox; }
+
+		[[nodiscard]] static std::filesystem::path GetCookedPath(const std::filesystem::path& sourcePath);
+
+	private:
+		friend struct MeshSource;
+		struct SubmeshSource;
+
+		static bool DecodeCooked(MeshSource& outSource, const std::filesystem::path& cookedPath, const std::filesystem::path& sourcePath);
+		void AddSubmesh(const SubmeshSource& source);
 
 	private:
 		std::string m_Name;
 		std::string m_Filepath;
 		std::vector<Submesh> m_Submeshes;
+		AABB m_BoundingBox;
 	};
 }
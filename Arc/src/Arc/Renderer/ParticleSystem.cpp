@@ -3,17 +3,31 @@
 
 #include <glm/gtx/norm.hpp>
 
+#include "Arc/Core/JobSystem.h"
 #include "Arc/Renderer/Renderer2D.h"
 
 namespace ArcEngine
 {
 	ParticleSystem::ParticleSystem()
-		: m_Particles(10000)
 	{
 		if (m_Properties.PlayOnAwake)
 			Play();
 	}
 
+	ParticleSystem::ParticleSystem(const ParticleProperties& properties)
+		: m_Properties(properties)
+	{
+		if (m_Properties.PlayOnAwake)
+			Play();
+	}
+
+	Ref<ParticleSystem> ParticleSystem::Clone() const
+	{
+		ARC_PROFILE_SCOPE()
+
+		return CreateRef<ParticleSystem>(m_Properties);
+	}
+
 	void ParticleSystem::Play()
 	{
 		m_SystemTime = 0.0f;
@@ -23,10 +37,7 @@ namespace ArcEngine
 	void ParticleSystem::Stop(bool force)
 	{
 		if (force)
-		{
-			for (auto& particle : m_Particles)
-				particle.LifeRemaining = 0.0f;
-		}
+			m_ActiveParticleCount = 0;
 
 		m_SystemTime = m_Properties.StartDelay + m_Properties.Duration;
 		m_Playing = false;
@@ -36,6 +47,9 @@ namespace ArcEngine
 	{
 		ARC_PROFILE_SCOPE()
 
+		if (m_Capacity != m_Properties.MaxParticles)
+			Resize(m_Properties.MaxParticles);
+
 		const float simTs = ts * m_Properties.SimulationSpeed;
 
 		if (m_Playing && !m_Properties.Looping)
@@ -66,97 +80,210 @@ namespace ArcEngine
 				Emit(position, m_Properties.BurstCount);
 			}
 		}
-		
+
+		// Age and remove dead particles
+		{
+			ARC_PROFILE_SCOPE("Age")
+
+			float* lifeRemaining = m_Particles.LifeRemaining.data();
+			for (uint32_t i = 0; i < m_ActiveParticleCount; ++i)
+				lifeRemaining[i] -= simTs;
+
+			for (uint32_t i = 0; i < m_ActiveParticleCount;)
+			{
+				if (lifeRemaining[i] <= 0.0f)
+					Kill(i);
+				else
+					++i;
+			}
+		}
+
 		// Simulate
-		m_ActiveParticleCount = 0;
-		for (auto& particle : m_Particles)
+		const uint32_t count = m_ActiveParticleCount;
+		if (count < ParallelSimulationThreshold)
 		{
-			if (particle.LifeRemaining <= 0.0f)
-				continue;
-
-			particle.LifeRemaining -= simTs;
-
-			const float t = glm::clamp(particle.LifeRemaining / m_Properties.StartLifetime, 0.0f, 1.0f);
-			
-			glm::vec3 velocity = m_Properties.StartVelocity;
-			if (m_Properties.VelocityOverLifetime.Enabled)
-				velocity *= m_Properties.VelocityOverLifetime.Evaluate(t);
-
-			glm::vec3 force(0.0f);
-			if (m_Properties.ForceOverLifetime.Enabled)
-				force = m_Properties.ForceOverLifetime.Evaluate(t);
-
-			force.y += m_Properties.GravityModifier * -9.8f;
-			velocity += force * simTs;
-
-			const float velocityMagnitude = glm::length(velocity);
-			
-			// Color
-			particle.Color = m_Properties.StartColor;
-			if (m_Properties.ColorOverLifetime.Enabled)
-				particle.Color *= m_Properties.ColorOverLifetime.Evaluate(t);
-			if (m_Properties.ColorBySpeed.Enabled)
-				particle.Color *= m_Properties.ColorBySpeed.Evaluate(velocityMagnitude);
-
-			// Size
-			particle.Size = m_Properties.StartSize;
-			if (m_Properties.SizeOverLifetime.Enabled)
-				particle.Size *= m_Properties.SizeOverLifetime.Evaluate(t);
-			if (m_Properties.SizeBySpeed.Enabled)
-				particle.Size *= m_Properties.SizeBySpeed.Evaluate(velocityMagnitude);
-
-			// Rotation
-			particle.Rotation = m_Properties.StartRotation;
-			if (m_Properties.RotationOverLifetime.Enabled)
-				particle.Rotation += m_Properties.RotationOverLifetime.Evaluate(t);
-			if (m_Properties.RotationBySpeed.Enabled)
-				particle.Rotation += m_Properties.RotationBySpeed.Evaluate(velocityMagnitude);
-
-			particle.Position += velocity * simTs;
-			++m_ActiveParticleCount;
+			Simulate(0, count, simTs);
+			return;
 		}
+
+		JobSystem::ParallelFor(count, ParallelSimulationThreshold / 2, [this, simTs](uint32_t begin, uint32_t end) { Simulate(begin, end, simTs); });
 	}
 
 	void ParticleSystem::OnRender() const
 	{
 		ARC_PROFILE_SCOPE()
 
-		for (const auto& particle : m_Particles)
+		for (uint32_t i = 0; i < m_ActiveParticleCount; ++i)
+		{
+			const glm::vec3 position = { m_Particles.PositionX[i], m_Particles.PositionY[i], m_Particles.PositionZ[i] };
+			glm::mat4 transform = glm::translate(glm::mat4(1.0f), position) * glm::mat4(glm::quat(m_Particles.Rotation[i])) * glm::scale(glm::mat4(1.0f), m_Particles.Size[i]);
+			Renderer2D::DrawQuad(transform, m_Properties.Texture, m_Particles.Color[i]);
+		}
+	}
+
+	void ParticleSystem::Emit(const glm::vec3& position, uint32_t count)
+	{
+		ARC_PROFILE_SCOPE()
+
+		count = glm::min(count, m_Capacity - m_ActiveParticleCount);
+		for (uint32_t i = 0; i < count; ++i)
 		{
-			if (particle.LifeRemaining <= 0.0f)
-				continue;
+			const uint32_t index = m_ActiveParticleCount++;
 
-			glm::mat4 transform = glm::translate(glm::mat4(1.0f), particle.Position) * glm::mat4(glm::quat(particle.Rotation)) * glm::scale(glm::mat4(1.0f), particle.Size);
-			Renderer2D::DrawQuad(transform, m_Properties.Texture, particle.Color);
+			m_Particles.PositionX[index] = position.x + RandomFloat(m_Properties.PositionStart.x, m_Properties.PositionEnd.x);
+			m_Particles.PositionY[index] = position.y + RandomFloat(m_Properties.PositionStart.y, m_Properties.PositionEnd.y);
+			m_Particles.PositionZ[index] = position.z + RandomFloat(m_Properties.PositionStart.z, m_Properties.PositionEnd.z);
+			m_Particles.LifeRemaining[index] = m_Properties.StartLifetime;
 		}
 	}
 
-	static float RandomFloat(float min, float max)
+	void ParticleSystem::Resize(uint32_t capacity)
 	{
-		const float r = static_cast<float>(std::rand()) / static_cast<float>(RAND_MAX);
-		return min + r * (max - min);
+		ARC_PROFILE_SCOPE()
+
+		m_Capacity = capacity;
+		m_ActiveParticleCount = glm::min(m_ActiveParticleCount, capacity);
+
+		m_Particles.PositionX.resize(capacity);
+		m_Particles.PositionY.resize(capacity);
+		m_Particles.PositionZ.resize(capacity);
+		m_Particles.LifeRemaining.resize(capacity);
+		m_Particles.Color.resize(capacity);
+		m_Particles.Size.resize(capacity);
+		m_Particles.Rotation.resize(capacity);
 	}
 
-	void ParticleSystem::Emit(const glm::vec3& position, uint32_t count)
+	void ParticleSystem::Kill(uint32_t index)
+	{
+		const uint32_t last = --m_ActiveParticleCount;
+		if (index == last)
+			return;
+
+		m_Particles.PositionX[index] = m_Particles.PositionX[last];
+		m_Particles.PositionY[index] = m_Particles.PositionY[last];
+		m_Particles.PositionZ[index] = m_Particles.PositionZ[last];
+		m_Particles.LifeRemaining[index] = m_Particles.LifeRemaining[last];
+		m_Particles.Color[index] = m_Particles.Color[last];
+		m_Particles.Size[index] = m_Particles.Size[last];
+		m_Particles.Rotation[index] = m_Particles.Rotation[last];
+	}
+
+	// Updates the particles in [begin, end). Only touches that range so it can run on any thread.
+	void ParticleSystem::Simulate(uint32_t begin, uint32_t end, float simTs)
 	{
 		ARC_PROFILE_SCOPE()
 
-		if (m_ActiveParticleCount >= m_Properties.MaxParticles)
+		if (begin >= end)
 			return;
 
-		for (uint32_t i = 0; i < count; ++i)
+		const ParticleProperties& props = m_Properties;
+		const float invLifetime = props.StartLifetime > 0.0f ? 1.0f / props.StartLifetime : 0.0f;
+		const glm::vec3 gravity = glm::vec3(0.0f, props.GravityModifier * -9.8f, 0.0f);
+
+		float* positionX = m_Particles.PositionX.data();
+		float* positionY = m_Particles.PositionY.data();
+		float* positionZ = m_Particles.PositionZ.data();
+		const float* lifeRemaining = m_Particles.LifeRemaining.data();
+
+		const auto velocityAt = [&](float t)
+		{
+			glm::vec3 velocity = props.StartVelocity;
+			if (props.VelocityOverLifetime.Enabled)
+				velocity *= props.VelocityOverLifetime.Evaluate(t);
+
+			glm::vec3 force = gravity;
+			if (props.ForceOverLifetime.Enabled)
+				force += props.ForceOverLifetime.Evaluate(t);
+
+			return velocity + force * simTs;
+		};
+
+		// Position, the velocity is the same for every particle unless it depends on the lifetime
+		const bool varyingVelocity = props.VelocityOverLifetime.Enabled || props.ForceOverLifetime.Enabled;
+		if (!varyingVelocity)
+		{
+			const glm::vec3 step = velocityAt(0.0f) * simTs;
+			for (uint32_t i = begin; i < end; ++i)
+				positionX[i] += step.x;
+			for (uint32_t i = begin; i < end; ++i)
+				positionY[i] += step.y;
+			for (uint32_t i = begin; i < end; ++i)
+				positionZ[i] += step.z;
+		}
+		else
+		{
+			for (uint32_t i = begin; i < end; ++i)
+			{
+				const glm::vec3 step = velocityAt(glm::clamp(lifeRemaining[i] * invLifetime, 0.0f, 1.0f)) * simTs;
+				positionX[i] += step.x;
+				positionY[i] += step.y;
+				positionZ[i] += step.z;
+			}
+		}
+
+		// Appearance, filled with the start values when no module changes it per particle
+		glm::vec4* color = m_Particles.Color.data();
+		glm::vec3* size = m_Particles.Size.data();
+		glm::vec3* rotation = m_Particles.Rotation.data();
+
+		const bool colorModules = props.ColorOverLifetime.Enabled || props.ColorBySpeed.Enabled;
+		const bool sizeModules = props.SizeOverLifetime.Enabled || props.SizeBySpeed.Enabled;
+		const bool rotationModules = props.RotationOverLifetime.Enabled || props.RotationBySpeed.Enabled;
+		const bool bySpeed = props.ColorBySpeed.Enabled || props.SizeBySpeed.Enabled || props.RotationBySpeed.Enabled;
+
+		if (!colorModules)
+			std::fill(color + begin, color + end, props.StartColor);
+		if (!sizeModules)
+			std::fill(size + begin, size + end, props.StartSize);
+		if (!rotationModules)
+			std::fill(rotation + begin, rotation + end, props.StartRotation);
+
+		if (!colorModules && !sizeModules && !rotationModules)
+			return;
+
+		const float constantSpeed = glm::length(velocityAt(0.0f));
+		for (uint32_t i = begin; i < end; ++i)
 		{
-			if (++m_PoolIndex >= 10000)
-				m_PoolIndex = 0;
+			const float t = glm::clamp(lifeRemaining[i] * invLifetime, 0.0f, 1.0f);
+			const float speed = bySpeed && varyingVelocity ? glm::length(velocityAt(t)) : constantSpeed;
+
+			if (colorModules)
+			{
+				color[i] = props.StartColor;
+				if (props.ColorOverLifetime.Enabled)
+					color[i] *= props.ColorOverLifetime.Evaluate(t);
+				if (props.ColorBySpeed.Enabled)
+					color[i] *= props.ColorBySpeed.Evaluate(speed);
+			}
 
-			auto& particle = m_Particles[m_PoolIndex];
-			
-			particle.Position = position;
-			particle.Position.x += RandomFloat(m_Properties.PositionStart.x, m_Properties.PositionEnd.x);
-			particle.Position.y += RandomFloat(m_Properties.PositionStart.y, m_Properties.PositionEnd.y);
-			particle.Position.z += RandomFloat(m_Properties.PositionStart.z, m_Properties.PositionEnd.z);
+			if (sizeModules)
+			{
+				size[i] = props.StartSize;
+				if (props.SizeOverLifetime.Enabled)
+					size[i] *= props.SizeOverLifetime.Evaluate(t);
+				if (props.SizeBySpeed.Enabled)
+					size[i] *= props.SizeBySpeed.Evaluate(speed);
+			}
 
-			particle.LifeRemaining = m_Properties.StartLifetime;
+			if (rotationModules)
+			{
+				rotation[i] = props.StartRotation;
+				if (props.RotationOverLifetime.Enabled)
+					rotation[i] += props.RotationOverLifetime.Evaluate(t);
+				if (props.RotationBySpeed.Enabled)
+					rotation[i] += props.RotationBySpeed.Evaluate(speed);
+			}
 		}
 	}
+
+	// xorshift32, std::rand is not thread safe and much slower
+	float ParticleSystem::RandomFloat(float min, float max)
+	{
+		m_RandomState ^= m_RandomState << 13;
+		m_RandomState ^= m_RandomState >> 17;
+		m_RandomState ^= m_RandomState << 5;
+
+		const float r = static_cast<float>(m_RandomState >> 8) * (1.0f / static_cast<float>(1u << 24));
+		return min + r * (max - min);
+	}
 }
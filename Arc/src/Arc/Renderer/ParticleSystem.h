@@ -9,15 +9,6 @@ namespace ArcEngine
 {
 	class Texture2D;
 
-	struct Particle
-	{
-		glm::vec3 Position = glm::vec3(0.0f);
-		glm::vec3 Rotation = glm::vec3(0.0f);
-		glm::vec3 Size = glm::vec3(1.0f);
-		glm::vec4 Color = glm::vec4(1.0f);
-		float LifeRemaining = 0.0f;
-	};
-
 	template<typename T>
 	struct OverLifetimeModule
 	{
@@ -35,7 +26,7 @@ namespace ArcEngine
 		{
 		}
 
-		[[nodiscard]] T Evaluate(float factor)
+		[[nodiscard]] T Evaluate(float factor) const
 		{
 			return glm::lerp(End, Start, factor);
 		}
@@ -60,7 +51,7 @@ namespace ArcEngine
 		{
 		}
 
-		[[nodiscard]] T Evaluate(float speed)
+		[[nodiscard]] T Evaluate(float speed) const
 		{
 			float factor = Math::InverseLerpClamped(MinSpeed, MaxSpeed, speed);
 			return glm::lerp(End, Start, factor);
@@ -105,7 +96,15 @@ namespace ArcEngine
 	class ParticleSystem
 	{
 	public:
+		// Live particles above which the simulation is split across the job system
+		static constexpr uint32_t ParallelSimulationThreshold = 16384;
+
+		// Particle storage is allocated on the first update
 		ParticleSystem();
+		explicit ParticleSystem(const ParticleProperties& properties);
+
+		// New system with the same properties and no live particles
+		[[nodiscard]] Ref<ParticleSystem> Clone() const;
 
 		void Play();
 		void Stop(bool force = false);
@@ -119,10 +118,27 @@ namespace ArcEngine
 
 	private:
 		void Emit(const glm::vec3& position, uint32_t count = 1);
+		void Resize(uint32_t capacity);
+		void Kill(uint32_t index);
+		void Simulate(uint32_t begin, uint32_t end, float simTs);
+		[[nodiscard]] float RandomFloat(float min, float max);
 
 	private:
-		std::vector<Particle> m_Particles;
-		uint32_t m_PoolIndex = 0;
+		// Structure of arrays, only the first m_ActiveParticleCount entries are alive.
+		// Dead particles are swapped with the last live one so the live range stays packed.
+		struct ParticleData
+		{
+			std::vector<float> PositionX;
+			std::vector<float> PositionY;
+			std::vector<float> PositionZ;
+			std::vector<float> LifeRemaining;
+			std::vector<glm::vec4> Color;
+			std::vector<glm::vec3> Size;
+			std::vector<glm::vec3> Rotation;
+		};
+
+		ParticleData m_Particles;
+		uint32_t m_Capacity = 0;
 		ParticleProperties m_Properties;
 
 		float m_SystemTime = 0.0f;
@@ -133,6 +149,8 @@ namespace ArcEngine
 		uint32_t m_ActiveParticleCount = 0;
 		bool m_Playing = false;
 
+		uint32_t m_RandomState = 0x9E3779B9u;
+
 		friend class Renderer2D;
 	};
 }
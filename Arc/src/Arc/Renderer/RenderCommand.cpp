@@ -4,4 +4,5 @@
 namespace ArcEngine
 {
 	Scope<RendererAPI> RenderCommand::s_RendererAPI = RendererAPI::Create();
+	RendererAPI::API RenderCommand::s_RendererAPIType = RendererAPI::GetAPI();
 }
@@ -8,6 +8,11 @@ namespace ArcEngine
 	public:
 		inline static void Init()
 		{
+			if (!s_RendererAPI || s_RendererAPIType != RendererAPI::GetAPI())
+			{
+				s_RendererAPI = RendererAPI::Create();
+				s_RendererAPIType = RendererAPI::GetAPI();
+			}
 			s_RendererAPI->Init();
 		}
 		
@@ -31,6 +36,11 @@ namespace ArcEngine
 			s_RendererAPI->DrawIndexed(vertexArray, indexCount);
 		}
 
+		inline static void DrawIndexedInstanced(const Ref<VertexArray>& vertexArray, uint32_t instanceCount, uint32_t indexCount = 0)
+		{
+			s_RendererAPI->DrawIndexedInstanced(vertexArray, instanceCount, indexCount);
+		}
+
 		inline static void Draw(const Ref<VertexArray>& vertexArray, uint32_t count)
 		{
 			s_RendererAPI->Draw(vertexArray, count);
@@ -77,5 +87,6 @@ namespace ArcEngine
 		}
 	private:
 		static Scope<RendererAPI> s_RendererAPI;
+		static RendererAPI::API s_RendererAPIType;
 	};
 }
@@ -0,0 +1,85 @@
+#include "arcpch.h"
+#include "RenderQueue.h"
+
+namespace ArcEngine
+{
+	static constexpr uint32_t s_RadixBits = 8;
+	static constexpr uint32_t s_RadixBuckets = 1u << s_RadixBits;
+	static constexpr uint32_t s_RadixPasses = sizeof(uint64_t) * 8 / s_RadixBits;
+
+	void RenderQueue::Clear()
+	{
+		m_Commands.clear();
+		m_ResourceIDs.clear();
+	}
+
+	void RenderQueue::Reserve(size_t count)
+	{
+		m_Commands.reserve(count);
+		m_Scratch.reserve(count);
+	}
+
+	// LSD radix sort, stable so equal keys keep their submission order
+	void RenderQueue::Sort()
+	{
+		ARC_PROFILE_SCOPE()
+
+		const size_t count = m_Commands.size();
+		if (count < 2)
+			return;
+
+		// Histograms for all the digits in a single read of the keys
+		std::array<std::array<uint32_t, s_RadixBuckets>, s_RadixPasses> histograms{};
+		for (const Command& command : m_Commands)
+		{
+			for (uint32_t pass = 0; pass < s_RadixPasses; ++pass)
+				++histograms[pass][(command.Key >> (pass * s_RadixBits)) & (s_RadixBuckets - 1)];
+		}
+
+		m_Scratch.resize(count);
+		for (uint32_t pass = 0; pass < s_RadixPasses; ++pass)
+		{
+			std::array<uint32_t, s_RadixBuckets>& histogram = histograms[pass];
+
+			// Every key has the same digit, nothing to reorder
+			const uint32_t shift = pass * s_RadixBits;
+			if (histogram[(m_Commands[0].Key >> shift) & (s_RadixBuckets - 1)] == count)
+				continue;
+
+			uint32_t offset = 0;
+			for (uint32_t& bucket : histogram)
+			{
+				const uint32_t bucketCount = bucket;
+				bucket = offset;
+				offset += bucketCount;
+			}
+
+			for (const Command& command : m_Commands)
+				m_Scratch[histogram[(command.Key >> shift) & (s_RadixBuckets - 1)]++] = command;
+
+			m_Commands.swap(m_Scratch);
+		}
+	}
+
+	uint32_t RenderQueue::GetResourceID(const void* resource)
+	{
+		const auto [it, inserted] = m_ResourceIDs.try_emplace(resource, static_cast<uint32_t>(m_ResourceIDs.size()));
+		return it->second;
+	}
+
+	uint64_t RenderQueue::MakeKey(Pass pass, uint32_t shader, uint32_t material, uint32_t vertexArray, uint32_t cullMode, float depth)
+	{
+		// The bit pattern of a positive float increases with its value, so the upper bits make an ordered depth
+		uint32_t depthBits;
+		depth = glm::max(depth, 0.0f);
+		memcpy(&depthBits, &depth, sizeof(uint32_t));
+
+		// Ids that overflow their field only lose the grouping, the draw loop still compares the real resources
+		return (static_cast<uint64_t>(pass) & 0xF) << 60
+			| (static_cast<uint64_t>(shader) & 0x3FF) << 50
+			| (static_cast<uint64_t>(material) & 0xFFFF) << 34
+			| (static_cast<uint64_t>(vertexArray) & 0xFFFF) << 18
+			| (static_cast<uint64_t>(cullMode) & 0x3) << 16
+			| static_cast<uint64_t>(depthBits >> 16);
+	}
+}
@@ -0,0 +1,39 @@
+#pragma once
+
+namespace ArcEngine
+{
+	// Draws ordered by a 64 bit sort key so that draws sharing a shader, material and vertex array end up
+	// next to each other and the state between them does not need to be set again.
+	// Key layout, most significant bits first:
+	//   pass (4) | shader (10) | material (16) | vertex array (16) | cull mode (2) | depth (16)
+	class RenderQueue
+	{
+	public:
+		enum class Pass : uint8_t { Shadow = 0, Geometry };
+
+		struct Command
+		{
+			uint64_t Key;
+			uint32_t Index;			// Index of the draw in the caller's array
+		};
+
+		void Clear();
+		void Reserve(size_t count);
+		void Push(uint64_t key, uint32_t index) { m_Commands.push_back({ key, index }); }
+		void Sort();
+
+		[[nodiscard]] const std::vector<Command>& GetCommands() const { return m_Commands; }
+		[[nodiscard]] size_t GetSize() const { return m_Commands.size(); }
+
+		// Small id of a resource that is stable until the next Clear, in first use order
+		[[nodiscard]] uint32_t GetResourceID(const void* resource);
+
+		// depth is the view distance, only its ordering is kept
+		[[nodiscard]] static uint64_t MakeKey(Pass pass, uint32_t shader, uint32_t material, uint32_t vertexArray, uint32_t cullMode, float depth);
+
+	private:
+		std::vector<Command> m_Commands;
+		std::vector<Command> m_Scratch;
+		std::unordered_map<const void*, uint32_t> m_ResourceIDs;
+	};
+}
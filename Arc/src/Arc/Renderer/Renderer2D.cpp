@@ -11,14 +11,7 @@
 
 namespace ArcEngine
 {
-	struct QuadVertex
-	{
-		glm::vec3 Position;
-		glm::vec4 Color;
-		glm::vec2 TexCoord;
-		float TexIndex;
-		float TilingFactor;
-	};
+	using QuadVertex = Renderer2D::QuadVertex;
 
 	struct LineVertex
 	{
@@ -254,38 +247,30 @@ namespace ArcEngine
 		s_Data.Stats.QuadCount++;
 	}
 
-	void Renderer2D::DrawQuad(const glm::mat4& transform, const Ref<Texture2D>& texture, const glm::vec4& tintColor, float tilingFactor)
+	float Renderer2D::GetTextureIndex(const Ref<Texture2D>& texture)
 	{
-		ARC_PROFILE_SCOPE()
-		
-		float textureIndex = 0.0f;
+		if (!texture)
+			return 0.0f;
 
-		if(texture)
+		// Sprites mostly share a handful of textures, comparing pointers is enough to find them
+		for (uint32_t i = 1; i < s_Data.TextureSlotIndex; i++)
 		{
-			for (uint32_t i = 1; i < s_Data.TextureSlotIndex; i++)
-			{
-				if(*s_Data.TextureSlots[i] == *texture)
-				{
-					textureIndex = static_cast<float>(i);
-					break;
-				}
-			}
-
-			if(textureIndex == 0.0f)
-			{
-				if(s_Data.QuadIndexCount >= Renderer2DData::MaxIndices)
-					NextBatch();
-				
-				textureIndex = static_cast<float>(s_Data.TextureSlotIndex);
-				s_Data.TextureSlots[s_Data.TextureSlotIndex] = texture;
-				s_Data.TextureSlotIndex++;
-			}
+			if (s_Data.TextureSlots[i].get() == texture.get())
+				return static_cast<float>(i);
 		}
 
-		constexpr size_t quadVertexCount = 4;
-		constexpr glm::vec2 textureCoords[] = { { 0.0f, 0.0f }, { 1.0f, 0.0f }, { 1.0f, 1.0f }, { 0.0f, 1.0f } };
+		if (s_Data.TextureSlotIndex >= Renderer2DData::MaxTextureSlots)
+			NextBatch();
 
-		for (size_t i = 0; i < quadVertexCount; i++)
+		const auto textureIndex = static_cast<float>(s_Data.TextureSlotIndex);
+		s_Data.TextureSlots[s_Data.TextureSlotIndex] = texture;
+		s_Data.TextureSlotIndex++;
+		return textureIndex;
+	}
+
+	static void SubmitQuad(const glm::mat4& transform, float textureIndex, const glm::vec2 (&textureCoords)[4], const glm::vec4& tintColor, float tilingFactor)
+	{
+		for (size_t i = 0; i < 4; i++)
 		{
 			s_Data.QuadVertexBufferPtr->Position = transform * Renderer2DData::QuadVertexPositions[i];
 			s_Data.QuadVertexBufferPtr->Color = tintColor;
@@ -300,10 +285,82 @@ namespace ArcEngine
 		s_Data.Stats.QuadCount++;
 	}
 
+	void Renderer2D::DrawQuad(const glm::mat4& transform, const Ref<Texture2D>& texture, const glm::vec4& tintColor, float tilingFactor)
+	{
+		ARC_PROFILE_SCOPE()
+
+		constexpr glm::vec2 textureCoords[] = { { 0.0f, 0.0f }, { 1.0f, 0.0f }, { 1.0f, 1.0f }, { 0.0f, 1.0f } };
+
+		if (s_Data.QuadIndexCount >= Renderer2DData::MaxIndices)
+			NextBatch();
+
+		SubmitQuad(transform, GetTextureIndex(texture), textureCoords, tintColor, tilingFactor);
+	}
+
+	void Renderer2D::DrawQuad(const glm::mat4& transform, const Ref<Texture2D>& texture, const glm::vec4& uvRect, const glm::vec4& tintColor)
+	{
+		ARC_PROFILE_SCOPE()
+
+		const glm::vec2 uvMin = { uvRect.x, uvRect.y };
+		const glm::vec2 uvMax = uvMin + glm::vec2(uvRect.z, uvRect.w);
+		const glm::vec2 textureCoords[] = { { uvMin.x, uvMin.y }, { uvMax.x, uvMin.y }, { uvMax.x, uvMax.y }, { uvMin.x, uvMax.y } };
+
+		if (s_Data.QuadIndexCount >= Renderer2DData::MaxIndices)
+			NextBatch();
+
+		SubmitQuad(transform, GetTextureIndex(texture), textureCoords, tintColor, 1.0f);
+	}
+
+	void Renderer2D::BuildQuad(const glm::mat4& transform, const glm::vec4& uvRect, const glm::vec4& color, float tilingFactor, std::span<QuadVertex, 4> outVertices)
+	{
+		const glm::vec2 uvMin = { uvRect.x, uvRect.y };
+		const glm::vec2 uvMax = uvMin + glm::vec2(uvRect.z, uvRect.w);
+		const glm::vec2 textureCoords[] = { { uvMin.x, uvMin.y }, { uvMax.x, uvMin.y }, { uvMax.x, uvMax.y }, { uvMin.x, uvMax.y } };
+
+		for (size_t i = 0; i < 4; i++)
+		{
+			outVertices[i].Position = transform * Renderer2DData::QuadVertexPositions[i];
+			outVertices[i].Color = color;
+			outVertices[i].TexCoord = textureCoords[i];
+			outVertices[i].TexIndex = 0.0f;
+			outVertices[i].TilingFactor = tilingFactor;
+		}
+	}
+
+	void Renderer2D::DrawQuads(std::span<const QuadVertex> vertices, const Ref<Texture2D>& texture)
+	{
+		ARC_PROFILE_SCOPE()
+
+		ARC_CORE_ASSERT(vertices.size() % 4 == 0, "Quads need four vertices each")
+
+		size_t firstVertex = 0;
+		while (firstVertex < vertices.size())
+		{
+			if (s_Data.QuadIndexCount >= Renderer2DData::MaxIndices)
+				NextBatch();
+
+			const float textureIndex = GetTextureIndex(texture);
+			const size_t quadCount = glm::min((vertices.size() - firstVertex) / 4, static_cast<size_t>((Renderer2DData::MaxIndices - s_Data.QuadIndexCount) / 6));
+
+			// Already transformed, only the texture slot differs from batch to batch
+			memcpy(s_Data.QuadVertexBufferPtr, vertices.data() + firstVertex, quadCount * 4 * sizeof(QuadVertex));
+			for (size_t i = 0; i < quadCount * 4; i++)
+				s_Data.QuadVertexBufferPtr[i].TexIndex = textureIndex;
+
+			s_Data.QuadVertexBufferPtr += quadCount * 4;
+			s_Data.QuadIndexCount += static_cast<uint32_t>(quadCount * 6);
+			s_Data.Stats.QuadCount += static_cast<uint32_t>(quadCount);
+			firstVertex += quadCount * 4;
+		}
+	}
+
 	void Renderer2D::DrawLine(const glm::vec3& p0, const glm::vec3& p1, const glm::vec4& color)
 	{
 		ARC_PROFILE_SCOPE()
 
+		if (s_Data.LineVertexCount + 2 > Renderer2DData::MaxVertices)
+			NextBatch();
+
 		s_Data.LineVertexBufferPtr->Position = p0;
 		s_Data.LineVertexBufferPtr->Color = color;
 		s_Data.LineVertexBufferPtr++;
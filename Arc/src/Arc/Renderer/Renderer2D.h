@@ -1,5 +1,7 @@
 #pragma once
 
+#include <span>
+
 namespace ArcEngine
 {
 	class Texture2D;
@@ -8,6 +10,15 @@ namespace ArcEngine
 	class Renderer2D
 	{
 	public:
+		struct QuadVertex
+		{
+			glm::vec3 Position;
+			glm::vec4 Color;
+			glm::vec2 TexCoord;
+			float TexIndex;
+			float TilingFactor;
+		};
+
 		static void Init();
 		static void Shutdown();
 		
@@ -21,6 +32,13 @@ namespace ArcEngine
 
 		static void DrawQuad(const glm::mat4& transform, const glm::vec4& color);
 		static void DrawQuad(const glm::mat4& transform, const Ref<Texture2D>& texture = nullptr, const glm::vec4& tintColor = glm::vec4(1.0f), float tilingFactor = 1.0f);
+		// Part of a texture, like a sprite in an atlas. uvRect xy: offset, zw: scale in texture coordinates
+		static void DrawQuad(const glm::mat4& transform, const Ref<Texture2D>& texture, const glm::vec4& uvRect, const glm::vec4& tintColor);
+
+		// World space vertices of a quad, for callers that keep transformed quads around. TexIndex is set when they are drawn.
+		static void BuildQuad(const glm::mat4& transform, const glm::vec4& uvRect, const glm::vec4& color, float tilingFactor, std::span<QuadVertex, 4> outVertices);
+		// Quads made by BuildQuad, four vertices each, that all sample the texture
+		static void DrawQuads(std::span<const QuadVertex> vertices, const Ref<Texture2D>& texture);
 
 		static void DrawLine(const glm::vec3& p0, const glm::vec3& p1, const glm::vec4& color);
 
@@ -43,6 +61,8 @@ namespace ArcEngine
 	private:
 		static void StartBatch();
 		static void NextBatch();
+		// Slot of the texture in the current batch, starts a new batch once every slot is taken
+		[[nodiscard]] static float GetTextureIndex(const Ref<Texture2D>& texture);
 	};
 }
 
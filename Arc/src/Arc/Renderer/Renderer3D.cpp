@@ -17,6 +17,9 @@ namespace ArcEngine
 {
 	Renderer3D::Statistics Renderer3D::s_Stats;
 	std::vector<Renderer3D::MeshData> Renderer3D::s_Meshes;
+	RenderQueue Renderer3D::s_GeometryQueue;
+	RenderQueue Renderer3D::s_ShadowQueue;
+	glm::vec3 Renderer3D::s_CameraPosition = glm::vec3(0.0f);
 	Ref<Texture2D> Renderer3D::s_BRDFLutTexture;
 	Ref<Shader> Renderer3D::s_Shader;
 	Ref<Shader> Renderer3D::s_LightingShader;
@@ -29,11 +32,22 @@ namespace ArcEngine
 	Ref<VertexArray> Renderer3D::s_QuadVertexArray;
 	Ref<VertexArray> Renderer3D::s_CubeVertexArray;
 	Ref<UniformBuffer> Renderer3D::s_UbCamera;
-	Ref<UniformBuffer> Renderer3D::s_UbPointLights;
+	Ref<StorageBuffer> Renderer3D::s_LightBuffer;
 	Ref<UniformBuffer> Renderer3D::s_UbDirectionalLights;
+	Ref<UniformBuffer> Renderer3D::s_UbInstances;
+	std::array<glm::mat4, Renderer3D::MAX_NUM_INSTANCES> Renderer3D::s_InstanceTransforms;
 
 	Entity Renderer3D::s_Skylight;
 	std::vector<Entity> Renderer3D::s_SceneLights;
+	ShadowAtlas Renderer3D::s_ShadowAtlas;
+	LightClusters Renderer3D::s_LightClusters;
+	std::vector<LightClusters::LightBounds> Renderer3D::s_LightBounds;
+	std::vector<uint8_t> Renderer3D::s_LightUploadData;
+	std::vector<Renderer3D::ShadowMap> Renderer3D::s_ShadowMaps;
+	std::array<float, ShadowCascades::MaxCascades> Renderer3D::s_CascadeSplits;
+	uint32_t Renderer3D::s_CascadeCount = 0;
+	glm::mat4 Renderer3D::s_CameraView = glm::mat4(1.0f);
+	glm::mat4 Renderer3D::s_CameraProjection = glm::mat4(1.0f);
 
 	ShaderLibrary Renderer3D::s_ShaderLibrary;
 	Renderer3D::TonemappingType Renderer3D::Tonemapping = Renderer3D::TonemappingType::ACES;
@@ -48,6 +62,16 @@ namespace ArcEngine
 	glm::vec4 Renderer3D::VignetteColor = glm::vec4(0.0f, 0.0f, 0.0f, 0.25f);	// rgb: color, a: intensity
 	glm::vec4 Renderer3D::VignetteOffset = glm::vec4(0.0f, 0.0f, 0.0f, 1.0f);	// xy: offset, z: useMask, w: enable/disable effect
 	Ref<Texture2D> Renderer3D::VignetteMask = nullptr;
+	uint32_t Renderer3D::ShadowCascadeCount = 4;
+	float Renderer3D::ShadowDistance = 100.0f;
+	float Renderer3D::ShadowSplitLambda = 0.75f;
+
+	// Storage buffer bindings of the lighting pass, point and spot lights and the clusters they are sorted into
+	static constexpr uint32_t s_PointLightsBinding = 1;
+	static constexpr uint32_t s_LightClustersBinding = 5;
+
+	// How far towards the light casters outside of a cascade still throw shadows into it
+	static constexpr float s_ShadowCasterDistance = 100.0f;
 
 	void Renderer3D::Init()
 	{
@@ -61,22 +85,29 @@ namespace ArcEngine
 			{ ShaderDataType::Float4, "u_CameraPosition" }
 		}, 0);
 
-		s_UbPointLights = UniformBuffer::Create();
-		s_UbPointLights->SetLayout({
-			{ ShaderDataType::Float4, "u_Position" },
-			{ ShaderDataType::Float4, "u_Color" },
-			{ ShaderDataType::Float4, "u_AttenFactors" },
-			{ ShaderDataType::Float4, "u_LightDir" },
-		}, 1, MAX_NUM_LIGHTS + 1);
+		s_LightBuffer = StorageBuffer::Create();
 
 		s_UbDirectionalLights = UniformBuffer::Create();
 		s_UbDirectionalLights->SetLayout({
 			{ ShaderDataType::Float4, "u_Position" },
 			{ ShaderDataType::Float4, "u_Color" },
 			{ ShaderDataType::Float4, "u_LightDir" },
-			{ ShaderDataType::Mat4, "u_DirLightViewProj" },
+			{ ShaderDataType::Float4, "u_CascadeSplits" },
+			{ ShaderDataType::Float4, "u_ShadowAtlasRects[0]" },
+			{ ShaderDataType::Float4, "u_ShadowAtlasRects[1]" },
+			{ ShaderDataType::Float4, "u_ShadowAtlasRects[2]" },
+			{ ShaderDataType::Float4, "u_ShadowAtlasRects[3]" },
+			{ ShaderDataType::Mat4, "u_CascadeViewProj[0]" },
+			{ ShaderDataType::Mat4, "u_CascadeViewProj[1]" },
+			{ ShaderDataType::Mat4, "u_CascadeViewProj[2]" },
+			{ ShaderDataType::Mat4, "u_CascadeViewProj[3]" },
 		}, 2, MAX_NUM_DIR_LIGHTS + 1);
 
+		s_UbInstances = UniformBuffer::Create();
+		s_UbInstances->SetLayout({
+			{ ShaderDataType::Mat4, "u_Models" },
+		}, 3, MAX_NUM_INSTANCES);
+
 		s_BRDFLutTexture = Texture2D::Create("Resources/Renderer/BRDF_LUT.jpg");
 
 		s_ShaderLibrary = ShaderLibrary();
@@ -97,7 +128,6 @@ namespace ArcEngine
 
 		s_LightingShader->Bind();
 		s_LightingShader->SetUniformBlock("Camera", 0);
-		s_LightingShader->SetUniformBlock("PointLightBuffer", 1);
 		s_LightingShader->SetUniformBlock("DirectionalLightBuffer", 2);
 
 		// Cube-map
@@ -196,6 +226,7 @@ namespace ArcEngine
 	{
 		ARC_PROFILE_SCOPE()
 
+		s_ShadowAtlas.Release();
 	}
 
 	void Renderer3D::BeginScene(const CameraData& cameraData, Entity cubemap, std::vector<Entity>&& lights)
@@ -206,6 +237,7 @@ namespace ArcEngine
 		s_SceneLights = std::move(lights);
 
 		SetupCameraData(cameraData);
+		AllocateShadowMaps();
 		SetupLightsData();
 	}
 
@@ -237,17 +269,18 @@ namespace ArcEngine
 		s_Meshes.reserve(count);
 	}
 
-	void Renderer3D::SubmitMesh(const glm::mat4& transform, Submesh& submesh, MeshComponent::CullModeType cullMode)
+	void Renderer3D::SubmitMesh(const glm::mat4& transform, Submesh& submesh, MeshComponent::CullModeType cullMode, uint32_t visibilityMask)
 	{
 		ARC_PROFILE_SCOPE()
 
-		s_Meshes.emplace_back(transform, submesh, cullMode);
+		s_Meshes.emplace_back(transform, submesh, cullMode, visibilityMask);
 	}
 
 	void Renderer3D::Flush(const Ref<RenderGraphData>& renderGraphData)
 	{
 		ARC_PROFILE_SCOPE()
 		
+		BuildRenderQueues();
 		ShadowMapPass();
 		RenderPass(renderGraphData->RenderPassTarget);
 		LightingPass(renderGraphData);
@@ -257,6 +290,44 @@ namespace ArcEngine
 		s_Meshes.clear();
 	}
 
+	void Renderer3D::BuildRenderQueues()
+	{
+		ARC_PROFILE_SCOPE()
+
+		s_GeometryQueue.Clear();
+		s_ShadowQueue.Clear();
+		s_GeometryQueue.Reserve(s_Meshes.size());
+		s_ShadowQueue.Reserve(s_Meshes.size());
+
+		const uint32_t meshCount = static_cast<uint32_t>(s_Meshes.size());
+		for (uint32_t i = 0; i < meshCount; ++i)
+		{
+			const MeshData& meshData = s_Meshes[i];
+			const Submesh& submesh = meshData.SubmeshGeometry;
+			const uint32_t vertexArray = s_GeometryQueue.GetResourceID(submesh.Geometry.get());
+
+			if (meshData.VisibilityMask & VISIBLE_TO_CAMERA)
+			{
+				// Front to back inside a state bucket to help early depth rejection
+				const float depth = glm::length(glm::vec3(meshData.Transform[3]) - s_CameraPosition);
+				const uint64_t key = RenderQueue::MakeKey(RenderQueue::Pass::Geometry,
+					s_GeometryQueue.GetResourceID(submesh.Mat->GetShader().get()),
+					s_GeometryQueue.GetResourceID(submesh.Mat.get()),
+					vertexArray,
+					static_cast<uint32_t>(meshData.CullMode),
+					depth);
+				s_GeometryQueue.Push(key, i);
+			}
+
+			// Shadow maps use a single shader, only the geometry changes
+			if (meshData.VisibilityMask & ~VISIBLE_TO_CAMERA)
+				s_ShadowQueue.Push(RenderQueue::MakeKey(RenderQueue::Pass::Shadow, 0, 0, vertexArray, 0, 0.0f), i);
+		}
+
+		s_GeometryQueue.Sort();
+		s_ShadowQueue.Sort();
+	}
+
 	void Renderer3D::FXAAPass(const Ref<RenderGraphData>& renderGraphData)
 	{
 		ARC_PROFILE_SCOPE()
@@ -293,6 +364,83 @@ namespace ArcEngine
 		static_assert(sizeof(CameraData) == sizeof(glm::mat4) * 3 + sizeof(glm::vec3));
 		s_UbCamera->Bind();
 		s_UbCamera->SetData(&cameraData, 0, sizeof(CameraData));
+
+		s_CameraPosition = cameraData.Position;
+		s_CameraView = cameraData.View;
+		s_CameraProjection = cameraData.Projection;
+	}
+
+	std::span<const Renderer3D::ShadowMap> Renderer3D::GetShadowMaps(Entity light)
+	{
+		const auto first = std::ranges::find(s_ShadowMaps, light, &ShadowMap::Light);
+		const auto last = std::find_if(first, s_ShadowMaps.end(), [light](const ShadowMap& shadowMap) { return shadowMap.Light != light; });
+		return { first, last };
+	}
+
+	void Renderer3D::AllocateShadowMaps()
+	{
+		ARC_PROFILE_SCOPE()
+
+		// Directional lights cover the whole view, so their importance comes from how bright they are
+		// compared to the brightest caster. Dim fill lights end up with smaller tiles.
+		std::vector<Entity> casters;
+		std::vector<float> brightnesses;
+		float maxBrightness = 0.0f;
+		uint32_t dirLightCount = 0;
+		for (const Entity lightEntity : s_SceneLights)
+		{
+			const LightComponent& light = lightEntity.GetComponent<LightComponent>();
+			if (light.Type != LightComponent::LightType::Directional)
+				continue;
+
+			// Lights past the ones the lighting pass knows about are ignored
+			if (dirLightCount++ == MAX_NUM_DIR_LIGHTS)
+				break;
+			if (!CastsShadows(light))
+				continue;
+
+			const float brightness = light.Intensity * glm::max(light.Color.r, glm::max(light.Color.g, light.Color.b));
+			casters.push_back(lightEntity);
+			brightnesses.push_back(brightness);
+			maxBrightness = glm::max(maxBrightness, brightness);
+		}
+
+		// Without a valid camera (or a shadow distance in front of its near plane) there is nothing to fit cascades to
+		float nearDepth, farDepth;
+		ShadowCascades::GetDepthRange(s_CameraProjection, nearDepth, farDepth);
+		farDepth = glm::min(farDepth, ShadowDistance);
+		if (!(farDepth > nearDepth))
+			casters.clear();
+
+		// Every cascade covers about the same number of pixels on screen, so they all share the importance of their light
+		s_CascadeCount = glm::clamp(ShadowCascadeCount, 1u, ShadowCascades::MaxCascades);
+		std::vector<float> importances;
+		importances.reserve(casters.size() * s_CascadeCount);
+		for (size_t i = 0; i < casters.size(); ++i)
+			importances.insert(importances.end(), s_CascadeCount, maxBrightness > 0.0f ? brightnesses[i] / maxBrightness : 1.0f);
+
+		std::vector<ShadowAtlas::Tile> tiles;
+		s_ShadowAtlas.Allocate(importances, tiles);
+
+		ShadowCascades::ComputeSplits(nearDepth, farDepth, ShadowSplitLambda, { s_CascadeSplits.data(), s_CascadeCount });
+
+		s_ShadowMaps.clear();
+		for (size_t i = 0; i < casters.size(); ++i)
+		{
+			// Based off of +Z direction
+			const glm::vec3 lightDirection = glm::vec3(casters[i].GetWorldTransform() * glm::vec4(0, 0, 1, 0));
+			for (uint32_t cascadeIndex = 0; cascadeIndex < s_CascadeCount; ++cascadeIndex)
+			{
+				const ShadowAtlas::Tile& tile = tiles[i * s_CascadeCount + cascadeIndex];
+				if (!tile.IsValid())
+					continue;
+
+				const float cascadeNear = cascadeIndex == 0 ? nearDepth : s_CascadeSplits[cascadeIndex - 1];
+				const ShadowCascades::Cascade cascade = ShadowCascades::Fit(s_CameraView, s_CameraProjection, cascadeNear, s_CascadeSplits[cascadeIndex],
+					lightDirection, tile.Size, s_ShadowCasterDistance);
+				s_ShadowMaps.push_back({ casters[i], cascadeIndex, tile, cascade });
+			}
+		}
 	}
 
 	void Renderer3D::SetupLightsData()
@@ -308,12 +456,28 @@ namespace ArcEngine
 				glm::vec4 LightDir;
 			};
 
+			struct LightClusterHeader
+			{
+				glm::uvec4 ClusterSize;			// xyz: cluster counts, w: light count
+				glm::vec4 DepthParams;			// x: scale, y: bias
+			};
+			static_assert(sizeof(LightClusters::Cluster) == sizeof(glm::uvec2));
+
 			uint32_t numLights = 0;
-			constexpr uint32_t size = sizeof(PointLightData);
+			for (const Entity e : s_SceneLights)
+			{
+				if (e.GetComponent<LightComponent>().Type != LightComponent::LightType::Directional)
+					++numLights;
+			}
 
-			s_UbPointLights->Bind();
+			// Lights, the cluster table and the light lists of the clusters go up in a single upload,
+			// the lights and the clusters are then bound as two sections of the same buffer
+			const uint32_t lightsSize = glm::max(numLights, 1u) * static_cast<uint32_t>(sizeof(PointLightData));
+			s_LightUploadData.resize(lightsSize);
+			s_LightBounds.clear();
 
-			for (Entity e : s_SceneLights)
+			uint32_t lightIndex = 0;
+			for (const Entity e : s_SceneLights)
 			{
 				const LightComponent& lightComponent = e.GetComponent<LightComponent>();
 				if (lightComponent.Type == LightComponent::LightType::Directional)
@@ -336,13 +500,36 @@ namespace ArcEngine
 					zDir
 				};
 
-				s_UbPointLights->SetData(&pointLightData, size * numLights, size);
-
-				numLights++;
+				memcpy(s_LightUploadData.data() + lightIndex * sizeof(PointLightData), &pointLightData, sizeof(PointLightData));
+				s_LightBounds.push_back({ glm::vec3(worldTransform[3]), lightComponent.Range });
+				++lightIndex;
 			}
 
-			// Pass number of lights within the scene
-			s_UbPointLights->SetData(&numLights, MAX_NUM_LIGHTS * size, sizeof(uint32_t));
+			s_LightClusters.Build(s_CameraView, s_CameraProjection, s_LightBounds);
+			const std::vector<LightClusters::Cluster>& clusters = s_LightClusters.GetClusters();
+			const std::vector<uint32_t>& lightIndices = s_LightClusters.GetLightIndices();
+
+			const LightClusterHeader header =
+			{
+				glm::uvec4(LightClusters::GridX, LightClusters::GridY, LightClusters::GridZ, numLights),
+				glm::vec4(s_LightClusters.GetDepthScale(), s_LightClusters.GetDepthBias(), 0.0f, 0.0f)
+			};
+
+			const uint32_t clustersOffset = (lightsSize + StorageBuffer::OffsetAlignment - 1) / StorageBuffer::OffsetAlignment * StorageBuffer::OffsetAlignment;
+			const uint32_t clusterTableSize = static_cast<uint32_t>(clusters.size() * sizeof(LightClusters::Cluster));
+			const uint32_t lightIndicesSize = static_cast<uint32_t>(lightIndices.size() * sizeof(uint32_t));
+			const uint32_t clustersSize = static_cast<uint32_t>(sizeof(LightClusterHeader)) + clusterTableSize + glm::max(lightIndicesSize, static_cast<uint32_t>(sizeof(uint32_t)));
+
+			s_LightUploadData.resize(clustersOffset + clustersSize);
+			uint8_t* clusterData = s_LightUploadData.data() + clustersOffset;
+			memcpy(clusterData, &header, sizeof(LightClusterHeader));
+			memcpy(clusterData + sizeof(LightClusterHeader), clusters.data(), clusterTableSize);
+			if (lightIndicesSize != 0)
+				memcpy(clusterData + sizeof(LightClusterHeader) + clusterTableSize, lightIndices.data(), lightIndicesSize);
+
+			s_LightBuffer->SetData(s_LightUploadData.data(), static_cast<uint32_t>(s_LightUploadData.size()));
+			s_LightBuffer->Bind(s_PointLightsBinding, 0, lightsSize);
+			s_LightBuffer->Bind(s_LightClustersBinding, clustersOffset, clustersSize);
 		}
 
 		{
@@ -351,16 +538,26 @@ namespace ArcEngine
 				glm::vec4 Position;
 				glm::vec4 Color;
 				glm::vec4 LightDir;
-				glm::mat4 DirLightViewProj;
+				glm::vec4 CascadeSplits;
+				std::array<glm::vec4, ShadowCascades::MaxCascades> ShadowAtlasRects;
+				std::array<glm::mat4, ShadowCascades::MaxCascades> CascadeViewProj;
 			};
 
-			uint32_t numLights = 0;
-			constexpr uint32_t size = sizeof(DirectionalLightData);
+			// Laid out like the uniform block, the count follows the array
+			struct DirectionalLightBufferData
+			{
+				std::array<DirectionalLightData, MAX_NUM_DIR_LIGHTS> Lights;
+				uint32_t Count;
+			};
 
-			s_UbDirectionalLights->Bind();
+			DirectionalLightBufferData bufferData{};
+			uint32_t& numLights = bufferData.Count;
 
-			for (Entity e : s_SceneLights)
+			for (const Entity e : s_SceneLights)
 			{
+				if (numLights == MAX_NUM_DIR_LIGHTS)
+					break;
+
 				const LightComponent& lightComponent = e.GetComponent<LightComponent>();
 				if (lightComponent.Type != LightComponent::LightType::Directional)
 					continue;
@@ -369,29 +566,32 @@ namespace ArcEngine
 			
 				// Based off of +Z direction
 				glm::vec4 zDir = worldTransform * glm::vec4(0, 0, 1, 0);
-				float near_plane = -100.0f, far_plane = 100.0f;
-				glm::mat4 lightProjection = glm::ortho(-20.0f, 20.0f, -20.0f, 20.0f, near_plane, far_plane);
 				glm::vec3 pos = worldTransform[3];
-				glm::vec3 dir = glm::normalize(glm::vec3(zDir));
-				glm::vec3 lookAt = pos + dir;
-				glm::mat4 dirLightView = glm::lookAt(pos, lookAt, glm::vec3(0, 1 ,0));
-				glm::mat4 dirLightViewProj = lightProjection * dirLightView;
 
+				// Cascades without a shadow map keep a zero atlas rect and stay unshadowed
 				DirectionalLightData dirLightData = 
 				{
 					glm::vec4(pos, static_cast<uint32_t>(lightComponent.ShadowQuality)),
 					glm::vec4(lightComponent.Color, lightComponent.Intensity),
-					zDir,
-					dirLightViewProj
+					glm::vec4(glm::vec3(zDir), static_cast<float>(s_CascadeCount)),
+					glm::vec4(0.0f),
+					{},
+					{}
 				};
+				for (uint32_t cascadeIndex = 0; cascadeIndex < s_CascadeCount; ++cascadeIndex)
+					dirLightData.CascadeSplits[cascadeIndex] = s_CascadeSplits[cascadeIndex];
+				for (const ShadowMap& shadowMap : GetShadowMaps(e))
+				{
+					dirLightData.ShadowAtlasRects[shadowMap.CascadeIndex] = s_ShadowAtlas.GetUVRect(shadowMap.Tile);
+					dirLightData.CascadeViewProj[shadowMap.CascadeIndex] = shadowMap.Cascade.ViewProjection;
+				}
 
-				s_UbDirectionalLights->SetData(&dirLightData, size * numLights, size);
-
+				bufferData.Lights[numLights] = dirLightData;
 				numLights++;
 			}
 
-			// Pass number of lights within the scene
-			s_UbDirectionalLights->SetData(&numLights, MAX_NUM_DIR_LIGHTS * size, sizeof(uint32_t));
+			s_UbDirectionalLights->Bind();
+			s_UbDirectionalLights->SetData(&bufferData, 0, sizeof(DirectionalLightBufferData));
 		}
 	}
 
@@ -528,10 +728,7 @@ namespace ArcEngine
 		s_LightingShader->SetInt("u_RadianceMap", 6);
 		s_LightingShader->SetInt("u_BRDFLutMap", 7);
 
-		int32_t samplers[MAX_NUM_DIR_LIGHTS];
-		for (uint32_t i = 0; i < MAX_NUM_DIR_LIGHTS; i++)
-			samplers[i] = static_cast<int32_t>(i + 8);
-		s_LightingShader->SetIntArray("u_DirectionalShadowMap", samplers, MAX_NUM_DIR_LIGHTS);
+		s_LightingShader->SetInt("u_ShadowAtlas", 8);
 
 		renderGraphData->RenderPassTarget->BindColorAttachment(0, 0);
 		renderGraphData->RenderPassTarget->BindColorAttachment(1, 1);
@@ -552,23 +749,8 @@ namespace ArcEngine
 		}
 		s_BRDFLutTexture->Bind(7);
 		
-		uint32_t dirLightIndex = 0;
-		for (const auto& lightEntity : s_SceneLights)
-		{
-			const LightComponent& light = lightEntity.GetComponent<LightComponent>();
-			if (light.Type == LightComponent::LightType::Directional)
-			{
-				if (dirLightIndex < MAX_NUM_DIR_LIGHTS)
-				{
-					light.ShadowMapFramebuffer->BindDepthAttachment(8 + dirLightIndex);
-					dirLightIndex++;
-				}
-				else
-				{
-					break;
-				}
-			}
-		}
+		if (const Ref<Framebuffer>& shadowAtlas = s_ShadowAtlas.GetFramebuffer())
+			shadowAtlas->BindDepthAttachment(8);
 		
 		DrawQuad();
 	}
@@ -608,10 +790,19 @@ namespace ArcEngine
 			ARC_PROFILE_SCOPE("Draw Meshes")
 
 			MeshComponent::CullModeType currentCullMode = MeshComponent::CullModeType::Unknown;
-			for (const auto& meshData : s_Meshes)
+			const Material* currentMaterial = nullptr;
+			const auto& commands = s_GeometryQueue.GetCommands();
+			for (size_t i = 0; i < commands.size();)
 			{
-				meshData.SubmeshGeometry.Mat->Bind();
-				s_Shader->SetMat4("u_Model", meshData.Transform);
+				const MeshData& meshData = s_Meshes[commands[i].Index];
+
+				// Draws are sorted by material, so it is only bound once per group
+				const Material* material = meshData.SubmeshGeometry.Mat.get();
+				if (material != currentMaterial)
+				{
+					currentMaterial = material;
+					material->Bind();
+				}
 				
 				if (currentCullMode != meshData.CullMode)
 				{
@@ -635,9 +826,13 @@ namespace ArcEngine
 					}
 				}
 				
-				RenderCommand::DrawIndexed(meshData.SubmeshGeometry.Geometry);
+				uint32_t instanceCount = 0;
+				i = UploadInstances(commands, i, VISIBLE_TO_CAMERA, true, instanceCount);
+
+				RenderCommand::DrawIndexedInstanced(meshData.SubmeshGeometry.Geometry, instanceCount);
 				s_Stats.DrawCalls++;
-				s_Stats.IndexCount += meshData.SubmeshGeometry.Geometry->GetIndexBuffer()->GetCount();
+				s_Stats.InstanceCount += instanceCount;
+				s_Stats.IndexCount += meshData.SubmeshGeometry.Geometry->GetIndexBuffer()->GetCount() * instanceCount;
 			}
 		}
 	}
@@ -646,38 +841,66 @@ namespace ArcEngine
 	{
 		ARC_PROFILE_SCOPE()
 
-		for (const auto& lightEntity : s_SceneLights)
-		{
-			const LightComponent& light = lightEntity.GetComponent<LightComponent>();
-			if (light.Type != LightComponent::LightType::Directional)
-				continue;
-
-			light.ShadowMapFramebuffer->Bind();
-			RenderCommand::Clear();
+		const Ref<Framebuffer>& shadowAtlas = s_ShadowAtlas.GetFramebuffer();
+		if (!shadowAtlas)
+			return;
 
-			glm::mat4 transform = lightEntity.GetWorldTransform();
-			constexpr float nearPlane = -100.0f;
-			constexpr float farPlane = 100.0f;
-			
-			glm::mat4 lightProjection = glm::ortho(-20.0f, 20.0f, -20.0f, 20.0f, nearPlane, farPlane);
-			
-			glm::vec4 zDir = transform * glm::vec4(0, 0, 1, 0);
+		shadowAtlas->Bind();
+		RenderCommand::Clear();
+		s_ShadowMapShader->Bind();
 
-			glm::vec3 pos = transform[3];
-			glm::vec3 dir = glm::normalize(glm::vec3(zDir));
-			glm::vec3 lookAt = pos + dir;
-			glm::mat4 dirLightView = glm::lookAt(pos, lookAt, glm::vec3(0, 1 ,0));
-			glm::mat4 dirLightViewProj = lightProjection * dirLightView;
+		// Meshes were culled against every cascade, so each one only draws its own casters
+		for (uint32_t shadowIndex = 0; shadowIndex < s_ShadowMaps.size(); ++shadowIndex)
+		{
+			const ShadowMap& shadowMap = s_ShadowMaps[shadowIndex];
+			const ShadowAtlas::Tile& tile = shadowMap.Tile;
+			const uint32_t visibilityBit = GetShadowVisibilityBit(shadowIndex);
 
-			s_ShadowMapShader->Bind();
-			s_ShadowMapShader->SetMat4("u_ViewProjection", dirLightViewProj);
+			RenderCommand::SetViewport(tile.X, tile.Y, tile.Size, tile.Size);
+			s_ShadowMapShader->SetMat4("u_ViewProjection", shadowMap.Cascade.ViewProjection);
 
-			for (auto it = s_Meshes.rbegin(); it != s_Meshes.rend(); ++it)
+			const auto& commands = s_ShadowQueue.GetCommands();
+			for (size_t i = 0; i < commands.size();)
 			{
-				const MeshData& meshData = *it;
-				s_ShadowMapShader->SetMat4("u_Model", meshData.Transform);
-				RenderCommand::DrawIndexed(meshData.SubmeshGeometry.Geometry);
+				const MeshData& meshData = s_Meshes[commands[i].Index];
+
+				uint32_t instanceCount = 0;
+				i = UploadInstances(commands, i, visibilityBit, false, instanceCount);
+				if (instanceCount != 0)
+					RenderCommand::DrawIndexedInstanced(meshData.SubmeshGeometry.Geometry, instanceCount);
 			}
 		}
 	}
+
+	size_t Renderer3D::UploadInstances(const std::vector<RenderQueue::Command>& commands, size_t first, uint32_t visibilityBit, bool matchMaterial, uint32_t& instanceCount)
+	{
+		ARC_PROFILE_SCOPE()
+
+		// The queue is sorted by geometry (and material), so every draw that can share the instanced
+		// draw of the first one directly follows it
+		const MeshData& firstMesh = s_Meshes[commands[first].Index];
+		instanceCount = 0;
+
+		size_t i = first;
+		for (; i < commands.size() && instanceCount < MAX_NUM_INSTANCES; ++i)
+		{
+			const MeshData& meshData = s_Meshes[commands[i].Index];
+			if (meshData.SubmeshGeometry.Geometry != firstMesh.SubmeshGeometry.Geometry)
+				break;
+			if (matchMaterial && (meshData.SubmeshGeometry.Mat != firstMesh.SubmeshGeometry.Mat || meshData.CullMode != firstMesh.CullMode))
+				break;
+			if ((meshData.VisibilityMask & visibilityBit) == 0)
+				continue;
+
+			s_InstanceTransforms[instanceCount++] = meshData.Transform;
+		}
+
+		if (instanceCount != 0)
+		{
+			s_UbInstances->Bind();
+			s_UbInstances->SetData(s_InstanceTransforms.data(), 0, instanceCount * sizeof(glm::mat4));
+		}
+
+		return i;
+	}
 }
@@ -1,6 +1,11 @@
 #pragma once
 
+#include "Arc/Renderer/LightClusters.h"
+#include "Arc/Renderer/RenderQueue.h"
+#include "Arc/Renderer/ShadowAtlas.h"
+#include "Arc/Renderer/ShadowCascades.h"
 #include "Arc/Scene/Components.h"
+#include "Arc/Scene/Entity.h"
 
 struct aiMesh;
 struct aiScene;
@@ -11,16 +16,34 @@ namespace ArcEngine
 	class Shader;
 	class ShaderLibrary;
 	class UniformBuffer;
+	class StorageBuffer;
 	struct Submesh;
 	struct RenderGraphData;
-	class Entity;
 	struct CameraData;
 
 	class Renderer3D
 	{
 	public:
-		static constexpr uint32_t MAX_NUM_LIGHTS = 200;
 		static constexpr uint32_t MAX_NUM_DIR_LIGHTS = 3;
+		static constexpr uint32_t MAX_NUM_INSTANCES = 256;		// 16 KB of transforms, the minimum uniform block size GL guarantees
+		static constexpr uint32_t MAX_NUM_SHADOW_MAPS = MAX_NUM_DIR_LIGHTS * ShadowCascades::MaxCascades;
+
+		// Visibility mask bits: bit 0 is the camera, bit i + 1 is the i-th shadow map
+		static constexpr uint32_t VISIBLE_TO_CAMERA = 1u;
+		static constexpr uint32_t VISIBLE_TO_ALL = ~0u;
+		[[nodiscard]] static constexpr uint32_t GetShadowVisibilityBit(uint32_t shadowIndex) { return 1u << (shadowIndex + 1); }
+
+		// Only directional lights render shadows, and only the first MAX_NUM_DIR_LIGHTS directional lights are lit
+		[[nodiscard]] static bool CastsShadows(const LightComponent& light) { return light.Type == LightComponent::LightType::Directional && light.CastShadows; }
+
+		// One cascade of a shadow casting light
+		struct ShadowMap
+		{
+			Entity Light;
+			uint32_t CascadeIndex;
+			ShadowAtlas::Tile Tile;
+			ShadowCascades::Cascade Cascade;
+		};
 
 		static void Init();
 		static void Shutdown();
@@ -31,13 +54,19 @@ namespace ArcEngine
 		static void DrawCube();
 		static void DrawQuad();
 		static void ReserveMeshes(size_t count);
-		static void SubmitMesh(const glm::mat4& transform, Submesh& submesh, MeshComponent::CullModeType cullMode);
+		static void SubmitMesh(const glm::mat4& transform, Submesh& submesh, MeshComponent::CullModeType cullMode, uint32_t visibilityMask = VISIBLE_TO_ALL);
 
 		[[nodiscard]] static ShaderLibrary& GetShaderLibrary() { return s_ShaderLibrary; }
+		[[nodiscard]] static const ShadowAtlas& GetShadowAtlas() { return s_ShadowAtlas; }
+		// Shadow maps of the current scene in visibility bit order, valid after BeginScene
+		[[nodiscard]] static std::span<const ShadowMap> GetShadowMaps() { return s_ShadowMaps; }
+		// Cascades of the light in the last rendered scene, empty if it has none
+		[[nodiscard]] static std::span<const ShadowMap> GetShadowMaps(Entity light);
 
 		struct Statistics
 		{
 			uint32_t DrawCalls = 0;
+			uint32_t InstanceCount = 0;
 			uint32_t IndexCount = 0;
 		};
 
@@ -46,8 +75,11 @@ namespace ArcEngine
 
 	private:
 		static void SetupCameraData(const CameraData& cameraData);
+		static void AllocateShadowMaps();
 		static void SetupLightsData();
 		static void Flush(const Ref<RenderGraphData>& renderGraphData);
+		static void BuildRenderQueues();
+		static size_t UploadInstances(const std::vector<RenderQueue::Command>& commands, size_t first, uint32_t visibilityBit, bool matchMaterial, uint32_t& instanceCount);
 		static void FXAAPass(const Ref<RenderGraphData>& renderGraphData);
 		static void CompositePass(const Ref<RenderGraphData>& renderGraphData);
 		static void BloomPass(const Ref<RenderGraphData>& renderGraphData);
@@ -61,9 +93,10 @@ namespace ArcEngine
 			glm::mat4 Transform;
 			Submesh& SubmeshGeometry;
 			MeshComponent::CullModeType CullMode;
+			uint32_t VisibilityMask;
 
-			MeshData(const glm::mat4& transform, Submesh& submesh, const MeshComponent::CullModeType cullMode)
-				: Transform(transform), SubmeshGeometry(submesh), CullMode(cullMode)
+			MeshData(const glm::mat4& transform, Submesh& submesh, const MeshComponent::CullModeType cullMode, const uint32_t visibilityMask)
+				: Transform(transform), SubmeshGeometry(submesh), CullMode(cullMode), VisibilityMask(visibilityMask)
 			{
 			}
 		};
@@ -71,6 +104,9 @@ namespace ArcEngine
 		static Statistics s_Stats;
 		static ShaderLibrary s_ShaderLibrary;
 		static std::vector<Renderer3D::MeshData> s_Meshes;
+		static RenderQueue s_GeometryQueue;
+		static RenderQueue s_ShadowQueue;
+		static glm::vec3 s_CameraPosition;
 		static Ref<Texture2D> s_BRDFLutTexture;
 		static Ref<Shader> s_Shader;
 		static Ref<Shader> s_LightingShader;
@@ -83,11 +119,22 @@ namespace ArcEngine
 		static Ref<VertexArray> s_QuadVertexArray;
 		static Ref<VertexArray> s_CubeVertexArray;
 		static Ref<UniformBuffer> s_UbCamera;
-		static Ref<UniformBuffer> s_UbPointLights;
+		static Ref<StorageBuffer> s_LightBuffer;
 		static Ref<UniformBuffer> s_UbDirectionalLights;
+		static Ref<UniformBuffer> s_UbInstances;
+		static std::array<glm::mat4, MAX_NUM_INSTANCES> s_InstanceTransforms;
 
 		static Entity s_Skylight;
 		static std::vector<Entity> s_SceneLights;
+		static LightClusters s_LightClusters;
+		static std::vector<LightClusters::LightBounds> s_LightBounds;
+		static std::vector<uint8_t> s_LightUploadData;
+		static ShadowAtlas s_ShadowAtlas;
+		static std::vector<ShadowMap> s_ShadowMaps;					// Cascades of each light are next to each other
+		static std::array<float, ShadowCascades::MaxCascades> s_CascadeSplits;
+		static uint32_t s_CascadeCount;
+		static glm::mat4 s_CameraView;
+		static glm::mat4 s_CameraProjection;
 
 	public:
 
@@ -105,5 +152,8 @@ namespace ArcEngine
 		static glm::vec4 VignetteColor;			// rgb: color, a: intensity
 		static glm::vec4 VignetteOffset;		// xy: offset, z: useMask, w: enable/disable effect
 		static Ref<Texture2D> VignetteMask;
+		static uint32_t ShadowCascadeCount;
+		static float ShadowDistance;			// View distance up to which directional lights cast shadows
+		static float ShadowSplitLambda;			// 0: uniform cascade splits, 1: logarithmic splits
 	};
 }
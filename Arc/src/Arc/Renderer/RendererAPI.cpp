@@ -2,6 +2,7 @@
 #include "Arc/Renderer/RendererAPI.h"
 
 #include "Platform/OpenGL/OpenGLRendererAPI.h"
+#include "Platform/Null/NullRendererAPI.h"
 
 namespace ArcEngine
 {
@@ -11,7 +12,7 @@ namespace ArcEngine
 	{
 		switch (s_API)
 		{
-			case RendererAPI::API::None:    ARC_CORE_ASSERT(false, "RendererAPI::None is currently not supported!") return nullptr;
+			case RendererAPI::API::None:    return CreateScope<NullRendererAPI>();
 			case RendererAPI::API::OpenGL:  return CreateScope<OpenGLRendererAPI>();
 		}
 
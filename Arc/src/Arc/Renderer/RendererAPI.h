@@ -11,7 +11,8 @@ namespace ArcEngine
 
 		enum class API
 		{
-			None = 0, OpenGL = 1
+			None = 0,		// Headless, commands are recorded instead of executed
+			OpenGL = 1
 		};
 	public:
 		virtual void Init() = 0;
@@ -20,6 +21,7 @@ namespace ArcEngine
 		virtual void Clear() = 0;
 
 		virtual void DrawIndexed(const Ref<VertexArray>& vertexArray, uint32_t indexCount = 0) = 0;
+		virtual void DrawIndexedInstanced(const Ref<VertexArray>& vertexArray, uint32_t instanceCount, uint32_t indexCount = 0) = 0;
 		virtual void Draw(const Ref<VertexArray>& vertexArray, uint32_t count) = 0;
 		virtual void DrawLines(const Ref<VertexArray>& vertexArray, uint32_t vertexCount) = 0;
 
@@ -32,6 +34,8 @@ namespace ArcEngine
 		virtual void SetBlendState(bool value) = 0;
 
 		[[nodiscard]] static API GetAPI() { return s_API; }
+		// Must be selected before Renderer::Init, resources created earlier belong to the previous API
+		static void SetAPI(API api) { s_API = api; }
 		[[nodiscard]] static Scope<RendererAPI> Create();
 	
 	private:
@@ -20,11 +20,12 @@ namespace ArcEngine
 	{
 		MaterialPropertyType Type;
 		size_t SizeInBytes;
-		size_t OffsetInBytes;
+		size_t OffsetInBytes;				// std140 offset in the u_Material block, samplers are stored after the block
 
 		std::string DisplayName;
 		bool IsSlider;
 		bool IsColor;
+		uint32_t TextureSlot = 0;			// Texture unit assigned to a sampler when the shader is compiled
 	};
 
 	class Shader
@@ -47,6 +48,8 @@ namespace ArcEngine
 		virtual void SetUniformBlock(const std::string& name, uint32_t blockIndex) = 0;
 		
 		[[nodiscard]] virtual std::unordered_map<std::string, MaterialProperty, UM_StringTransparentEquality>& GetMaterialProperties() = 0;
+		// Size in bytes of the u_Material uniform block, 0 if the shader has none
+		[[nodiscard]] virtual size_t GetMaterialBlockSize() const = 0;
 
 		[[nodiscard]] virtual const std::string& GetName() const = 0;
 
@@ -68,6 +71,17 @@ namespace ArcEngine
 
 			return 0;
 		}
+
+		[[nodiscard]] static constexpr size_t GetStd140Alignment(MaterialPropertyType type)
+		{
+			switch (type)
+			{
+				case MaterialPropertyType::Float2: return sizeof(glm::vec2);
+				case MaterialPropertyType::Float3: [[fallthrough]];
+				case MaterialPropertyType::Float4: return sizeof(glm::vec4);
+				default: return sizeof(int32_t);
+			}
+		}
 	};
 
 	class ShaderLibrary
@@ -0,0 +1,233 @@
+#include "arcpch.h"
+#include "Arc/Renderer/ShaderCache.h"
+
+#include "Arc/Core/Filesystem.h"
+
+namespace ArcEngine
+{
+	// Cache file layout, all offsets are from the start of the file:
+	// header | property table | program binary | string table
+	static constexpr char s_ShaderFileMagic[4] = { 'A', 'S', 'H', 'D' };
+	static constexpr uint32_t s_ShaderFileVersion = 1;
+	static constexpr std::string_view s_ShaderFileExtension = ".arcshader";
+
+	static std::filesystem::path s_Directory = "Cache/Shaders";
+
+	struct ShaderFileString
+	{
+		uint32_t Offset = 0;
+		uint32_t Length = 0;
+	};
+
+	struct ShaderFileHeader
+	{
+		char Magic[4];
+		uint32_t Version;
+		uint64_t Key;
+
+		uint32_t BinaryFormat;
+		uint32_t PropertyCount;
+		uint64_t MaterialBlockSize;
+
+		// Hash of the binary, catches files that were cut short or damaged on disk
+		uint64_t BinaryHash;
+		uint64_t BinarySize;
+
+		uint64_t PropertyTableOffset;
+		uint64_t BinaryOffset;
+		uint64_t StringTableOffset;
+		uint64_t StringTableSize;
+	};
+
+	struct ShaderFileProperty
+	{
+		ShaderFileString Name;
+		ShaderFileString DisplayName;
+		uint32_t Type;
+		uint32_t TextureSlot;
+		uint64_t SizeInBytes;
+		uint64_t OffsetInBytes;
+		uint8_t IsSlider;
+		uint8_t IsColor;
+		uint8_t Padding[6];
+	};
+
+	static uint64_t AlignOffset(uint64_t offset)
+	{
+		return (offset + 15) & ~static_cast<uint64_t>(15);
+	}
+
+	uint64_t ShaderCache::ComputeKey(const ShaderUtils::StageSources& sources, std::string_view driverIdentity)
+	{
+		ARC_PROFILE_SCOPE()
+
+		// Defines are part of the hashed text, the engine has no permutations that inject them
+		uint64_t key = ShaderUtils::Hash(driverIdentity);
+		key = ShaderUtils::Hash(std::string_view(reinterpret_cast<const char*>(&s_ShaderFileVersion), sizeof(s_ShaderFileVersion)), key);
+		return ShaderUtils::Hash(sources, key);
+	}
+
+	std::optional<ShaderCache::Entry> ShaderCache::Load(std::string_view shaderName, uint64_t key)
+	{
+		ARC_PROFILE_SCOPE()
+
+		const std::filesystem::path path = GetPath(shaderName, key);
+		ScopedBuffer file(Filesystem::ReadFileBinary(path));
+		if (!file.Data())
+			return std::nullopt;
+
+		const auto invalid = [&path, shaderName](const char* reason)
+		{
+			ARC_CORE_WARN("Dropping shader cache entry of {}: {}", shaderName, reason);
+			std::error_code error;
+			std::filesystem::remove(path, error);
+			return std::nullopt;
+		};
+
+		if (file.Size() < sizeof(ShaderFileHeader))
+			return invalid("file is truncated");
+
+		ShaderFileHeader header;
+		memcpy(&header, file.Data(), sizeof(ShaderFileHeader));
+
+		if (memcmp(header.Magic, s_ShaderFileMagic, sizeof(header.Magic)) != 0 || header.Version != s_ShaderFileVersion)
+			return invalid("file is from another version");
+		if (header.Key != key)
+			return invalid("key does not match");
+
+		const uint64_t size = file.Size();
+		if (header.PropertyTableOffset + header.PropertyCount * sizeof(ShaderFileProperty) > size
+			|| header.BinaryOffset + header.BinarySize > size
+			|| header.StringTableOffset + header.StringTableSize > size)
+		{
+			return invalid("file is truncated");
+		}
+
+		const uint8_t* binary = file.Data() + header.BinaryOffset;
+		if (ShaderUtils::Hash(std::string_view(reinterpret_cast<const char*>(binary), header.BinarySize)) != header.BinaryHash)
+			return invalid("program binary is corrupt");
+
+		const std::string_view stringTable(reinterpret_cast<const char*>(file.Data() + header.StringTableOffset), header.StringTableSize);
+		const auto isValidString = [&stringTable](const ShaderFileString& str) { return static_cast<uint64_t>(str.Offset) + str.Length <= stringTable.size(); };
+		const auto getString = [&stringTable](const ShaderFileString& str) { return std::string(stringTable.substr(str.Offset, str.Length)); };
+
+		Entry entry;
+		entry.BinaryFormat = header.BinaryFormat;
+		entry.Binary.assign(binary, binary + header.BinarySize);
+		entry.MaterialBlockSize = header.MaterialBlockSize;
+
+		std::vector<ShaderFileProperty> propertyTable(header.PropertyCount);
+		memcpy(propertyTable.data(), file.Data() + header.PropertyTableOffset, propertyTable.size() * sizeof(ShaderFileProperty));
+		for (const ShaderFileProperty& property : propertyTable)
+		{
+			if (!isValidString(property.Name) || !isValidString(property.DisplayName)
+				|| property.Type > static_cast<uint32_t>(MaterialPropertyType::Float4))
+			{
+				return invalid("property table is corrupt");
+			}
+
+			entry.MaterialProperties.emplace(getString(property.Name), MaterialProperty
+			{
+				static_cast<MaterialPropertyType>(property.Type),
+				property.SizeInBytes,
+				property.OffsetInBytes,
+				getString(property.DisplayName),
+				property.IsSlider != 0,
+				property.IsColor != 0,
+				property.TextureSlot
+			});
+		}
+
+		return entry;
+	}
+
+	bool ShaderCache::Store(std::string_view shaderName, uint64_t key, const Entry& entry)
+	{
+		ARC_PROFILE_SCOPE()
+
+		std::string stringTable;
+		const auto addString = [&stringTable](std::string_view str)
+		{
+			const ShaderFileString result = { static_cast<uint32_t>(stringTable.size()), static_cast<uint32_t>(str.size()) };
+			stringTable += str;
+			return result;
+		};
+
+		std::vector<ShaderFileProperty> propertyTable;
+		propertyTable.reserve(entry.MaterialProperties.size());
+		for (const auto& [name, property] : entry.MaterialProperties)
+		{
+			ShaderFileProperty& fileProperty = propertyTable.emplace_back();
+			fileProperty.Name = addString(name);
+			fileProperty.DisplayName = addString(property.DisplayName);
+			fileProperty.Type = static_cast<uint32_t>(property.Type);
+			fileProperty.TextureSlot = property.TextureSlot;
+			fileProperty.SizeInBytes = property.SizeInBytes;
+			fileProperty.OffsetInBytes = property.OffsetInBytes;
+			fileProperty.IsSlider = property.IsSlider ? 1 : 0;
+			fileProperty.IsColor = property.IsColor ? 1 : 0;
+		}
+
+		ShaderFileHeader header{};
+		memcpy(header.Magic, s_ShaderFileMagic, sizeof(header.Magic));
+		header.Version = s_ShaderFileVersion;
+		header.Key = key;
+		header.BinaryFormat = entry.BinaryFormat;
+		header.PropertyCount = static_cast<uint32_t>(propertyTable.size());
+		header.MaterialBlockSize = entry.MaterialBlockSize;
+		header.BinaryHash = ShaderUtils::Hash(std::string_view(reinterpret_cast<const char*>(entry.Binary.data()), entry.Binary.size()));
+		header.BinarySize = entry.Binary.size();
+		header.PropertyTableOffset = AlignOffset(sizeof(ShaderFileHeader));
+		header.BinaryOffset = AlignOffset(header.PropertyTableOffset + propertyTable.size() * sizeof(ShaderFileProperty));
+		header.StringTableOffset = AlignOffset(header.BinaryOffset + entry.Binary.size());
+		header.StringTableSize = stringTable.size();
+
+		std::vector<uint8_t> file(header.StringTableOffset + header.StringTableSize, 0);
+		memcpy(file.data(), &header, sizeof(ShaderFileHeader));
+		if (!propertyTable.empty())
+			memcpy(file.data() + header.PropertyTableOffset, propertyTable.data(), propertyTable.size() * sizeof(ShaderFileProperty));
+		if (!entry.Binary.empty())
+			memcpy(file.data() + header.BinaryOffset, entry.Binary.data(), entry.Binary.size());
+		if (!stringTable.empty())
+			memcpy(file.data() + header.StringTableOffset, stringTable.data(), stringTable.size());
+
+		const std::filesystem::path path = GetPath(shaderName, key);
+
+		// Entries of older sources or drivers would never be hit again
+		std::error_code error;
+		std::filesystem::create_directories(s_Directory, error);
+		const std::string prefix = fmt::format("{}_", shaderName);
+		const size_t entryNameLength = prefix.size() + 16 + s_ShaderFileExtension.size();
+		for (const auto& directoryEntry : std::filesystem::directory_iterator(s_Directory, error))
+		{
+			const std::string filename = directoryEntry.path().filename().string();
+			if (filename.size() == entryNameLength && filename.starts_with(prefix) && filename.ends_with(s_ShaderFileExtension) && directoryEntry.path() != path)
+				std::filesystem::remove(directoryEntry.path(), error);
+		}
+
+		return Filesystem::WriteFileBinary(path, file.data(), file.size());
+	}
+
+	void ShaderCache::Remove(std::string_view shaderName, uint64_t key)
+	{
+		ARC_PROFILE_SCOPE()
+
+		std::error_code error;
+		std::filesystem::remove(GetPath(shaderName, key), error);
+	}
+
+	std::filesystem::path ShaderCache::GetPath(std::string_view shaderName, uint64_t key)
+	{
+		return s_Directory / fmt::format("{}_{:016x}{}", shaderName, key, s_ShaderFileExtension);
+	}
+
+	const std::filesystem::path& ShaderCache::GetDirectory()
+	{
+		return s_Directory;
+	}
+
+	void ShaderCache::SetDirectory(const std::filesystem::path& directory)
+	{
+		s_Directory = directory;
+	}
+}
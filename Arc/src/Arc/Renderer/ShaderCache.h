@@ -0,0 +1,35 @@
+#pragma once
+
+#include <optional>
+
+#include "Arc/Renderer/ShaderUtils.h"
+
+namespace ArcEngine
+{
+	// On-disk cache of linked shader programs along with their reflected material properties.
+	// Entries are keyed by a hash of the preprocessed source and the driver identity, so an edited shader
+	// or a driver update misses and gets compiled again. The cache itself never talks to the driver.
+	class ShaderCache
+	{
+	public:
+		struct Entry
+		{
+			uint32_t BinaryFormat = 0;
+			std::vector<uint8_t> Binary;
+			std::unordered_map<std::string, MaterialProperty, UM_StringTransparentEquality> MaterialProperties;
+			size_t MaterialBlockSize = 0;
+		};
+
+		[[nodiscard]] static uint64_t ComputeKey(const ShaderUtils::StageSources& sources, std::string_view driverIdentity);
+
+		// Returns nothing if the entry is missing or invalid, invalid entries are deleted
+		[[nodiscard]] static std::optional<Entry> Load(std::string_view shaderName, uint64_t key);
+		// Also deletes the entries of older versions of the shader
+		static bool Store(std::string_view shaderName, uint64_t key, const Entry& entry);
+		static void Remove(std::string_view shaderName, uint64_t key);
+
+		[[nodiscard]] static std::filesystem::path GetPath(std::string_view shaderName, uint64_t key);
+		[[nodiscard]] static const std::filesystem::path& GetDirectory();
+		static void SetDirectory(const std::filesystem::path& directory);
+	};
+}
@@ -0,0 +1,225 @@
+#include "arcpch.h"
+#include "Arc/Renderer/ShaderUtils.h"
+
+#include <cctype>
+
+namespace ArcEngine
+{
+	// Splits GLSL into identifiers and the ';', '{', '}' punctuation, skipping comments and everything else
+	static std::vector<std::string_view> Tokenize(std::string_view source)
+	{
+		ARC_PROFILE_SCOPE()
+
+		std::vector<std::string_view> tokens;
+		size_t i = 0;
+		while (i < source.size())
+		{
+			const char c = source[i];
+			if (c == '/' && i + 1 < source.size() && source[i + 1] == '/')
+			{
+				i = source.find('\n', i);
+				if (i == std::string_view::npos)
+					break;
+			}
+			else if (c == '/' && i + 1 < source.size() && source[i + 1] == '*')
+			{
+				i = source.find("*/", i + 2);
+				if (i == std::string_view::npos)
+					break;
+				i += 2;
+			}
+			else if (std::isalnum(static_cast<unsigned char>(c)) || c == '_')
+			{
+				const size_t begin = i;
+				while (i < source.size() && (std::isalnum(static_cast<unsigned char>(source[i])) || source[i] == '_'))
+					++i;
+				tokens.push_back(source.substr(begin, i - begin));
+			}
+			else
+			{
+				if (c == ';' || c == '{' || c == '}')
+					tokens.push_back(source.substr(i, 1));
+				++i;
+			}
+		}
+
+		return tokens;
+	}
+
+	static MaterialPropertyType GetMaterialPropertyType(std::string_view type)
+	{
+		if (type == "sampler2D")	return MaterialPropertyType::Sampler2D;
+		if (type == "bool")			return MaterialPropertyType::Bool;
+		if (type == "int")			return MaterialPropertyType::Int;
+		if (type == "float")		return MaterialPropertyType::Float;
+		if (type == "vec2")			return MaterialPropertyType::Float2;
+		if (type == "vec3")			return MaterialPropertyType::Float3;
+		if (type == "vec4")			return MaterialPropertyType::Float4;
+		return MaterialPropertyType::None;
+	}
+
+	// Calls fn(type, name) for every member of the block opening at tokens[begin] == "{", name is empty for
+	// members that are not a plain "<type> <name>;". Returns the index of the closing "}".
+	template<typename Fn>
+	static size_t ForEachMember(const std::vector<std::string_view>& tokens, size_t begin, Fn&& fn)
+	{
+		size_t member = begin + 1;
+		while (member < tokens.size() && tokens[member] != "}")
+		{
+			size_t end = member;
+			while (end < tokens.size() && tokens[end] != ";" && tokens[end] != "}")
+				++end;
+
+			if (end - member == 2)
+				fn(tokens[member], tokens[member + 1]);
+			else if (end != member)
+				fn(tokens[member], std::string_view());
+
+			member = end < tokens.size() && tokens[end] == ";" ? end + 1 : end;
+		}
+
+		return member;
+	}
+
+	ShaderUtils::StageSources ShaderUtils::PreProcess(std::string_view source)
+	{
+		ARC_PROFILE_SCOPE()
+
+		StageSources shaderSources;
+
+		constexpr const char* typeToken = "#type";
+		constexpr size_t typeTokenLength = std::string_view(typeToken).size();
+		size_t pos = source.find(typeToken, 0);
+		while (pos != std::string::npos)
+		{
+			const size_t eol = source.find_first_of("\r\n", pos);
+			ARC_CORE_ASSERT(eol != std::string::npos, "Syntax error")
+			const size_t begin = pos + typeTokenLength + 1;
+			std::string type = static_cast<std::string>(source.substr(begin, eol - begin));
+
+			const size_t nextLinePos = source.find_first_not_of("\r\n", eol);
+			pos = source.find(typeToken, nextLinePos);
+			shaderSources[std::move(type)] = source.substr(nextLinePos, pos - (nextLinePos == std::string::npos ? source.size() - 1 : nextLinePos));
+		}
+
+		return shaderSources;
+	}
+
+	uint64_t ShaderUtils::Hash(std::string_view data, uint64_t seed)
+	{
+		uint64_t hash = seed;
+		for (const char c : data)
+		{
+			hash ^= static_cast<uint8_t>(c);
+			hash *= 1099511628211ull;
+		}
+		return hash;
+	}
+
+	uint64_t ShaderUtils::Hash(const StageSources& sources, uint64_t seed)
+	{
+		ARC_PROFILE_SCOPE()
+
+		// The terminators keep "ab" + "c" from hashing like "a" + "bc"
+		uint64_t hash = seed;
+		for (const auto& [stage, source] : sources)
+		{
+			hash = Hash(stage, hash);
+			hash = Hash(std::string_view("\0", 1), hash);
+			hash = Hash(source, hash);
+			hash = Hash(std::string_view("\0", 1), hash);
+		}
+		return hash;
+	}
+
+	void ShaderUtils::Reflect(std::string_view shaderName, std::string_view source,
+		std::unordered_map<std::string, MaterialProperty, UM_StringTransparentEquality>& outProperties, size_t& outBlockSize)
+	{
+		ARC_PROFILE_SCOPE()
+
+		outProperties.clear();
+		outBlockSize = 0;
+
+		static constexpr std::string_view prefix = "u_Material.";
+		const std::vector<std::string_view> tokens = Tokenize(source);
+
+		const auto addProperty = [&outProperties](std::string_view member, MaterialPropertyType propertyType, size_t offset, uint32_t slot)
+		{
+			std::string nameStr = std::string(prefix) + std::string(member);
+			const size_t sizeInBytes = Shader::GetSizeInBytes(propertyType);
+			const bool isSlider = nameStr.ends_with("01");
+			const size_t sufixSize = isSlider ? 2 : 0;
+			const bool isColor = nameStr.find("color") != std::string::npos || nameStr.find("Color") != std::string::npos;
+			std::string displayName = nameStr.substr(prefix.size(), nameStr.size() - prefix.size() - sufixSize);
+			outProperties.emplace(std::move(nameStr), MaterialProperty{ propertyType, sizeInBytes, offset, std::move(displayName), isSlider, isColor, slot });
+		};
+
+		// uniform <BlockName> { <type> <name>; ... } u_Material;
+		for (size_t i = 0; i + 2 < tokens.size(); ++i)
+		{
+			if (tokens[i] != "uniform" || tokens[i + 2] != "{")
+				continue;
+
+			std::vector<std::pair<std::string_view, std::string_view>> members;
+			const size_t end = ForEachMember(tokens, i + 2, [&members](std::string_view type, std::string_view name)
+			{
+				members.emplace_back(type, name);
+			});
+			if (end + 1 >= tokens.size() || tokens[end + 1] != "u_Material")
+				continue;
+
+			// Same offsets the driver reports for std140
+			size_t offset = 0;
+			for (const auto& [type, name] : members)
+			{
+				const MaterialPropertyType propertyType = GetMaterialPropertyType(type);
+				if (name.empty() || propertyType == MaterialPropertyType::None || propertyType == MaterialPropertyType::Sampler2D)
+				{
+					ARC_CORE_WARN("Skipping unsupported material member in {}: {}", shaderName, type);
+					continue;
+				}
+
+				const size_t alignment = Shader::GetStd140Alignment(propertyType);
+				offset = (offset + alignment - 1) / alignment * alignment;
+				addProperty(name, propertyType, offset, 0);
+				offset += Shader::GetSizeInBytes(propertyType);
+			}
+			outBlockSize = (offset + 15) / 16 * 16;
+			break;
+		}
+
+		// uniform <StructName> u_MaterialTextures;
+		std::string_view structName;
+		for (size_t i = 0; i + 3 < tokens.size(); ++i)
+		{
+			if (tokens[i] == "uniform" && tokens[i + 2] == "u_MaterialTextures" && tokens[i + 3] == ";")
+			{
+				structName = tokens[i + 1];
+				break;
+			}
+		}
+		if (structName.empty())
+			return;
+
+		// struct <StructName> { sampler2D <name>; ... };
+		for (size_t i = 0; i + 2 < tokens.size(); ++i)
+		{
+			if (tokens[i] == "struct" && tokens[i + 1] == structName && tokens[i + 2] == "{")
+			{
+				uint32_t slot = 0;
+				ForEachMember(tokens, i + 2, [&](std::string_view type, std::string_view name)
+				{
+					if (name.empty() || GetMaterialPropertyType(type) != MaterialPropertyType::Sampler2D)
+					{
+						ARC_CORE_WARN("Skipping unsupported material texture in {}: {}", shaderName, type);
+						return;
+					}
+
+					addProperty(name, MaterialPropertyType::Sampler2D, outBlockSize + slot * sizeof(uint32_t), slot);
+					++slot;
+				});
+				break;
+			}
+		}
+	}
+}
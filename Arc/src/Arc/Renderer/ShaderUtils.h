@@ -0,0 +1,25 @@
+#pragma once
+
+#include "Arc/Renderer/Shader.h"
+
+namespace ArcEngine
+{
+	// Driver independent parts of shader loading, shared by every backend
+	class ShaderUtils
+	{
+	public:
+		// Source of each stage keyed by the name after "#type", ordered so that hashing is stable
+		using StageSources = std::map<std::string, std::string, std::less<>>;
+
+		[[nodiscard]] static StageSources PreProcess(std::string_view source);
+
+		// 64-bit FNV-1a, stable across runs and platforms unlike std::hash
+		[[nodiscard]] static uint64_t Hash(std::string_view data, uint64_t seed = 14695981039346656037ull);
+		[[nodiscard]] static uint64_t Hash(const StageSources& sources, uint64_t seed = 14695981039346656037ull);
+
+		// Finds the std140 u_Material block and the u_MaterialTextures samplers in the source text,
+		// giving the same offsets and texture slots the OpenGL driver reports
+		static void Reflect(std::string_view shaderName, std::string_view source,
+			std::unordered_map<std::string, MaterialProperty, UM_StringTransparentEquality>& outProperties, size_t& outBlockSize);
+	};
+}
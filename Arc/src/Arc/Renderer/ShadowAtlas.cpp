@@ -0,0 +1,116 @@
+#include "arcpch.h"
+#include "Arc/Renderer/ShadowAtlas.h"
+
+#include "Arc/Renderer/Framebuffer.h"
+
+namespace ArcEngine
+{
+	uint32_t ShadowAtlas::GetTileSize(float importance)
+	{
+		uint32_t size = MaxTileSize;
+		while (size > MinTileSize && importance <= 0.5f)
+		{
+			size /= 2;
+			importance *= 2.0f;
+		}
+		return size;
+	}
+
+	void ShadowAtlas::Pack(std::span<const uint32_t> tileSizes, uint32_t atlasSize, std::span<Tile> outTiles)
+	{
+		ARC_PROFILE_SCOPE()
+
+		ARC_CORE_ASSERT(tileSizes.size() == outTiles.size(), "Every tile size needs an output tile")
+
+		std::vector<uint32_t> order(tileSizes.size());
+		for (uint32_t i = 0; i < order.size(); ++i)
+			order[i] = i;
+		std::ranges::stable_sort(order, [&tileSizes](uint32_t a, uint32_t b) { return tileSizes[a] > tileSizes[b]; });
+
+		// Free squares of the atlas. Placing the largest tiles first and always splitting the smallest free square
+		// that fits keeps power of two tiles packed without gaps.
+		std::vector<Tile> freeTiles;
+		if (atlasSize != 0)
+			freeTiles.push_back({ 0, 0, atlasSize });
+
+		for (const uint32_t index : order)
+		{
+			outTiles[index] = {};
+			for (uint32_t size = tileSizes[index]; size >= MinTileSize; size /= 2)
+			{
+				auto best = freeTiles.end();
+				for (auto it = freeTiles.begin(); it != freeTiles.end(); ++it)
+				{
+					if (it->Size >= size && (best == freeTiles.end() || it->Size < best->Size))
+						best = it;
+				}
+				if (best == freeTiles.end())
+					continue;
+
+				Tile tile = *best;
+				freeTiles.erase(best);
+				while (tile.Size > size)
+				{
+					tile.Size /= 2;
+					freeTiles.push_back({ tile.X + tile.Size, tile.Y, tile.Size });
+					freeTiles.push_back({ tile.X, tile.Y + tile.Size, tile.Size });
+					freeTiles.push_back({ tile.X + tile.Size, tile.Y + tile.Size, tile.Size });
+				}
+
+				outTiles[index] = tile;
+				break;
+			}
+		}
+	}
+
+	void ShadowAtlas::Allocate(std::span<const float> importances, std::vector<Tile>& outTiles)
+	{
+		ARC_PROFILE_SCOPE()
+
+		outTiles.assign(importances.size(), {});
+		if (importances.empty())
+		{
+			Release();
+			return;
+		}
+
+		std::vector<uint32_t> tileSizes(importances.size());
+		uint64_t area = 0;
+		uint32_t largestTile = 0;
+		for (size_t i = 0; i < importances.size(); ++i)
+		{
+			tileSizes[i] = GetTileSize(importances[i]);
+			area += static_cast<uint64_t>(tileSizes[i]) * tileSizes[i];
+			largestTile = glm::max(largestTile, tileSizes[i]);
+		}
+
+		// Smallest power of two square that holds every tile
+		uint32_t size = largestTile;
+		while (size < MaxSize && static_cast<uint64_t>(size) * size < area)
+			size *= 2;
+
+		if (size != m_Size)
+		{
+			m_Size = size;
+			const FramebufferSpecification spec{ size, size, { FramebufferTextureFormat::Depth } };
+			m_Framebuffer = Framebuffer::Create(spec);
+		}
+
+		Pack(tileSizes, m_Size, outTiles);
+	}
+
+	void ShadowAtlas::Release()
+	{
+		m_Framebuffer = nullptr;
+		m_Size = 0;
+	}
+
+	glm::vec4 ShadowAtlas::GetUVRect(const Tile& tile) const
+	{
+		if (!tile.IsValid() || m_Size == 0)
+			return glm::vec4(0.0f);
+
+		const float invSize = 1.0f / static_cast<float>(m_Size);
+		return glm::vec4(static_cast<float>(tile.X), static_cast<float>(tile.Y), static_cast<float>(tile.Size), static_cast<float>(tile.Size)) * invSize;
+	}
+}
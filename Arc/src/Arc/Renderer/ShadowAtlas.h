@@ -0,0 +1,47 @@
+#pragma once
+
+#include <span>
+
+namespace ArcEngine
+{
+	class Framebuffer;
+
+	// One depth texture shared by every shadow casting light, each light renders into a square tile of it.
+	// The texture is only created once something casts shadows and is sized to what the lights need.
+	class ShadowAtlas
+	{
+	public:
+		struct Tile
+		{
+			uint32_t X = 0;
+			uint32_t Y = 0;
+			uint32_t Size = 0;
+
+			[[nodiscard]] bool IsValid() const { return Size != 0; }
+		};
+
+		static constexpr uint32_t MaxSize = 4096;
+		static constexpr uint32_t MaxTileSize = 2048;
+		static constexpr uint32_t MinTileSize = 256;
+
+		// Power of two tile size for an importance in [0, 1], every halving of importance halves the size
+		[[nodiscard]] static uint32_t GetTileSize(float importance);
+
+		// Packs square power of two tiles into an atlas of atlasSize, largest first.
+		// Tiles that do not fit are halved until they do, below MinTileSize they stay invalid.
+		static void Pack(std::span<const uint32_t> tileSizes, uint32_t atlasSize, std::span<Tile> outTiles);
+
+		// Lays out one tile per light and (re)creates the texture to fit them, releases it if there are none
+		void Allocate(std::span<const float> importances, std::vector<Tile>& outTiles);
+		void Release();
+
+		[[nodiscard]] const Ref<Framebuffer>& GetFramebuffer() const { return m_Framebuffer; }
+		[[nodiscard]] uint32_t GetSize() const { return m_Size; }
+		// xy: offset, zw: scale of the tile in texture coordinates
+		[[nodiscard]] glm::vec4 GetUVRect(const Tile& tile) const;
+
+	private:
+		Ref<Framebuffer> m_Framebuffer = nullptr;
+		uint32_t m_Size = 0;
+	};
+}
@@ -0,0 +1,97 @@
+#include "arcpch.h"
+#include "Arc/Renderer/ShadowCascades.h"
+
+namespace ArcEngine
+{
+	static float GetViewDepth(const glm::mat4& inverseProjection, float ndcDepth)
+	{
+		const glm::vec4 point = inverseProjection * glm::vec4(0.0f, 0.0f, ndcDepth, 1.0f);
+		return -point.z / point.w;
+	}
+
+	void ShadowCascades::GetDepthRange(const glm::mat4& projection, float& outNear, float& outFar)
+	{
+		const glm::mat4 inverseProjection = glm::inverse(projection);
+		outNear = GetViewDepth(inverseProjection, -1.0f);
+		outFar = GetViewDepth(inverseProjection, 1.0f);
+	}
+
+	void ShadowCascades::ComputeSplits(float nearDepth, float farDepth, float lambda, std::span<float> outSplits)
+	{
+		ARC_PROFILE_SCOPE()
+
+		const size_t count = outSplits.size();
+		// Logarithmic splits need a positive near plane
+		const float logNear = glm::max(nearDepth, 0.001f);
+		for (size_t i = 0; i < count; ++i)
+		{
+			const float t = static_cast<float>(i + 1) / static_cast<float>(count);
+			const float logSplit = logNear * glm::pow(farDepth / logNear, t);
+			const float uniformSplit = nearDepth + (farDepth - nearDepth) * t;
+			outSplits[i] = glm::mix(uniformSplit, logSplit, lambda);
+		}
+
+		if (count != 0)
+			outSplits[count - 1] = farDepth;
+	}
+
+	ShadowCascades::Cascade ShadowCascades::Fit(const glm::mat4& cameraView, const glm::mat4& cameraProjection, float nearDepth, float farDepth,
+		const glm::vec3& lightDirection, uint32_t resolution, float casterDistance)
+	{
+		ARC_PROFILE_SCOPE()
+
+		ARC_CORE_ASSERT(resolution != 0, "Cascade needs a resolution")
+
+		// Corners of the slice in view space. Depth changes linearly along each edge of the frustum,
+		// so the slice corners are found by walking from the near to the far corner.
+		const glm::mat4 inverseProjection = glm::inverse(cameraProjection);
+		float cameraNear, cameraFar;
+		GetDepthRange(cameraProjection, cameraNear, cameraFar);
+
+		const float depthRange = cameraFar - cameraNear;
+		const float tNear = depthRange != 0.0f ? (nearDepth - cameraNear) / depthRange : 0.0f;
+		const float tFar = depthRange != 0.0f ? (farDepth - cameraNear) / depthRange : 1.0f;
+
+		std::array<glm::vec3, 8> corners;
+		glm::vec3 center(0.0f);
+		for (uint32_t i = 0; i < 4; ++i)
+		{
+			const glm::vec2 ndc = { (i & 1) ? 1.0f : -1.0f, (i & 2) ? 1.0f : -1.0f };
+			glm::vec4 nearCorner = inverseProjection * glm::vec4(ndc, -1.0f, 1.0f);
+			glm::vec4 farCorner = inverseProjection * glm::vec4(ndc, 1.0f, 1.0f);
+			nearCorner /= nearCorner.w;
+			farCorner /= farCorner.w;
+
+			corners[i] = glm::mix(glm::vec3(nearCorner), glm::vec3(farCorner), tNear);
+			corners[i + 4] = glm::mix(glm::vec3(nearCorner), glm::vec3(farCorner), tFar);
+			center += corners[i] + corners[i + 4];
+		}
+		center /= 8.0f;
+
+		float radius = 0.0f;
+		for (const glm::vec3& corner : corners)
+			radius = glm::max(radius, glm::length(corner - center));
+		// Rounded up so that floating point noise does not change the texel size from frame to frame
+		radius = glm::ceil(radius * 16.0f) / 16.0f;
+
+		const glm::vec3 worldCenter = glm::vec3(glm::inverse(cameraView) * glm::vec4(center, 1.0f));
+
+		// The light view only depends on the direction, the center moves inside it in whole texels
+		const glm::vec3 direction = glm::normalize(lightDirection);
+		const glm::vec3 up = glm::abs(direction.y) > 0.99f ? glm::vec3(0.0f, 0.0f, 1.0f) : glm::vec3(0.0f, 1.0f, 0.0f);
+		const glm::mat4 lightView = glm::lookAt(glm::vec3(0.0f), direction, up);
+
+		glm::vec3 lightCenter = glm::vec3(lightView * glm::vec4(worldCenter, 1.0f));
+		const float texelSize = 2.0f * radius / static_cast<float>(resolution);
+		lightCenter.x = glm::floor(lightCenter.x / texelSize) * texelSize;
+		lightCenter.y = glm::floor(lightCenter.y / texelSize) * texelSize;
+
+		// The light looks down -Z, so the depth of the center is -lightCenter.z
+		const glm::mat4 lightProjection = glm::ortho(
+			lightCenter.x - radius, lightCenter.x + radius,
+			lightCenter.y - radius, lightCenter.y + radius,
+			-lightCenter.z - radius - casterDistance, -lightCenter.z + radius);
+
+		return { lightProjection * lightView, farDepth };
+	}
+}
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <span>
+
+namespace ArcEngine
+{
+	// CPU side of cascaded shadow maps for directional lights. Pure math so that it runs without a renderer.
+	class ShadowCascades
+	{
+	public:
+		static constexpr uint32_t MaxCascades = 4;
+
+		struct Cascade
+		{
+			// Orthographic light projection, its near plane is pulled towards the light so that casters outside of the view still land in it
+			glm::mat4 ViewProjection = glm::mat4(1.0f);
+			// View space distance from the camera where the cascade ends
+			float SplitDepth = 0.0f;
+		};
+
+		// Distance of the near and far planes of a perspective or orthographic OpenGL projection
+		static void GetDepthRange(const glm::mat4& projection, float& outNear, float& outFar);
+
+		// Far depth of each cascade, blending logarithmic (lambda = 1) and uniform (lambda = 0) splits
+		static void ComputeSplits(float nearDepth, float farDepth, float lambda, std::span<float> outSplits);
+
+		// Fits a cascade around the part of the camera frustum between nearDepth and farDepth.
+		// The bounds are a sphere so they do not change size as the camera rotates, and the projection is snapped to
+		// texels of a resolution sized map so that shadow edges do not shimmer as the camera moves.
+		// Casters up to casterDistance in front of the sphere, towards the light, still land in the map.
+		[[nodiscard]] static Cascade Fit(const glm::mat4& cameraView, const glm::mat4& cameraProjection, float nearDepth, float farDepth,
+			const glm::vec3& lightDirection, uint32_t resolution, float casterDistance);
+	};
+}
@@ -0,0 +1,462 @@
+#include "arcpch.h"
+#include "Arc/Renderer/SpriteAtlas.h"
+
+#include <stb_image.h>
+
+#include "Arc/Core/Filesystem.h"
+#include "Arc/Renderer/ShaderUtils.h"
+#include "Arc/Renderer/Texture.h"
+
+namespace ArcEngine
+{
+	// Atlas file layout, all offsets are from the start of the file:
+	// header | page table | region table | string table | page pixels
+	static constexpr char s_AtlasFileMagic[4] = { 'A', 'S', 'P', 'A' };
+	static constexpr uint32_t s_AtlasFileVersion = 1;
+	static constexpr std::string_view s_AtlasFileExtension = ".arcatlas";
+
+	static std::filesystem::path s_Directory = "Cache/SpriteAtlases";
+
+	struct AtlasFileHeader
+	{
+		char Magic[4];
+		uint32_t Version;
+		uint64_t Key;
+
+		uint32_t PageCount;
+		uint32_t RegionCount;
+
+		uint64_t PageTableOffset;
+		uint64_t RegionTableOffset;
+		uint64_t StringTableOffset;
+		uint64_t StringTableSize;
+	};
+
+	struct AtlasFilePage
+	{
+		uint32_t Size;
+		uint32_t Padding;
+		uint64_t PixelOffset;
+	};
+
+	struct AtlasFileRegion
+	{
+		uint32_t PathOffset;
+		uint32_t PathLength;
+		uint32_t Page;
+		float UVRect[4];
+	};
+
+	static uint64_t AlignOffset(uint64_t offset)
+	{
+		return (offset + 15) & ~static_cast<uint64_t>(15);
+	}
+
+	static uint64_t GetPageByteSize(uint32_t size)
+	{
+		return static_cast<uint64_t>(size) * size * 4;
+	}
+
+	static bool AllPlaced(std::span<const glm::uvec2> positions)
+	{
+		return std::ranges::all_of(positions, [](const glm::uvec2& position) { return position.x != SpriteAtlas::InvalidPosition; });
+	}
+
+	void SpriteAtlas::Pack(std::span<const glm::uvec2> sizes, uint32_t atlasSize, std::span<glm::uvec2> outPositions)
+	{
+		ARC_PROFILE_SCOPE()
+
+		ARC_CORE_ASSERT(sizes.size() == outPositions.size(), "Every size needs an output position")
+
+		std::vector<uint32_t> order(sizes.size());
+		for (uint32_t i = 0; i < order.size(); ++i)
+			order[i] = i;
+		std::ranges::stable_sort(order, [&sizes](uint32_t a, uint32_t b)
+		{
+			return sizes[a].y != sizes[b].y ? sizes[a].y > sizes[b].y : sizes[a].x > sizes[b].x;
+		});
+
+		// Top edge of the packed area, left to right. The segments always cover the whole width.
+		struct Segment
+		{
+			uint32_t X;
+			uint32_t Y;
+			uint32_t Width;
+		};
+		std::vector<Segment> skyline;
+		if (atlasSize != 0)
+			skyline.push_back({ 0, 0, atlasSize });
+
+		for (const uint32_t index : order)
+		{
+			const glm::uvec2 size = sizes[index];
+			outPositions[index] = glm::uvec2(InvalidPosition);
+			if (size.x == 0 || size.y == 0 || size.x > atlasSize || size.y > atlasSize)
+				continue;
+
+			// Lowest spot on the skyline, leftmost on ties
+			size_t best = skyline.size();
+			uint32_t bestY = InvalidPosition;
+			for (size_t i = 0; i < skyline.size() && skyline[i].X + size.x <= atlasSize; ++i)
+			{
+				uint32_t y = 0;
+				for (size_t j = i; j < skyline.size() && skyline[j].X < skyline[i].X + size.x; ++j)
+					y = glm::max(y, skyline[j].Y);
+
+				if (y + size.y <= atlasSize && y < bestY)
+				{
+					best = i;
+					bestY = y;
+				}
+			}
+			if (best == skyline.size())
+				continue;
+
+			const uint32_t x = skyline[best].X;
+			const uint32_t right = x + size.x;
+			outPositions[index] = { x, bestY };
+
+			// Replace the segments under the rectangle with its top edge
+			size_t last = best;
+			while (last < skyline.size() && skyline[last].X + skyline[last].Width <= right)
+				++last;
+			if (last < skyline.size() && skyline[last].X < right)
+			{
+				skyline[last].Width -= right - skyline[last].X;
+				skyline[last].X = right;
+			}
+			skyline.erase(skyline.begin() + static_cast<ptrdiff_t>(best), skyline.begin() + static_cast<ptrdiff_t>(last));
+			skyline.insert(skyline.begin() + static_cast<ptrdiff_t>(best), { x, bestY + size.y, size.x });
+
+			for (size_t i = 0; i + 1 < skyline.size();)
+			{
+				if (skyline[i].Y == skyline[i + 1].Y)
+				{
+					skyline[i].Width += skyline[i + 1].Width;
+					skyline.erase(skyline.begin() + static_cast<ptrdiff_t>(i + 1));
+				}
+				else
+				{
+					++i;
+				}
+			}
+		}
+	}
+
+	uint64_t SpriteAtlas::ComputeKey(std::span<const std::string> paths)
+	{
+		ARC_PROFILE_SCOPE()
+
+		uint64_t key = ShaderUtils::Hash(std::string_view(reinterpret_cast<const char*>(&s_AtlasFileVersion), sizeof(s_AtlasFileVersion)));
+		for (const std::string& path : paths)
+		{
+			std::error_code error;
+			const uint64_t fileSize = std::filesystem::file_size(path, error);
+			const int64_t writeTime = std::filesystem::last_write_time(path, error).time_since_epoch().count();
+
+			key = ShaderUtils::Hash(path, key);
+			key = ShaderUtils::Hash(std::string_view(reinterpret_cast<const char*>(&fileSize), sizeof(fileSize)), key);
+			key = ShaderUtils::Hash(std::string_view(reinterpret_cast<const char*>(&writeTime), sizeof(writeTime)), key);
+		}
+		return key;
+	}
+
+	SpriteAtlas::Data SpriteAtlas::Build(std::span<const std::string> paths)
+	{
+		ARC_PROFILE_SCOPE()
+
+		struct Image
+		{
+			std::string_view Path;
+			glm::uvec2 Size;
+			Ref<stbi_uc> Pixels;
+		};
+
+		std::vector<Image> images;
+		images.reserve(paths.size());
+		for (const std::string& path : paths)
+		{
+			// Flipped like every other texture, so region UVs line up with the standalone texture
+			stbi_set_flip_vertically_on_load(1);
+			int width, height, channels;
+			stbi_uc* pixels = nullptr;
+			{
+				ARC_PROFILE_SCOPE("stbi_load Texture")
+
+				pixels = stbi_load(path.c_str(), &width, &height, &channels, 4);
+			}
+			if (!pixels)
+			{
+				ARC_CORE_ERROR("Failed to load image: {}", path);
+				continue;
+			}
+
+			if (static_cast<uint32_t>(width) > MaxSpriteSize || static_cast<uint32_t>(height) > MaxSpriteSize)
+			{
+				stbi_image_free(pixels);
+				continue;
+			}
+
+			images.push_back({ path, { static_cast<uint32_t>(width), static_cast<uint32_t>(height) }, Ref<stbi_uc>(pixels, stbi_image_free) });
+		}
+
+		Data data;
+		data.Key = ComputeKey(paths);
+
+		std::vector<uint32_t> remaining(images.size());
+		for (uint32_t i = 0; i < remaining.size(); ++i)
+			remaining[i] = i;
+
+		std::vector<glm::uvec2> sizes;
+		std::vector<glm::uvec2> positions;
+		std::vector<glm::uvec2> smallerPositions;
+		while (!remaining.empty())
+		{
+			sizes.resize(remaining.size());
+			for (size_t i = 0; i < remaining.size(); ++i)
+				sizes[i] = images[remaining[i]].Size + 2u * Padding;
+
+			positions.resize(remaining.size());
+			uint32_t pageSize = MaxPageSize;
+			Pack(sizes, pageSize, positions);
+
+			// The last page only needs to be as large as what is left
+			if (AllPlaced(positions))
+			{
+				smallerPositions.resize(remaining.size());
+				while (pageSize / 2 >= MinPageSize)
+				{
+					Pack(sizes, pageSize / 2, smallerPositions);
+					if (!AllPlaced(smallerPositions))
+						break;
+
+					pageSize /= 2;
+					positions.swap(smallerPositions);
+				}
+			}
+
+			const auto pageIndex = static_cast<uint32_t>(data.Pages.size());
+			Page& page = data.Pages.emplace_back();
+			page.Size = pageSize;
+			page.Pixels.assign(GetPageByteSize(pageSize), 0);
+
+			const float invPageSize = 1.0f / static_cast<float>(pageSize);
+			std::vector<uint32_t> unplaced;
+			for (size_t i = 0; i < remaining.size(); ++i)
+			{
+				if (positions[i].x == InvalidPosition)
+				{
+					unplaced.push_back(remaining[i]);
+					continue;
+				}
+
+				// Copy the sprite, clamping the source coordinates repeats its edges into the padding
+				const Image& image = images[remaining[i]];
+				const auto* source = reinterpret_cast<const uint32_t*>(image.Pixels.get());
+				auto* destination = reinterpret_cast<uint32_t*>(page.Pixels.data());
+				const glm::uvec2 paddedSize = image.Size + 2u * Padding;
+				for (uint32_t y = 0; y < paddedSize.y; ++y)
+				{
+					const uint32_t sourceY = glm::clamp(y, Padding, image.Size.y + Padding - 1) - Padding;
+					for (uint32_t x = 0; x < paddedSize.x; ++x)
+					{
+						const uint32_t sourceX = glm::clamp(x, Padding, image.Size.x + Padding - 1) - Padding;
+						destination[(positions[i].y + y) * pageSize + positions[i].x + x] = source[sourceY * image.Size.x + sourceX];
+					}
+				}
+
+				const glm::vec2 offset = glm::vec2(positions[i] + Padding) * invPageSize;
+				const glm::vec2 scale = glm::vec2(image.Size) * invPageSize;
+				data.Regions[std::string(image.Path)] = { pageIndex, glm::vec4(offset.x, offset.y, scale.x, scale.y) };
+			}
+
+			// Every sprite fits an empty page, this only guards against looping forever
+			if (unplaced.size() == remaining.size())
+			{
+				data.Pages.pop_back();
+				break;
+			}
+			remaining.swap(unplaced);
+		}
+
+		return data;
+	}
+
+	bool SpriteAtlas::Save(const Data& data, const std::filesystem::path& filepath)
+	{
+		ARC_PROFILE_SCOPE()
+
+		std::string stringTable;
+		std::vector<AtlasFileRegion> regionTable;
+		regionTable.reserve(data.Regions.size());
+		for (const auto& [path, region] : data.Regions)
+		{
+			AtlasFileRegion& fileRegion = regionTable.emplace_back();
+			fileRegion.PathOffset = static_cast<uint32_t>(stringTable.size());
+			fileRegion.PathLength = static_cast<uint32_t>(path.size());
+			fileRegion.Page = region.Page;
+			for (glm::length_t i = 0; i < 4; ++i)
+				fileRegion.UVRect[i] = region.UVRect[i];
+			stringTable += path;
+		}
+
+		AtlasFileHeader header{};
+		memcpy(header.Magic, s_AtlasFileMagic, sizeof(header.Magic));
+		header.Version = s_AtlasFileVersion;
+		header.Key = data.Key;
+		header.PageCount = static_cast<uint32_t>(data.Pages.size());
+		header.RegionCount = static_cast<uint32_t>(regionTable.size());
+		header.PageTableOffset = AlignOffset(sizeof(AtlasFileHeader));
+		header.RegionTableOffset = AlignOffset(header.PageTableOffset + data.Pages.size() * sizeof(AtlasFilePage));
+		header.StringTableOffset = AlignOffset(header.RegionTableOffset + regionTable.size() * sizeof(AtlasFileRegion));
+		header.StringTableSize = stringTable.size();
+
+		std::vector<AtlasFilePage> pageTable(data.Pages.size());
+		uint64_t fileSize = AlignOffset(header.StringTableOffset + header.StringTableSize);
+		for (size_t i = 0; i < data.Pages.size(); ++i)
+		{
+			ARC_CORE_ASSERT(data.Pages[i].Pixels.size() == GetPageByteSize(data.Pages[i].Size), "Page pixels do not match its size")
+
+			pageTable[i] = { data.Pages[i].Size, 0, fileSize };
+			fileSize += data.Pages[i].Pixels.size();
+		}
+
+		std::vector<uint8_t> file(fileSize, 0);
+		memcpy(file.data(), &header, sizeof(AtlasFileHeader));
+		if (!pageTable.empty())
+			memcpy(file.data() + header.PageTableOffset, pageTable.data(), pageTable.size() * sizeof(AtlasFilePage));
+		if (!regionTable.empty())
+			memcpy(file.data() + header.RegionTableOffset, regionTable.data(), regionTable.size() * sizeof(AtlasFileRegion));
+		if (!stringTable.empty())
+			memcpy(file.data() + header.StringTableOffset, stringTable.data(), stringTable.size());
+		for (size_t i = 0; i < data.Pages.size(); ++i)
+			memcpy(file.data() + pageTable[i].PixelOffset, data.Pages[i].Pixels.data(), data.Pages[i].Pixels.size());
+
+		std::error_code error;
+		if (filepath.has_parent_path())
+			std::filesystem::create_directories(filepath.parent_path(), error);
+
+		return Filesystem::WriteFileBinary(filepath, file.data(), file.size());
+	}
+
+	bool SpriteAtlas::Load(const std::filesystem::path& filepath, uint64_t key, Data& outData)
+	{
+		ARC_PROFILE_SCOPE()
+
+		ScopedBuffer file(Filesystem::ReadFileBinary(filepath));
+		if (!file.Data())
+			return false;
+
+		const auto invalid = [&filepath](const char* reason)
+		{
+			ARC_CORE_WARN("Ignoring sprite atlas {}: {}", filepath.string(), reason);
+			return false;
+		};
+
+		if (file.Size() < sizeof(AtlasFileHeader))
+			return invalid("file is truncated");
+
+		AtlasFileHeader header;
+		memcpy(&header, file.Data(), sizeof(AtlasFileHeader));
+
+		if (memcmp(header.Magic, s_AtlasFileMagic, sizeof(header.Magic)) != 0 || header.Version != s_AtlasFileVersion)
+			return invalid("file is from another version");
+		if (header.Key != key)
+			return false;
+
+		const uint64_t size = file.Size();
+		if (header.PageTableOffset + header.PageCount * sizeof(AtlasFilePage) > size
+			|| header.RegionTableOffset + header.RegionCount * sizeof(AtlasFileRegion) > size
+			|| header.StringTableOffset + header.StringTableSize > size)
+		{
+			return invalid("file is truncated");
+		}
+
+		Data data;
+		data.Key = header.Key;
+
+		std::vector<AtlasFilePage> pageTable(header.PageCount);
+		memcpy(pageTable.data(), file.Data() + header.PageTableOffset, pageTable.size() * sizeof(AtlasFilePage));
+		data.Pages.reserve(pageTable.size());
+		for (const AtlasFilePage& filePage : pageTable)
+		{
+			if (filePage.Size < MinPageSize || filePage.Size > MaxPageSize || (filePage.Size & (filePage.Size - 1)) != 0)
+				return invalid("page table is corrupt");
+			if (filePage.PixelOffset + GetPageByteSize(filePage.Size) > size)
+				return invalid("file is truncated");
+
+			Page& page = data.Pages.emplace_back();
+			page.Size = filePage.Size;
+			const uint8_t* pixels = file.Data() + filePage.PixelOffset;
+			page.Pixels.assign(pixels, pixels + GetPageByteSize(filePage.Size));
+		}
+
+		const std::string_view stringTable(reinterpret_cast<const char*>(file.Data() + header.StringTableOffset), header.StringTableSize);
+		std::vector<AtlasFileRegion> regionTable(header.RegionCount);
+		memcpy(regionTable.data(), file.Data() + header.RegionTableOffset, regionTable.size() * sizeof(AtlasFileRegion));
+		for (const AtlasFileRegion& fileRegion : regionTable)
+		{
+			if (static_cast<uint64_t>(fileRegion.PathOffset) + fileRegion.PathLength > stringTable.size() || fileRegion.Page >= header.PageCount)
+				return invalid("region table is corrupt");
+
+			const glm::vec4 uvRect = { fileRegion.UVRect[0], fileRegion.UVRect[1], fileRegion.UVRect[2], fileRegion.UVRect[3] };
+			data.Regions.emplace(std::string(stringTable.substr(fileRegion.PathOffset, fileRegion.PathLength)), Region{ fileRegion.Page, uvRect });
+		}
+
+		outData = std::move(data);
+		return true;
+	}
+
+	Ref<SpriteAtlas> SpriteAtlas::Create(const Data& data)
+	{
+		ARC_PROFILE_SCOPE()
+
+		Ref<SpriteAtlas> atlas = CreateRef<SpriteAtlas>();
+		atlas->m_Pages.reserve(data.Pages.size());
+		for (const Page& page : data.Pages)
+		{
+			Ref<Texture2D> texture = Texture2D::Create();
+			texture->Invalidate("", page.Size, page.Size, page.Pixels.data(), 4);
+			atlas->m_Pages.push_back(texture);
+		}
+		atlas->m_Regions = data.Regions;
+		return atlas;
+	}
+
+	Ref<SpriteAtlas> SpriteAtlas::Create(std::span<const std::string> paths)
+	{
+		ARC_PROFILE_SCOPE()
+
+		// Named after the set of sprites, the key inside tells if the images changed since
+		uint64_t nameHash = ShaderUtils::Hash("");
+		for (const std::string& path : paths)
+			nameHash = ShaderUtils::Hash(path, ShaderUtils::Hash(std::string_view("\0", 1), nameHash));
+		const std::filesystem::path filepath = s_Directory / fmt::format("{:016x}{}", nameHash, s_AtlasFileExtension);
+
+		Data data;
+		if (!Load(filepath, ComputeKey(paths), data))
+		{
+			data = Build(paths);
+			if (!Save(data, filepath))
+				ARC_CORE_WARN("Failed to write sprite atlas {}", filepath.string());
+		}
+
+		return Create(data);
+	}
+
+	const SpriteAtlas::Region* SpriteAtlas::GetRegion(std::string_view path) const
+	{
+		const auto it = m_Regions.find(path);
+		return it != m_Regions.end() ? &it->second : nullptr;
+	}
+
+	const std::filesystem::path& SpriteAtlas::GetDirectory()
+	{
+		return s_Directory;
+	}
+
+	void SpriteAtlas::SetDirectory(const std::filesystem::path& directory)
+	{
+		s_Directory = directory;
+	}
+}
@@ -0,0 +1,73 @@
+#pragma once
+
+#include <span>
+
+#include "Arc/Utils/StringUtils.h"
+
+namespace ArcEngine
+{
+	class Texture2D;
+
+	// Sprite images packed into a few shared pages, so that sprites with different images still draw in one batch.
+	// Building, baking and loading only touch the CPU side data, Create uploads it.
+	class SpriteAtlas
+	{
+	public:
+		static constexpr uint32_t MaxPageSize = 4096;
+		static constexpr uint32_t MinPageSize = 64;
+		// Larger images stay standalone textures
+		static constexpr uint32_t MaxSpriteSize = 1024;
+		// Edge pixels of every sprite are repeated this far outwards, so filtering and mip maps do not pick up its neighbours
+		static constexpr uint32_t Padding = 2;
+
+		static constexpr uint32_t InvalidPosition = std::numeric_limits<uint32_t>::max();
+
+		struct Region
+		{
+			uint32_t Page = 0;
+			// xy: offset, zw: scale of the sprite in texture coordinates
+			glm::vec4 UVRect = glm::vec4(0.0f);
+		};
+
+		struct Page
+		{
+			uint32_t Size = 0;
+			std::vector<uint8_t> Pixels;		// RGBA8, Size * Size
+		};
+
+		struct Data
+		{
+			// Hash of the source paths, sizes and write times, tells if baked data is still current
+			uint64_t Key = 0;
+			std::vector<Page> Pages;
+			std::unordered_map<std::string, Region, UM_StringTransparentEquality> Regions;
+		};
+
+		// Skyline packing of rectangles into a square of atlasSize, tallest first.
+		// Rectangles that do not fit get InvalidPosition.
+		static void Pack(std::span<const glm::uvec2> sizes, uint32_t atlasSize, std::span<glm::uvec2> outPositions);
+
+		[[nodiscard]] static uint64_t ComputeKey(std::span<const std::string> paths);
+		// Decodes and packs the images, images that cannot be loaded or are too large are left out
+		[[nodiscard]] static Data Build(std::span<const std::string> paths);
+
+		// Baked atlas files, Load fails if the file is invalid or its key does not match
+		static bool Save(const Data& data, const std::filesystem::path& filepath);
+		[[nodiscard]] static bool Load(const std::filesystem::path& filepath, uint64_t key, Data& outData);
+
+		[[nodiscard]] static Ref<SpriteAtlas> Create(const Data& data);
+		// Uses the baked atlas under the cache directory if it is still current, otherwise builds and bakes it
+		[[nodiscard]] static Ref<SpriteAtlas> Create(std::span<const std::string> paths);
+
+		[[nodiscard]] const Region* GetRegion(std::string_view path) const;
+		[[nodiscard]] const Ref<Texture2D>& GetPage(uint32_t index) const { return m_Pages[index]; }
+		[[nodiscard]] uint32_t GetPageCount() const { return static_cast<uint32_t>(m_Pages.size()); }
+
+		[[nodiscard]] static const std::filesystem::path& GetDirectory();
+		static void SetDirectory(const std::filesystem::path& directory);
+
+	private:
+		std::vector<Ref<Texture2D>> m_Pages;
+		std::unordered_map<std::string, Region, UM_StringTransparentEquality> m_Regions;
+	};
+}
@@ -4,6 +4,7 @@
 #include "Arc/Renderer/Renderer.h"
 #include "Platform/OpenGL/OpenGLTexture.h"
 #include "Platform/OpenGL/OpenGLTextureCubemap.h"
+#include "Platform/Null/NullTexture.h"
 
 namespace ArcEngine
 {
@@ -11,7 +12,7 @@ namespace ArcEngine
 	{
 		switch (Renderer::GetAPI())
 		{
-			case RendererAPI::API::None:	ARC_CORE_ASSERT(false, "RendererAPI::None is currently not supported!") return nullptr;
+			case RendererAPI::API::None:	return CreateRef<NullTexture2D>();
 			case RendererAPI::API::OpenGL:	return CreateRef<OpenGLTexture2D>();
 		}
 
@@ -23,7 +24,7 @@ namespace ArcEngine
 	{
 		switch (Renderer::GetAPI())
 		{
-			case RendererAPI::API::None:	ARC_CORE_ASSERT(false, "RendererAPI::None is currently not supported!") return nullptr;
+			case RendererAPI::API::None:	return CreateRef<NullTexture2D>(width, height);
 			case RendererAPI::API::OpenGL:	return CreateRef<OpenGLTexture2D>(width, height);
 		}
 
@@ -35,7 +36,7 @@ namespace ArcEngine
 	{
 		switch (Renderer::GetAPI())
 		{
-			case RendererAPI::API::None:	ARC_CORE_ASSERT(false, "RendererAPI::None is currently not supported!") return nullptr;
+			case RendererAPI::API::None:	return CreateRef<NullTexture2D>(path);
 			case RendererAPI::API::OpenGL:	return CreateRef<OpenGLTexture2D>(path);
 		}
 
@@ -47,7 +48,7 @@ namespace ArcEngine
 	{
 		switch (Renderer::GetAPI())
 		{
-			case RendererAPI::API::None:	ARC_CORE_ASSERT(false, "RendererAPI::None is currently not supported!") return nullptr;
+			case RendererAPI::API::None:	return CreateRef<NullTextureCubemap>();
 			case RendererAPI::API::OpenGL:	return CreateRef<OpenGLTextureCubemap>();
 		}
 
@@ -59,7 +60,7 @@ namespace ArcEngine
 	{
 		switch (Renderer::GetAPI())
 		{
-			case RendererAPI::API::None:	ARC_CORE_ASSERT(false, "RendererAPI::None is currently not supported!") return nullptr;
+			case RendererAPI::API::None:	return CreateRef<NullTextureCubemap>(path);
 			case RendererAPI::API::OpenGL:	return CreateRef<OpenGLTextureCubemap>(path);
 		}
 
@@ -0,0 +1,1416 @@
+#include "arcpch.h"
+#include "Arc/Scene/BinarySceneSerializer.h"
+
+#include <fstream>
+
+#include "Arc/Audio/AudioListener.h"
+#include "Arc/Audio/AudioSource.h"
+#include "Arc/Core/AssetManager.h"
+#include "Arc/Core/Filesystem.h"
+#include "Arc/Core/MappedFile.h"
+#include "Arc/Project/Project.h"
+#include "Arc/Scene/Components.h"
+#include "Arc/Scene/Entity.h"
+#include "Arc/Scene/EntitySerializer.h"
+#include "Arc/Scene/Scene.h"
+#include "Arc/Scripting/ScriptEngine.h"
+#include "Arc/Utils/ColorUtils.h"
+
+namespace ArcEngine
+{
+	// Binary scene file layout, all offsets are from the start of the file:
+	// header | entity table | chunk table | chunks | string table | string data
+	// The entity table holds the UUID of every entity. A chunk holds one component type: the indices of the
+	// entities that have it, followed by the components. Plain data components are stored as they are in
+	// memory with a fixed stride, the others as a stream of fields. Strings are stored once and referred
+	// to by their index in the string table.
+	// Chunks carry their own version, so the layout of a component can change without touching the others.
+	// Chunks of unknown components are skipped.
+	static constexpr char s_SceneFileMagic[4] = { 'A', 'S', 'C', 'N' };
+	static constexpr uint32_t s_SceneFileVersion = 1;
+
+	struct SceneFileString
+	{
+		uint32_t Offset = 0;
+		uint32_t Length = 0;
+	};
+
+	struct SceneFileHeader
+	{
+		char Magic[4];
+		uint32_t Version;
+		uint32_t EntityCount;
+		uint32_t ChunkCount;
+		uint32_t StringCount;
+		uint32_t Padding;
+
+		uint64_t EntityTableOffset;
+		uint64_t ChunkTableOffset;
+		uint64_t StringTableOffset;
+		uint64_t StringDataOffset;
+		uint64_t StringDataSize;
+	};
+
+	struct SceneFileChunk
+	{
+		uint32_t Component;
+		uint32_t Version;
+		uint32_t Count;
+		// Size of one component, zero if they are stored as fields
+		uint32_t Stride;
+
+		uint64_t EntityOffset;
+		uint64_t DataOffset;
+		uint64_t DataSize;
+	};
+
+	// Values are stored in the file, never change them
+	enum class SceneFileComponent : uint32_t
+	{
+		Tag = 1,
+		Transform = 2,
+		Relationship = 3,
+		Camera = 4,
+		SpriteRenderer = 5,
+		SkyLight = 6,
+		Light = 7,
+		ParticleSystem = 8,
+		Rigidbody2D = 9,
+		BoxCollider2D = 10,
+		CircleCollider2D = 11,
+		PolygonCollider2D = 12,
+		DistanceJoint2D = 13,
+		SpringJoint2D = 14,
+		HingeJoint2D = 15,
+		SliderJoint2D = 16,
+		WheelJoint2D = 17,
+		BuoyancyEffector2D = 18,
+		Rigidbody = 19,
+		BoxCollider = 20,
+		SphereCollider = 21,
+		CapsuleCollider = 22,
+		TaperedCapsuleCollider = 23,
+		CylinderCollider = 24,
+		Mesh = 25,
+		Script = 26,
+		AudioSource = 27,
+		AudioListener = 28,
+
+		Count
+	};
+
+	static uint64_t AlignOffset(uint64_t offset)
+	{
+		return (offset + 7) & ~static_cast<uint64_t>(7);
+	}
+
+	// Asset paths are stored relative to the project, like the YAML format does
+	template<typename T>
+	static std::string GetAssetPath(const Ref<T>& asset)
+	{
+		std::string path;
+		if (asset)
+		{
+			if constexpr (std::is_same_v<T, Mesh>)
+				path = asset->GetFilepath();
+			else
+				path = asset->GetPath();
+		}
+
+		if (Project::IsPartOfProject(path))
+			path = Project::GetAssetRelativeFileSystemPath(path).string();
+		std::replace(path.begin(), path.end(), '\\', '/');
+		return path;
+	}
+
+	class SceneFileStrings
+	{
+	public:
+		uint32_t Intern(std::string_view str)
+		{
+			const auto it = m_Indices.find(str);
+			if (it != m_Indices.end())
+				return it->second;
+
+			const auto index = static_cast<uint32_t>(m_Table.size());
+			m_Table.push_back({ static_cast<uint32_t>(m_Data.size()), static_cast<uint32_t>(str.size()) });
+			m_Data += str;
+			m_Indices.emplace(str, index);
+			return index;
+		}
+
+		template<typename T>
+		uint32_t InternAsset(const Ref<T>& asset)
+		{
+			// Making the path project relative goes to the filesystem, so it is only done once per asset
+			const auto [it, inserted] = m_AssetIndices.try_emplace(asset.get(), 0);
+			if (inserted)
+				it->second = Intern(GetAssetPath(asset));
+			return it->second;
+		}
+
+		[[nodiscard]] const std::vector<SceneFileString>& GetTable() const { return m_Table; }
+		[[nodiscard]] const std::string& GetData() const { return m_Data; }
+
+	private:
+		std::unordered_map<std::string, uint32_t, UM_StringTransparentEquality> m_Indices;
+		std::unordered_map<const void*, uint32_t> m_AssetIndices;
+		std::vector<SceneFileString> m_Table;
+		std::string m_Data;
+	};
+
+	class SceneFileWriter
+	{
+	public:
+		SceneFileWriter(std::vector<uint8_t>& data, SceneFileStrings& strings)
+			: m_Data(data), m_Strings(strings)
+		{
+		}
+
+		template<typename T>
+		void Value(const T& value)
+		{
+			static_assert(std::is_trivially_copyable_v<T>);
+
+			const size_t offset = m_Data.size();
+			m_Data.resize(offset + sizeof(T));
+			memcpy(m_Data.data() + offset, &value, sizeof(T));
+		}
+
+		// Same bytes as the struct in memory, with the padding between the members zeroed so that
+		// saving the same scene twice gives the same file
+		template<typename T, typename... Member>
+		void Fields(const T& value, Member T::*... members)
+		{
+			static_assert(std::is_trivially_copyable_v<T>);
+			static_assert((sizeof(Member) + ...) <= sizeof(T));
+
+			const size_t offset = m_Data.size();
+			m_Data.resize(offset + sizeof(T), 0);
+			const auto* base = reinterpret_cast<const uint8_t*>(&value);
+			([&]
+			{
+				const auto* member = reinterpret_cast<const uint8_t*>(&(value.*members));
+				memcpy(m_Data.data() + offset + (member - base), member, sizeof(Member));
+			}(), ...);
+		}
+
+		template<typename T>
+		void Array(const std::vector<T>& values)
+		{
+			static_assert(std::is_trivially_copyable_v<T>);
+
+			Value(static_cast<uint32_t>(values.size()));
+			const size_t offset = m_Data.size();
+			m_Data.resize(offset + values.size() * sizeof(T));
+			if (!values.empty())
+				memcpy(m_Data.data() + offset, values.data(), values.size() * sizeof(T));
+		}
+
+		void String(std::string_view value)
+		{
+			Value(m_Strings.Intern(value));
+		}
+
+		template<typename T>
+		void Asset(const Ref<T>& asset)
+		{
+			Value(m_Strings.InternAsset(asset));
+		}
+
+	private:
+		std::vector<uint8_t>& m_Data;
+		SceneFileStrings& m_Strings;
+	};
+
+	// Resolves every asset path once, entities that share an asset share the lookup
+	class SceneFileAssets
+	{
+	public:
+		explicit SceneFileAssets(const std::vector<std::string_view>& strings)
+			: m_Strings(strings), m_Paths(strings.size()), m_Resolved(strings.size(), false)
+		{
+		}
+
+		template<typename T>
+		void Load(uint32_t index, Ref<T>& outAsset)
+		{
+			const std::string& path = GetPath(index);
+			if (path.empty())
+				return;
+
+			if constexpr (std::is_same_v<T, AudioSource>)
+			{
+				// Every source plays on its own, so they are not shared
+				outAsset = AssetManager::LoadAudioSource(path);
+			}
+			else
+			{
+				Ref<T>& cached = GetCache<T>()[index];
+				if (!cached)
+				{
+					if constexpr (std::is_same_v<T, Texture2D>)
+						cached = AssetManager::GetTexture2D(path);
+					else if constexpr (std::is_same_v<T, TextureCubemap>)
+						cached = AssetManager::GetTextureCubemap(path);
+					else if constexpr (std::is_same_v<T, Mesh>)
+						cached = AssetManager::GetMesh(path);
+				}
+				outAsset = cached;
+			}
+		}
+
+	private:
+		const std::string& GetPath(uint32_t index)
+		{
+			if (!m_Resolved[index])
+			{
+				m_Resolved[index] = true;
+				const std::string_view str = m_Strings[index];
+				if (!str.empty())
+					m_Paths[index] = EntitySerializer::ResolveAssetPath(std::string(str));
+			}
+			return m_Paths[index];
+		}
+
+		template<typename T>
+		std::unordered_map<uint32_t, Ref<T>>& GetCache()
+		{
+			if constexpr (std::is_same_v<T, Texture2D>)
+				return m_Textures;
+			else if constexpr (std::is_same_v<T, TextureCubemap>)
+				return m_Cubemaps;
+			else
+				return m_Meshes;
+		}
+
+	private:
+		const std::vector<std::string_view>& m_Strings;
+		std::vector<std::string> m_Paths;
+		std::vector<bool> m_Resolved;
+
+		std::unordered_map<uint32_t, Ref<Texture2D>> m_Textures;
+		std::unordered_map<uint32_t, Ref<TextureCubemap>> m_Cubemaps;
+		std::unordered_map<uint32_t, Ref<Mesh>> m_Meshes;
+	};
+
+	class SceneFileReader
+	{
+	public:
+		SceneFileReader(const uint8_t* data, uint64_t size, uint32_t version, const std::vector<std::string_view>& strings, SceneFileAssets& assets)
+			: m_Data(data), m_Size(size), m_Version(version), m_Strings(strings), m_Assets(assets)
+		{
+		}
+
+		template<typename T>
+		void Value(T& value)
+		{
+			static_assert(std::is_trivially_copyable_v<T>);
+
+			if (!Reserve(sizeof(T)))
+				return;
+
+			memcpy(&value, m_Data + m_Offset, sizeof(T));
+			m_Offset += sizeof(T);
+		}
+
+		template<typename T>
+		void Array(std::vector<T>& values)
+		{
+			static_assert(std::is_trivially_copyable_v<T>);
+
+			uint32_t count = 0;
+			Value(count);
+			if (!Reserve(static_cast<uint64_t>(count) * sizeof(T)))
+				return;
+
+			values.resize(count);
+			if (count > 0)
+				memcpy(values.data(), m_Data + m_Offset, count * sizeof(T));
+			m_Offset += count * sizeof(T);
+		}
+
+		[[nodiscard]] std::string_view String()
+		{
+			uint32_t index = 0;
+			Value(index);
+			if (index >= m_Strings.size())
+			{
+				m_Failed = true;
+				return {};
+			}
+			return m_Strings[index];
+		}
+
+		void String(std::string& value)
+		{
+			value = String();
+		}
+
+		template<typename T>
+		void Asset(Ref<T>& asset)
+		{
+			uint32_t index = 0;
+			Value(index);
+			if (index >= m_Strings.size())
+			{
+				m_Failed = true;
+				return;
+			}
+			m_Assets.Load(index, asset);
+		}
+
+		// Version of the chunk being read, for components whose layout changed
+		[[nodiscard]] uint32_t GetVersion() const { return m_Version; }
+		[[nodiscard]] bool Failed() const { return m_Failed; }
+		[[nodiscard]] bool IsAtEnd() const { return m_Offset == m_Size; }
+
+	private:
+		bool Reserve(uint64_t size)
+		{
+			if (m_Failed || m_Offset + size > m_Size)
+			{
+				m_Failed = true;
+				return false;
+			}
+			return true;
+		}
+
+	private:
+		const uint8_t* m_Data;
+		uint64_t m_Size;
+		uint64_t m_Offset = 0;
+		uint32_t m_Version;
+		bool m_Failed = false;
+		const std::vector<std::string_view>& m_Strings;
+		SceneFileAssets& m_Assets;
+	};
+
+	// How each component is stored.
+	// Direct components are copied as they are, their layout is part of the file format.
+	// They list their members in Fields, every member has to be in there or it is saved as zeros.
+	// Other components either have one Transfer that works on both the writer and the reader,
+	// or a Write and Read pair.
+	template<typename T>
+	struct ComponentCodec;
+
+	template<typename Codec, typename Component>
+	concept TransferCodec = requires(SceneFileWriter& writer, const Component& component)
+	{
+		Codec::Transfer(writer, component);
+	};
+
+	template<typename Codec, typename Component>
+	concept AfterReadCodec = requires(Component& component)
+	{
+		Codec::AfterRead(component);
+	};
+
+	template<>
+	struct ComponentCodec<TagComponent>
+	{
+		static constexpr SceneFileComponent Id = SceneFileComponent::Tag;
+		static constexpr uint32_t Version = 1;
+		static constexpr bool Direct = false;
+
+		template<typename Stream, typename Component>
+		static void Transfer(Stream& stream, Component& component)
+		{
+			stream.String(component.Tag);
+			stream.Value(component.Layer);
+			stream.Value(component.Enabled);
+		}
+
+		static void AfterRead(TagComponent& component)
+		{
+			if (component.Tag.empty())
+				component.Tag = "Entity";
+		}
+	};
+
+	template<>
+	struct ComponentCodec<TransformComponent>
+	{
+		static constexpr SceneFileComponent Id = SceneFileComponent::Transform;
+		static constexpr uint32_t Version = 1;
+		static constexpr bool Direct = true;
+		static constexpr auto Fields = std::make_tuple(&TransformComponent::Translation, &TransformComponent::Rotation, &TransformComponent::Scale);
+	};
+
+	template<>
+	struct ComponentCodec<RelationshipComponent>
+	{
+		static constexpr SceneFileComponent Id = SceneFileComponent::Relationship;
+		static constexpr uint32_t Version = 1;
+		static constexpr bool Direct = false;
+
+		static void Write(SceneFileWriter& writer, const RelationshipComponent& component)
+		{
+			writer.Value(component.Parent);
+			writer.Array(component.Children);
+		}
+
+		static void Read(SceneFileReader& reader, RelationshipComponent& component, Entity)
+		{
+			// UUIDs generate a random value when default constructed, read them as plain integers
+			std::vector<uint64_t> children;
+			reader.Value(component.Parent);
+			reader.Array(children);
+
+			component.Children.clear();
+			component.Children.reserve(children.size());
+			for (const uint64_t child : children)
+			{
+				if (child)
+					component.Children.emplace_back(child);
+			}
+		}
+	};
+
+	template<>
+	struct ComponentCodec<CameraComponent>
+	{
+		static constexpr SceneFileComponent Id = SceneFileComponent::Camera;
+		static constexpr uint32_t Version = 1;
+		static constexpr bool Direct = false;
+
+		static void Write(SceneFileWriter& writer, const CameraComponent& component)
+		{
+			const SceneCamera& camera = component.Camera;
+			writer.Value(camera.GetProjectionType());
+			writer.Value(camera.GetPerspectiveVerticalFOV());
+			writer.Value(camera.GetPerspectiveNearClip());
+			writer.Value(camera.GetPerspectiveFarClip());
+			writer.Value(camera.GetOrthographicSize());
+			writer.Value(camera.GetOrthographicNearClip());
+			writer.Value(camera.GetOrthographicFarClip());
+			writer.Value(component.Primary);
+			writer.Value(component.FixedAspectRatio);
+		}
+
+		static void Read(SceneFileReader& reader, CameraComponent& component, Entity)
+		{
+			SceneCamera::ProjectionType projectionType = SceneCamera::ProjectionType::Perspective;
+			float perspectiveFov = 0.0f, perspectiveNear = 0.0f, perspectiveFar = 0.0f;
+			float orthographicSize = 0.0f, orthographicNear = 0.0f, orthographicFar = 0.0f;
+			reader.Value(projectionType);
+			reader.Value(perspectiveFov);
+			reader.Value(perspectiveNear);
+			reader.Value(perspectiveFar);
+			reader.Value(orthographicSize);
+			reader.Value(orthographicNear);
+			reader.Value(orthographicFar);
+			reader.Value(component.Primary);
+			reader.Value(component.FixedAspectRatio);
+
+			SceneCamera& camera = component.Camera;
+			camera.SetViewportSize(1, 1);
+			camera.SetProjectionType(projectionType);
+			camera.SetPerspectiveVerticalFOV(perspectiveFov);
+			camera.SetPerspectiveNearClip(perspectiveNear);
+			camera.SetPerspectiveFarClip(perspectiveFar);
+			camera.SetOrthographicSize(orthographicSize);
+			camera.SetOrthographicNearClip(orthographicNear);
+			camera.SetOrthographicFarClip(orthographicFar);
+		}
+	};
+
+	template<>
+	struct ComponentCodec<SpriteRendererComponent>
+	{
+		static constexpr SceneFileComponent Id = SceneFileComponent::SpriteRenderer;
+		static constexpr uint32_t Version = 1;
+		static constexpr bool Direct = false;
+
+		template<typename Stream, typename Component>
+		static void Transfer(Stream& stream, Component& component)
+		{
+			stream.Value(component.Color);
+			stream.Value(component.SortingOrder);
+			stream.Value(component.TilingFactor);
+			stream.Asset(component.Texture);
+		}
+	};
+
+	template<>
+	struct ComponentCodec<SkyLightComponent>
+	{
+		static constexpr SceneFileComponent Id = SceneFileComponent::SkyLight;
+		static constexpr uint32_t Version = 1;
+		static constexpr bool Direct = false;
+
+		template<typename Stream, typename Component>
+		static void Transfer(Stream& stream, Component& component)
+		{
+			stream.Value(component.Intensity);
+			stream.Value(component.Rotation);
+			stream.Asset(component.Texture);
+		}
+	};
+
+	template<>
+	struct ComponentCodec<LightComponent>
+	{
+		static constexpr SceneFileComponent Id = SceneFileComponent::Light;
+		static constexpr uint32_t Version = 1;
+		static constexpr bool Direct = true;
+		static constexpr auto Fields = std::make_tuple(
+			&LightComponent::Type, &LightComponent::UseColorTemperatureMode, &LightComponent::Temperature,
+			&LightComponent::Color, &LightComponent::Intensity, &LightComponent::Range, &LightComponent::CutOffAngle,
+			&LightComponent::OuterCutOffAngle, &LightComponent::CastShadows, &LightComponent::ShadowQuality);
+
+		static void AfterRead(LightComponent& component)
+		{
+			if (component.UseColorTemperatureMode)
+				ColorUtils::TempratureToColor(component.Temperature, component.Color);
+		}
+	};
+
+	template<>
+	struct ComponentCodec<ParticleSystemComponent>
+	{
+		static constexpr SceneFileComponent Id = SceneFileComponent::ParticleSystem;
+		static constexpr uint32_t Version = 1;
+		static constexpr bool Direct = false;
+
+		template<typename Stream, typename Properties>
+		static void TransferProperties(Stream& stream, Properties& props)
+		{
+			stream.Value(props.Duration);
+			stream.Value(props.Looping);
+			stream.Value(props.StartDelay);
+			stream.Value(props.StartLifetime);
+			stream.Value(props.StartVelocity);
+			stream.Value(props.StartColor);
+			stream.Value(props.StartSize);
+			stream.Value(props.StartRotation);
+			stream.Value(props.GravityModifier);
+			stream.Value(props.SimulationSpeed);
+			stream.Value(props.PlayOnAwake);
+			stream.Value(props.MaxParticles);
+			stream.Value(props.RateOverTime);
+			stream.Value(props.RateOverDistance);
+			stream.Value(props.BurstCount);
+			stream.Value(props.BurstTime);
+			stream.Value(props.PositionStart);
+			stream.Value(props.PositionEnd);
+			stream.Value(props.VelocityOverLifetime);
+			stream.Value(props.ForceOverLifetime);
+			stream.Value(props.ColorOverLifetime);
+			stream.Value(props.ColorBySpeed);
+			stream.Value(props.SizeOverLifetime);
+			stream.Value(props.SizeBySpeed);
+			stream.Value(props.RotationOverLifetime);
+			stream.Value(props.RotationBySpeed);
+			stream.Asset(props.Texture);
+		}
+
+		static void Write(SceneFileWriter& writer, const ParticleSystemComponent& component)
+		{
+			TransferProperties(writer, component.System->GetProperties());
+		}
+
+		static void Read(SceneFileReader& reader, ParticleSystemComponent& component, Entity)
+		{
+			TransferProperties(reader, component.System->GetProperties());
+		}
+	};
+
+	template<>
+	struct ComponentCodec<Rigidbody2DComponent>
+	{
+		static constexpr SceneFileComponent Id = SceneFileComponent::Rigidbody2D;
+		static constexpr uint32_t Version = 1;
+		static constexpr bool Direct = false;
+
+		template<typename Stream, typename Component>
+		static void Transfer(Stream& stream, Component& component)
+		{
+			stream.Value(component.Type);
+			stream.Value(component.AutoMass);
+			stream.Value(component.Mass);
+			stream.Value(component.LinearDrag);
+			stream.Value(component.AngularDrag);
+			stream.Value(component.GravityScale);
+			stream.Value(component.AllowSleep);
+			stream.Value(component.Awake);
+			stream.Value(component.Continuous);
+			stream.Value(component.Interpolation);
+			stream.Value(component.FreezeRotation);
+		}
+	};
+
+	template<>
+	struct ComponentCodec<BoxCollider2DComponent>
+	{
+		static constexpr SceneFileComponent Id = SceneFileComponent::BoxCollider2D;
+		static constexpr uint32_t Version = 1;
+		static constexpr bool Direct = false;
+
+		template<typename Stream, typename Component>
+		static void Transfer(Stream& stream, Component& component)
+		{
+			stream.Value(component.IsSensor);
+			stream.Value(component.Size);
+			stream.Value(component.Offset);
+			stream.Value(component.Density);
+			stream.Value(component.Friction);
+			stream.Value(component.Restitution);
+		}
+	};
+
+	template<>
+	struct ComponentCodec<CircleCollider2DComponent>
+	{
+		static constexpr SceneFileComponent Id = SceneFileComponent::CircleCollider2D;
+		static constexpr uint32_t Version = 1;
+		static constexpr bool Direct = false;
+
+		template<typename Stream, typename Component>
+		static void Transfer(Stream& stream, Component& component)
+		{
+			stream.Value(component.IsSensor);
+			stream.Value(component.Radius);
+			stream.Value(component.Offset);
+			stream.Value(component.Density);
+			stream.Value(component.Friction);
+			stream.Value(component.Restitution);
+		}
+	};
+
+	template<>
+	struct ComponentCodec<PolygonCollider2DComponent>
+	{
+		static constexpr SceneFileComponent Id = SceneFileComponent::PolygonCollider2D;
+		static constexpr uint32_t Version = 1;
+		static constexpr bool Direct = false;
+
+		template<typename Stream, typename Component>
+		static void Transfer(Stream& stream, Component& component)
+		{
+			stream.Value(component.IsSensor);
+			stream.Value(component.Offset);
+			stream.Array(component.Points);
+			stream.Value(component.Density);
+			stream.Value(component.Friction);
+			stream.Value(component.Restitution);
+		}
+	};
+
+	template<>
+	struct ComponentCodec<DistanceJoint2DComponent>
+	{
+		static constexpr SceneFileComponent Id = SceneFileComponent::DistanceJoint2D;
+		static constexpr uint32_t Version = 1;
+		static constexpr bool Direct = false;
+
+		template<typename Stream, typename Component>
+		static void Transfer(Stream& stream, Component& component)
+		{
+			stream.Value(component.EnableCollision);
+			stream.Value(component.ConnectedRigidbody);
+			stream.Value(component.Anchor);
+			stream.Value(component.ConnectedAnchor);
+			stream.Value(component.AutoDistance);
+			stream.Value(component.Distance);
+			stream.Value(component.MinDistance);
+			stream.Value(component.MaxDistanceBy);
+			stream.Value(component.BreakForce);
+		}
+	};
+
+	template<>
+	struct ComponentCodec<SpringJoint2DComponent>
+	{
+		static constexpr SceneFileComponent Id = SceneFileComponent::SpringJoint2D;
+		static constexpr uint32_t Version = 1;
+		static constexpr bool Direct = false;
+
+		template<typename Stream, typename Component>
+		static void Transfer(Stream& stream, Component& component)
+		{
+			stream.Value(component.EnableCollision);
+			stream.Value(component.ConnectedRigidbody);
+			stream.Value(component.Anchor);
+			stream.Value(component.ConnectedAnchor);
+			stream.Value(component.AutoDistance);
+			stream.Value(component.Distance);
+			stream.Value(component.MinDistance);
+			stream.Value(component.MaxDistanceBy);
+			stream.Value(component.Frequency);
+			stream.Value(component.DampingRatio);
+			stream.Value(component.BreakForce);
+		}
+	};
+
+	template<>
+	struct ComponentCodec<HingeJoint2DComponent>
+	{
+		static constexpr SceneFileComponent Id = SceneFileComponent::HingeJoint2D;
+		static constexpr uint32_t Version = 1;
+		static constexpr bool Direct = false;
+
+		template<typename Stream, typename Component>
+		static void Transfer(Stream& stream, Component& component)
+		{
+			stream.Value(component.EnableCollision);
+			stream.Value(component.ConnectedRigidbody);
+			stream.Value(component.Anchor);
+			stream.Value(component.UseLimits);
+			stream.Value(component.LowerAngle);
+			stream.Value(component.UpperAngle);
+			stream.Value(component.UseMotor);
+			stream.Value(component.MotorSpeed);
+			stream.Value(component.MaxMotorTorque);
+			stream.Value(component.BreakForce);
+			stream.Value(component.BreakTorque);
+		}
+	};
+
+	template<>
+	struct ComponentCodec<SliderJoint2DComponent>
+	{
+		static constexpr SceneFileComponent Id = SceneFileComponent::SliderJoint2D;
+		static constexpr uint32_t Version = 1;
+		static constexpr bool Direct = false;
+
+		template<typename Stream, typename Component>
+		static void Transfer(Stream& stream, Component& component)
+		{
+			stream.Value(component.EnableCollision);
+			stream.Value(component.ConnectedRigidbody);
+			stream.Value(component.Anchor);
+			stream.Value(component.Angle);
+			stream.Value(component.UseLimits);
+			stream.Value(component.LowerTranslation);
+			stream.Value(component.UpperTranslation);
+			stream.Value(component.UseMotor);
+			stream.Value(component.MotorSpeed);
+			stream.Value(component.MaxMotorForce);
+			stream.Value(component.BreakForce);
+			stream.Value(component.BreakTorque);
+		}
+	};
+
+	template<>
+	struct ComponentCodec<WheelJoint2DComponent>
+	{
+		static constexpr SceneFileComponent Id = SceneFileComponent::WheelJoint2D;
+		static constexpr uint32_t Version = 1;
+		static constexpr bool Direct = false;
+
+		template<typename Stream, typename Component>
+		static void Transfer(Stream& stream, Component& component)
+		{
+			stream.Value(component.EnableCollision);
+			stream.Value(component.ConnectedRigidbody);
+			stream.Value(component.Anchor);
+			stream.Value(component.Frequency);
+			stream.Value(component.DampingRatio);
+			stream.Value(component.UseLimits);
+			stream.Value(component.LowerTranslation);
+			stream.Value(component.UpperTranslation);
+			stream.Value(component.UseMotor);
+			stream.Value(component.MotorSpeed);
+			stream.Value(component.MaxMotorTorque);
+			stream.Value(component.BreakForce);
+			stream.Value(component.BreakTorque);
+		}
+	};
+
+	template<>
+	struct ComponentCodec<BuoyancyEffector2DComponent>
+	{
+		static constexpr SceneFileComponent Id = SceneFileComponent::BuoyancyEffector2D;
+		static constexpr uint32_t Version = 1;
+		static constexpr bool Direct = true;
+		static constexpr auto Fields = std::make_tuple(
+			&BuoyancyEffector2DComponent::Density, &BuoyancyEffector2DComponent::DragMultiplier,
+			&BuoyancyEffector2DComponent::FlipGravity, &BuoyancyEffector2DComponent::FlowMagnitude,
+			&BuoyancyEffector2DComponent::FlowAngle);
+	};
+
+	template<>
+	struct ComponentCodec<RigidbodyComponent>
+	{
+		static constexpr SceneFileComponent Id = SceneFileComponent::Rigidbody;
+		static constexpr uint32_t Version = 1;
+		static constexpr bool Direct = false;
+
+		template<typename Stream, typename Component>
+		static void Transfer(Stream& stream, Component& component)
+		{
+			stream.Value(component.Type);
+			stream.Value(component.AutoMass);
+			stream.Value(component.Mass);
+			stream.Value(component.LinearDrag);
+			stream.Value(component.AngularDrag);
+			stream.Value(component.GravityScale);
+			stream.Value(component.AllowSleep);
+			stream.Value(component.Awake);
+			stream.Value(component.Continuous);
+			stream.Value(component.Interpolation);
+			stream.Value(component.IsSensor);
+		}
+	};
+
+	template<>
+	struct ComponentCodec<BoxColliderComponent>
+	{
+		static constexpr SceneFileComponent Id = SceneFileComponent::BoxCollider;
+		static constexpr uint32_t Version = 1;
+		static constexpr bool Direct = true;
+		static constexpr auto Fields = std::make_tuple(
+			&BoxColliderComponent::Size, &BoxColliderComponent::Offset, &BoxColliderComponent::Density,
+			&BoxColliderComponent::Friction, &BoxColliderComponent::Restitution);
+	};
+
+	template<>
+	struct ComponentCodec<SphereColliderComponent>
+	{
+		static constexpr SceneFileComponent Id = SceneFileComponent::SphereCollider;
+		static constexpr uint32_t Version = 1;
+		static constexpr bool Direct = true;
+		static constexpr auto Fields = std::make_tuple(
+			&SphereColliderComponent::Radius, &SphereColliderComponent::Offset, &SphereColliderComponent::Density,
+			&SphereColliderComponent::Friction, &SphereColliderComponent::Restitution);
+	};
+
+	template<>
+	struct ComponentCodec<CapsuleColliderComponent>
+	{
+		static constexpr SceneFileComponent Id = SceneFileComponent::CapsuleCollider;
+		static constexpr uint32_t Version = 1;
+		static constexpr bool Direct = true;
+		static constexpr auto Fields = std::make_tuple(
+			&CapsuleColliderComponent::Height, &CapsuleColliderComponent::Radius, &CapsuleColliderComponent::Offset,
+			&CapsuleColliderComponent::Density, &CapsuleColliderComponent::Friction, &CapsuleColliderComponent::Restitution);
+	};
+
+	template<>
+	struct ComponentCodec<TaperedCapsuleColliderComponent>
+	{
+		static constexpr SceneFileComponent Id = SceneFileComponent::TaperedCapsuleCollider;
+		static constexpr uint32_t Version = 1;
+		static constexpr bool Direct = true;
+		static constexpr auto Fields = std::make_tuple(
+			&TaperedCapsuleColliderComponent::Height, &TaperedCapsuleColliderComponent::TopRadius,
+			&TaperedCapsuleColliderComponent::BottomRadius, &TaperedCapsuleColliderComponent::Offset,
+			&TaperedCapsuleColliderComponent::Density, &TaperedCapsuleColliderComponent::Friction,
+			&TaperedCapsuleColliderComponent::Restitution);
+	};
+
+	template<>
+	struct ComponentCodec<CylinderColliderComponent>
+	{
+		static constexpr SceneFileComponent Id = SceneFileComponent::CylinderCollider;
+		static constexpr uint32_t Version = 1;
+		static constexpr bool Direct = true;
+		static constexpr auto Fields = std::make_tuple(
+			&CylinderColliderComponent::Height, &CylinderColliderComponent::Radius, &CylinderColliderComponent::Offset,
+			&CylinderColliderComponent::Density, &CylinderColliderComponent::Friction, &CylinderColliderComponent::Restitution);
+	};
+
+	template<>
+	struct ComponentCodec<MeshComponent>
+	{
+		static constexpr SceneFileComponent Id = SceneFileComponent::Mesh;
+		static constexpr uint32_t Version = 1;
+		static constexpr bool Direct = false;
+
+		template<typename Stream, typename Component>
+		static void Transfer(Stream& stream, Component& component)
+		{
+			stream.Value(component.SubmeshIndex);
+			stream.Value(component.CullMode);
+			stream.Asset(component.MeshGeometry);
+		}
+	};
+
+	template<>
+	struct ComponentCodec<ScriptComponent>
+	{
+		static constexpr SceneFileComponent Id = SceneFileComponent::Script;
+		static constexpr uint32_t Version = 1;
+		static constexpr bool Direct = false;
+
+		struct FieldValue
+		{
+			char Data[ScriptFieldInstance::MaxSize];
+		};
+
+		static void Write(SceneFileWriter& writer, const ScriptComponent& component, Entity entity)
+		{
+			writer.Value(static_cast<uint32_t>(component.Classes.size()));
+			for (const std::string& className : component.Classes)
+			{
+				writer.String(className);
+
+				const auto& fields = ScriptEngine::GetFieldMap(className.c_str());
+				const auto& fieldInstances = ScriptEngine::GetFieldInstanceMap(entity, className.c_str());
+				uint32_t fieldCount = 0;
+				for (const auto& [fieldName, fieldInstance] : fieldInstances)
+				{
+					const auto& field = fields.at(fieldName);
+					if (field.Type != FieldType::Unknown && field.Serializable)
+						++fieldCount;
+				}
+
+				writer.Value(fieldCount);
+				for (const auto& [fieldName, fieldInstance] : fieldInstances)
+				{
+					const auto& field = fields.at(fieldName);
+					if (field.Type == FieldType::Unknown || !field.Serializable)
+						continue;
+
+					FieldValue value;
+					memcpy(value.Data, fieldInstance.GetBuffer(), sizeof(value.Data));
+					writer.String(fieldName);
+					writer.Value(field.Type);
+					writer.Value(value);
+				}
+			}
+		}
+
+		static void Read(SceneFileReader& reader, ScriptComponent& component, Entity entity)
+		{
+			uint32_t scriptCount = 0;
+			reader.Value(scriptCount);
+
+			component.Classes.clear();
+			for (uint32_t i = 0; i < scriptCount && !reader.Failed(); ++i)
+			{
+				const std::string className(reader.String());
+				uint32_t fieldCount = 0;
+				reader.Value(fieldCount);
+
+				const bool hasClass = ScriptEngine::HasClass(className);
+				if (!hasClass)
+					ARC_CORE_ERROR("Class not found with name: {}", className);
+				else
+					component.Classes.emplace_back(className);
+
+				for (uint32_t j = 0; j < fieldCount && !reader.Failed(); ++j)
+				{
+					const std::string_view fieldName = reader.String();
+					FieldType type = FieldType::Unknown;
+					FieldValue value;
+					reader.Value(type);
+					reader.Value(value);
+					if (!hasClass)
+						continue;
+
+					// Fields that were removed or changed their type since the scene was saved keep their default
+					const auto& fields = ScriptEngine::GetFieldMap(className.c_str());
+					const auto it = fields.find(fieldName);
+					if (it == fields.end() || it->second.Type != type || !it->second.Serializable)
+						continue;
+
+					auto& fieldInstance = ScriptEngine::GetFieldInstanceMap(entity, className.c_str())[std::string(fieldName)];
+					fieldInstance.Type = type;
+					fieldInstance.SetValue(value);
+				}
+			}
+		}
+	};
+
+	template<>
+	struct ComponentCodec<AudioSourceComponent>
+	{
+		static constexpr SceneFileComponent Id = SceneFileComponent::AudioSource;
+		static constexpr uint32_t Version = 1;
+		static constexpr bool Direct = false;
+
+		template<typename Stream, typename Component>
+		static void Transfer(Stream& stream, Component& component)
+		{
+			stream.Value(component.Config);
+			stream.Asset(component.Source);
+		}
+	};
+
+	template<>
+	struct ComponentCodec<AudioListenerComponent>
+	{
+		static constexpr SceneFileComponent Id = SceneFileComponent::AudioListener;
+		static constexpr uint32_t Version = 1;
+		static constexpr bool Direct = false;
+
+		template<typename Stream, typename Component>
+		static void Transfer(Stream& stream, Component& component)
+		{
+			stream.Value(component.Active);
+			stream.Value(component.Config);
+		}
+	};
+
+	// Every entity gets these, entities without them in the file get the defaults
+	using CoreSceneFileComponents = ComponentGroup<TagComponent, TransformComponent, RelationshipComponent>;
+
+	// In the order they are added when loading, which is the order of the YAML format
+	using SceneFileComponents = ComponentGroup<
+		CameraComponent,
+		SpriteRendererComponent,
+		SkyLightComponent,
+		LightComponent,
+		ParticleSystemComponent,
+		Rigidbody2DComponent,
+		BoxCollider2DComponent,
+		CircleCollider2DComponent,
+		PolygonCollider2DComponent,
+		DistanceJoint2DComponent,
+		SpringJoint2DComponent,
+		HingeJoint2DComponent,
+		SliderJoint2DComponent,
+		WheelJoint2DComponent,
+		BuoyancyEffector2DComponent,
+		RigidbodyComponent,
+		BoxColliderComponent,
+		SphereColliderComponent,
+		CapsuleColliderComponent,
+		TaperedCapsuleColliderComponent,
+		CylinderColliderComponent,
+		MeshComponent,
+		ScriptComponent,
+		AudioSourceComponent,
+		AudioListenerComponent>;
+
+	struct SceneFileChunkData
+	{
+		SceneFileChunk Entry{};
+		std::vector<uint32_t> Entities;
+		std::vector<uint8_t> Data;
+	};
+
+	struct SceneFileWriteContext
+	{
+		const Scene& SourceScene;
+		const entt::registry& Registry;
+		std::span<const entt::entity> Entities;
+		SceneFileStrings Strings;
+		std::vector<SceneFileChunkData> Chunks;
+	};
+
+	template<typename Component>
+	static void WriteChunk(SceneFileWriteContext& context)
+	{
+		ARC_PROFILE_SCOPE()
+
+		using Codec = ComponentCodec<Component>;
+
+		SceneFileChunkData chunk;
+		SceneFileWriter writer(chunk.Data, context.Strings);
+		for (uint32_t i = 0; i < static_cast<uint32_t>(context.Entities.size()); ++i)
+		{
+			const entt::entity handle = context.Entities[i];
+			const Component* component = context.Registry.try_get<Component>(handle);
+			if (!component)
+				continue;
+
+			chunk.Entities.push_back(i);
+			if constexpr (Codec::Direct)
+				std::apply([&writer, component](auto... members) { writer.Fields(*component, members...); }, Codec::Fields);
+			else if constexpr (TransferCodec<Codec, Component>)
+				Codec::Transfer(writer, *component);
+			else if constexpr (std::is_same_v<Component, ScriptComponent>)
+				Codec::Write(writer, *component, Entity(handle, const_cast<Scene*>(&context.SourceScene)));
+			else
+				Codec::Write(writer, *component);
+		}
+
+		if (chunk.Entities.empty())
+			return;
+
+		chunk.Entry.Component = static_cast<uint32_t>(Codec::Id);
+		chunk.Entry.Version = Codec::Version;
+		chunk.Entry.Count = static_cast<uint32_t>(chunk.Entities.size());
+		chunk.Entry.Stride = Codec::Direct ? static_cast<uint32_t>(sizeof(Component)) : 0;
+		chunk.Entry.DataSize = chunk.Data.size();
+		context.Chunks.push_back(std::move(chunk));
+	}
+
+	template<typename... Component>
+	static void WriteChunks(ComponentGroup<Component...>, SceneFileWriteContext& context)
+	{
+		(WriteChunk<Component>(context), ...);
+	}
+
+	struct BinarySceneSerializer::ReadContext
+	{
+		Scene& TargetScene;
+		entt::registry& Registry;
+		const uint8_t* FileData;
+		std::span<const entt::entity> Entities;
+		std::array<const SceneFileChunk*, static_cast<size_t>(SceneFileComponent::Count)> Chunks{};
+		const std::vector<std::string_view>& Strings;
+		SceneFileAssets& Assets;
+		std::vector<entt::entity> Handles;
+	};
+
+	template<typename Component>
+	bool BinarySceneSerializer::ReadChunk(ReadContext& context)
+	{
+		ARC_PROFILE_SCOPE()
+
+		using Codec = ComponentCodec<Component>;
+
+		const SceneFileChunk* chunk = context.Chunks[static_cast<size_t>(Codec::Id)];
+		if (!chunk)
+			return true;
+
+		if (chunk->Version > Codec::Version || (Codec::Direct && chunk->Stride != sizeof(Component)))
+		{
+			ARC_CORE_WARN("Skipping component {} of scene file, it was saved by a newer version", chunk->Component);
+			return true;
+		}
+
+		const auto* indices = reinterpret_cast<const uint32_t*>(context.FileData + chunk->EntityOffset);
+		context.Handles.resize(chunk->Count);
+		for (uint32_t i = 0; i < chunk->Count; ++i)
+		{
+			const uint32_t index = indices[i];
+			if (index >= context.Entities.size() || context.Registry.all_of<Component>(context.Entities[index]))
+				return false;
+			context.Handles[i] = context.Entities[index];
+		}
+
+		if constexpr (Codec::Direct)
+		{
+			// Stored exactly as they are laid out in memory, so they are copied straight from the file
+			const auto* components = reinterpret_cast<const Component*>(context.FileData + chunk->DataOffset);
+			context.Registry.insert<Component>(context.Handles.begin(), context.Handles.end(), components);
+			for (const entt::entity handle : context.Handles)
+			{
+				Component& component = context.Registry.get<Component>(handle);
+				if constexpr (AfterReadCodec<Codec, Component>)
+					Codec::AfterRead(component);
+				context.TargetScene.OnComponentAdded<Component>({ handle, &context.TargetScene }, component);
+			}
+		}
+		else
+		{
+			SceneFileReader reader(context.FileData + chunk->DataOffset, chunk->DataSize, chunk->Version, context.Strings, context.Assets);
+			for (const entt::entity handle : context.Handles)
+			{
+				// Same order as adding a component from the YAML format: the component is added with its
+				// defaults, then the stored values are read into it
+				const Entity entity = { handle, &context.TargetScene };
+				Component& component = context.Registry.emplace<Component>(handle);
+				context.TargetScene.OnComponentAdded<Component>(entity, component);
+
+				if constexpr (TransferCodec<Codec, Component>)
+					Codec::Transfer(reader, component);
+				else
+					Codec::Read(reader, component, entity);
+
+				if constexpr (AfterReadCodec<Codec, Component>)
+					Codec::AfterRead(component);
+
+				if (reader.Failed())
+					return false;
+			}
+
+			if (!reader.IsAtEnd())
+				return false;
+		}
+
+		return true;
+	}
+
+	template<typename... Component>
+	bool BinarySceneSerializer::ReadChunks(ComponentGroup<Component...>, ReadContext& context)
+	{
+		return (ReadChunk<Component>(context) && ...);
+	}
+
+	bool BinarySceneSerializer::Serialize(const Scene& scene, const std::filesystem::path& filepath)
+	{
+		ARC_PROFILE_SCOPE()
+
+		std::vector<uint8_t> data;
+		Serialize(scene, data);
+		return Filesystem::WriteFileBinary(filepath, data.data(), data.size());
+	}
+
+	void BinarySceneSerializer::Serialize(const Scene& scene, std::vector<uint8_t>& outData)
+	{
+		ARC_PROFILE_SCOPE()
+
+		const entt::registry& registry = scene.m_Registry;
+
+		// Same order as the YAML format
+		std::vector<entt::entity> entities;
+		const auto view = registry.view<IDComponent>();
+		entities.reserve(view.size());
+		for (auto it = view.rbegin(); it != view.rend(); ++it)
+			entities.push_back(*it);
+
+		std::vector<uint64_t> entityTable;
+		entityTable.reserve(entities.size());
+		for (const entt::entity entity : entities)
+			entityTable.push_back(registry.get<IDComponent>(entity).ID);
+
+		SceneFileWriteContext context = { scene, registry, entities, {}, {} };
+		WriteChunks(CoreSceneFileComponents{}, context);
+		WriteChunks(SceneFileComponents{}, context);
+
+		std::vector<SceneFileChunk> chunkTable;
+		chunkTable.reserve(context.Chunks.size());
+
+		SceneFileHeader header{};
+		memcpy(header.Magic, s_SceneFileMagic, sizeof(header.Magic));
+		header.Version = s_SceneFileVersion;
+		header.EntityCount = static_cast<uint32_t>(entityTable.size());
+		header.ChunkCount = static_cast<uint32_t>(context.Chunks.size());
+		header.StringCount = static_cast<uint32_t>(context.Strings.GetTable().size());
+		header.EntityTableOffset = AlignOffset(sizeof(SceneFileHeader));
+		header.ChunkTableOffset = AlignOffset(header.EntityTableOffset + entityTable.size() * sizeof(uint64_t));
+
+		uint64_t offset = AlignOffset(header.ChunkTableOffset + context.Chunks.size() * sizeof(SceneFileChunk));
+		for (SceneFileChunkData& chunk : context.Chunks)
+		{
+			chunk.Entry.EntityOffset = offset;
+			chunk.Entry.DataOffset = AlignOffset(offset + chunk.Entities.size() * sizeof(uint32_t));
+			offset = AlignOffset(chunk.Entry.DataOffset + chunk.Data.size());
+			chunkTable.push_back(chunk.Entry);
+		}
+
+		header.StringTableOffset = offset;
+		header.StringDataOffset = AlignOffset(header.StringTableOffset + context.Strings.GetTable().size() * sizeof(SceneFileString));
+		header.StringDataSize = context.Strings.GetData().size();
+
+		std::vector<uint8_t>& file = outData;
+		file.assign(header.StringDataOffset + header.StringDataSize, 0);
+		memcpy(file.data(), &header, sizeof(SceneFileHeader));
+		if (!entityTable.empty())
+			memcpy(file.data() + header.EntityTableOffset, entityTable.data(), entityTable.size() * sizeof(uint64_t));
+		if (!chunkTable.empty())
+			memcpy(file.data() + header.ChunkTableOffset, chunkTable.data(), chunkTable.size() * sizeof(SceneFileChunk));
+		for (const SceneFileChunkData& chunk : context.Chunks)
+		{
+			memcpy(file.data() + chunk.Entry.EntityOffset, chunk.Entities.data(), chunk.Entities.size() * sizeof(uint32_t));
+			if (!chunk.Data.empty())
+				memcpy(file.data() + chunk.Entry.DataOffset, chunk.Data.data(), chunk.Data.size());
+		}
+		if (!context.Strings.GetTable().empty())
+			memcpy(file.data() + header.StringTableOffset, context.Strings.GetTable().data(), context.Strings.GetTable().size() * sizeof(SceneFileString));
+		if (!context.Strings.GetData().empty())
+			memcpy(file.data() + header.StringDataOffset, context.Strings.GetData().data(), context.Strings.GetData().size());
+	}
+
+	bool BinarySceneSerializer::Deserialize(Scene& scene, const std::filesystem::path& filepath)
+	{
+		ARC_PROFILE_SCOPE()
+
+		const MappedFile file(filepath);
+		if (!file)
+			return false;
+
+		if (!Deserialize(scene, { file.GetData(), file.GetSize() }))
+		{
+			ARC_CORE_ERROR("Failed to load scene file: {}", filepath);
+			return false;
+		}
+		return true;
+	}
+
+	bool BinarySceneSerializer::Deserialize(Scene& scene, std::span<const uint8_t> data)
+	{
+		ARC_PROFILE_SCOPE()
+
+		if (data.size() < sizeof(SceneFileHeader))
+			return false;
+
+		SceneFileHeader header;
+		memcpy(&header, data.data(), sizeof(SceneFileHeader));
+		if (memcmp(header.Magic, s_SceneFileMagic, sizeof(header.Magic)) != 0 || header.Version > s_SceneFileVersion)
+		{
+			ARC_CORE_WARN("Unsupported scene data, version {}", header.Version);
+			return false;
+		}
+
+		const uint8_t* fileData = data.data();
+		const uint64_t size = data.size();
+		if (header.EntityTableOffset + header.EntityCount * sizeof(uint64_t) > size
+			|| header.ChunkTableOffset + header.ChunkCount * sizeof(SceneFileChunk) > size
+			|| header.StringTableOffset + header.StringCount * sizeof(SceneFileString) > size
+			|| header.StringDataOffset + header.StringDataSize > size)
+		{
+			ARC_CORE_WARN("Scene data is truncated");
+			return false;
+		}
+
+		const std::string_view stringData(reinterpret_cast<const char*>(fileData + header.StringDataOffset), header.StringDataSize);
+		const auto* stringTable = reinterpret_cast<const SceneFileString*>(fileData + header.StringTableOffset);
+		std::vector<std::string_view> strings;
+		strings.reserve(header.StringCount);
+		for (uint32_t i = 0; i < header.StringCount; ++i)
+		{
+			const SceneFileString& str = stringTable[i];
+			if (static_cast<uint64_t>(str.Offset) + str.Length > header.StringDataSize)
+			{
+				ARC_CORE_WARN("Scene data is corrupt");
+				return false;
+			}
+			strings.push_back(stringData.substr(str.Offset, str.Length));
+		}
+
+		SceneFileAssets assets(strings);
+		entt::registry& registry = scene.m_Registry;
+		std::vector<entt::entity> entities(header.EntityCount, entt::entity(entt::null));
+		ReadContext context = { scene, registry, fileData, entities, {}, strings, assets, {} };
+
+		const auto* chunkTable = reinterpret_cast<const SceneFileChunk*>(fileData + header.ChunkTableOffset);
+		for (uint32_t i = 0; i < header.ChunkCount; ++i)
+		{
+			const SceneFileChunk& chunk = chunkTable[i];
+			if (chunk.EntityOffset + chunk.Count * sizeof(uint32_t) > size || chunk.DataOffset + chunk.DataSize > size
+				|| (chunk.Stride != 0 && static_cast<uint64_t>(chunk.Count) * chunk.Stride > chunk.DataSize))
+			{
+				ARC_CORE_WARN("Scene data is truncated");
+				return false;
+			}
+
+			// Components this version does not know about are left out
+			if (chunk.Component > 0 && chunk.Component < static_cast<uint32_t>(SceneFileComponent::Count))
+				context.Chunks[chunk.Component] = &chunk;
+		}
+
+		registry.create(entities.begin(), entities.end());
+		const auto* uuids = reinterpret_cast<const uint64_t*>(fileData + header.EntityTableOffset);
+		scene.m_EntityMap.reserve(scene.m_EntityMap.size() + entities.size());
+		for (uint32_t i = 0; i < header.EntityCount; ++i)
+		{
+			registry.emplace<IDComponent>(entities[i], uuids[i]);
+			scene.m_EntityMap.emplace(uuids[i], entities[i]);
+		}
+		scene.m_TransformCache.InvalidateHierarchy();
+
+		bool success = ReadChunks(CoreSceneFileComponents{}, context);
+		if (success)
+		{
+			for (const entt::entity entity : entities)
+			{
+				if (!registry.all_of<TagComponent>(entity))
+					registry.emplace<TagComponent>(entity, "Entity");
+				if (!registry.all_of<TransformComponent>(entity))
+					registry.emplace<TransformComponent>(entity);
+				if (!registry.all_of<RelationshipComponent>(entity))
+					registry.emplace<RelationshipComponent>(entity);
+			}
+
+			success = ReadChunks(SceneFileComponents{}, context);
+		}
+
+		if (!success)
+			ARC_CORE_WARN("Scene data is corrupt, the scene was only partly loaded");
+		return success;
+	}
+
+	bool BinarySceneSerializer::IsBinaryScene(const std::filesystem::path& filepath)
+	{
+		std::ifstream stream(filepath, std::ios::binary);
+		char magic[sizeof(s_SceneFileMagic)] = {};
+		return stream.read(magic, sizeof(magic)) && memcmp(magic, s_SceneFileMagic, sizeof(magic)) == 0;
+	}
+}
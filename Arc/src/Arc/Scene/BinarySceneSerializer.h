@@ -0,0 +1,33 @@
+#pragma once
+
+#include <span>
+
+namespace ArcEngine
+{
+	class Scene;
+
+	template<typename... Component>
+	struct ComponentGroup;
+
+	// Binary counterpart of the YAML scene format, holds the same data.
+	// Components are stored in one chunk per type, plain data components are read straight from the mapped file.
+	class BinarySceneSerializer
+	{
+	public:
+		static bool Serialize(const Scene& scene, const std::filesystem::path& filepath);
+		static void Serialize(const Scene& scene, std::vector<uint8_t>& outData);
+		[[nodiscard]] static bool Deserialize(Scene& scene, const std::filesystem::path& filepath);
+		[[nodiscard]] static bool Deserialize(Scene& scene, std::span<const uint8_t> data);
+
+		// Checks the magic at the start of the file
+		[[nodiscard]] static bool IsBinaryScene(const std::filesystem::path& filepath);
+
+	private:
+		struct ReadContext;
+
+		template<typename Component>
+		[[nodiscard]] static bool ReadChunk(ReadContext& context);
+		template<typename... Component>
+		[[nodiscard]] static bool ReadChunks(ComponentGroup<Component...>, ReadContext& context);
+	};
+}
@@ -111,15 +111,8 @@ namespace ArcEngine
 		float CutOffAngle = glm::radians(12.5f);
 		float OuterCutOffAngle = glm::radians(17.5f);
 		
+		bool CastShadows = true;
 		ShadowQualityType ShadowQuality = ShadowQualityType::UltraSoft;
-
-		Ref<Framebuffer> ShadowMapFramebuffer;
-
-		LightComponent()
-		{
-			const FramebufferSpecification spec{ 2048, 2048, { FramebufferTextureFormat::Depth } };
-			ShadowMapFramebuffer = Framebuffer::Create(spec);
-		}
 	};
 
 	struct ParticleSystemComponent
@@ -44,6 +44,16 @@ namespace ArcEngine
 			return m_Scene->m_Registry.all_of<T>(m_EntityHandle);
 		}
 
+		// Returns nullptr if the entity does not have the component
+		template<typename T>
+		[[nodiscard]] T* TryGetComponent() const
+		{
+			ARC_PROFILE_SCOPE()
+
+			ARC_CORE_ASSERT(m_Scene, "Scene is null!")
+			return m_Scene->m_Registry.try_get<T>(m_EntityHandle);
+		}
+
 		template<typename T>
 		void RemoveComponent() const
 		{
@@ -53,6 +63,16 @@ namespace ArcEngine
 			m_Scene->m_Registry.remove<T>(m_EntityHandle);
 		}
 
+		// Tells the scene caches that a component was edited in place
+		template<typename T>
+		void PatchComponent() const
+		{
+			ARC_PROFILE_SCOPE()
+
+			ARC_CORE_ASSERT(HasComponent<T>(), "Entity does not have component!")
+			m_Scene->m_Registry.patch<T>(m_EntityHandle);
+		}
+
 		[[nodiscard]] UUID GetUUID() const { return GetComponent<IDComponent>().ID; }
 		[[nodiscard]] std::string_view GetTag() const { return GetComponent<TagComponent>().Tag; }
 		[[nodiscard]] TransformComponent& GetTransform() const { return GetComponent<TransformComponent>(); }
@@ -79,6 +99,7 @@ namespace ArcEngine
 			auto& rc = GetComponent<RelationshipComponent>();
 			rc.Parent = parent.GetUUID();
 			parent.GetRelationship().Children.emplace_back(GetUUID());
+			m_Scene->m_TransformCache.InvalidateHierarchy();
 		}
 
 		void Deparent() const
@@ -102,17 +123,15 @@ namespace ArcEngine
 				}
 			}
 			transform.Parent = 0;
+			m_Scene->m_TransformCache.InvalidateHierarchy();
 		}
 		
 		[[nodiscard]] glm::mat4 GetWorldTransform() const
 		{
 			ARC_PROFILE_SCOPE()
 
-			const auto& transform = GetTransform();
-			const auto& rc = GetRelationship();
-			const Entity parent = m_Scene->GetEntity(rc.Parent);
-			const glm::mat4 parentTransform = parent ? parent.GetWorldTransform() : glm::mat4(1.0f);
-			return parentTransform * glm::translate(glm::mat4(1.0f), transform.Translation) * glm::toMat4(glm::quat(transform.Rotation)) * glm::scale(glm::mat4(1.0f), transform.Scale);
+			ARC_CORE_ASSERT(m_Scene, "Scene is null!")
+			return m_Scene->m_TransformCache.GetWorldTransform(m_EntityHandle);
 		}
 
 		[[nodiscard]] glm::mat4 GetLocalTransform() const
@@ -153,6 +153,18 @@ namespace ArcEngine
 		return value;
 	}
 
+	static std::string GetAssetPath(const std::string& path, const SceneAssetPathMap* assetPaths)
+	{
+		if (assetPaths)
+		{
+			const auto it = assetPaths->find(path);
+			if (it != assetPaths->end())
+				return it->second;
+		}
+
+		return EntitySerializer::ResolveAssetPath(path);
+	}
+
 #define READ_FIELD_TYPE(Type, NativeType)										\
 			case Type:															\
 				out << fieldInstance.GetValue<NativeType>();					\
@@ -295,6 +307,7 @@ namespace ArcEngine
 			out << YAML::Key << "Range" << YAML::Value << lightComponent.Range;
 			out << YAML::Key << "CutOffAngle" << YAML::Value << lightComponent.CutOffAngle;
 			out << YAML::Key << "OuterCutOffAngle" << YAML::Value << lightComponent.OuterCutOffAngle;
+			out << YAML::Key << "CastShadows" << YAML::Value << lightComponent.CastShadows;
 			out << YAML::Key << "ShadowQuality" << YAML::Value << static_cast<int>(lightComponent.ShadowQuality);
 
 			out << YAML::EndMap;
@@ -655,7 +668,7 @@ namespace ArcEngine
 			out << YAML::Key << "CylinderColliderComponent";
 			out << YAML::BeginMap;
 
-			const auto& cc = entity.GetComponent<CapsuleColliderComponent>();
+			const auto& cc = entity.GetComponent<CylinderColliderComponent>();
 			out << YAML::Key << "Height" << YAML::Value << cc.Height;
 			out << YAML::Key << "Radius" << YAML::Value << cc.Radius;
 			out << YAML::Key << "Offset" << YAML::Value << cc.Offset;
@@ -793,7 +806,7 @@ namespace ArcEngine
 		out << YAML::EndMap;
 	}
 
-	UUID EntitySerializer::DeserializeEntity(const YAML::Node& node, Scene& scene, bool preserveUUID)
+	UUID EntitySerializer::DeserializeEntity(const YAML::Node& node, Scene& scene, bool preserveUUID, const SceneAssetPathMap* assetPaths)
 	{
 		YAML::Node entity = node;
 
@@ -816,11 +829,6 @@ namespace ArcEngine
 		else
 			deserializedEntity = scene.CreateEntity(name);
 
-		if (preserveUUID)
-			ARC_CORE_TRACE("Deserialized entity with ID = {0}, name = {1}", uuid, name);
-		else
-			ARC_CORE_TRACE("Deserialized entity with oldID = {0}, newID = {1}, name = {2}", uuid, deserializedEntity.GetUUID(), name);
-
 		if (tagComponent)
 		{
 			auto& tc = deserializedEntity.GetComponent<TagComponent>();
@@ -902,10 +910,7 @@ namespace ArcEngine
 
 			if (!texturePath.empty())
 			{
-				std::filesystem::path path = Project::GetAssetFileSystemPath(texturePath);
-				if (!std::filesystem::exists(path))
-					path = texturePath;
-				src.Texture = AssetManager::GetTexture2D(path.string());
+				src.Texture = AssetManager::GetTexture2D(GetAssetPath(texturePath, assetPaths));
 			}
 		}
 
@@ -919,10 +924,7 @@ namespace ArcEngine
 			TrySet(texturePath, skyLight["TexturePath"]);
 			if (!texturePath.empty())
 			{
-				std::filesystem::path path = Project::GetAssetFileSystemPath(texturePath);
-				if (!std::filesystem::exists(path))
-					path = texturePath;
-				src.Texture = AssetManager::GetTextureCubemap(path.string());
+				src.Texture = AssetManager::GetTextureCubemap(GetAssetPath(texturePath, assetPaths));
 			}
 		}
 
@@ -937,6 +939,7 @@ namespace ArcEngine
 			TrySet(src.Range, lightComponent["Range"]);
 			TrySet(src.CutOffAngle, lightComponent["CutOffAngle"]);
 			TrySet(src.OuterCutOffAngle, lightComponent["OuterCutOffAngle"]);
+			TrySet(src.CastShadows, lightComponent["CastShadows"]);
 			TrySetEnum(src.ShadowQuality, lightComponent["ShadowQuality"]);
 
 			if (src.UseColorTemperatureMode)
@@ -1007,10 +1010,7 @@ namespace ArcEngine
 			TrySet(texturePath, psComponent["TexturePath"]);
 			if (!texturePath.empty())
 			{
-				std::filesystem::path path = Project::GetAssetFileSystemPath(texturePath);
-				if (!std::filesystem::exists(path))
-					path = texturePath;
-				props.Texture = AssetManager::GetTexture2D(path.string());
+				props.Texture = AssetManager::GetTexture2D(GetAssetPath(texturePath, assetPaths));
 			}
 		}
 
@@ -1223,9 +1223,9 @@ namespace ArcEngine
 			TrySet(src.Restitution, tccComponent["Restitution"]);
 		}
 
-		if (const auto& ccComponent = entity["CapsuleColliderComponent"])
+		if (const auto& ccComponent = entity["CylinderColliderComponent"])
 		{
-			auto& src = deserializedEntity.AddComponent<CapsuleColliderComponent>();
+			auto& src = deserializedEntity.AddComponent<CylinderColliderComponent>();
 			TrySet(src.Height, ccComponent["Height"]);
 			TrySet(src.Radius, ccComponent["Radius"]);
 			TrySet(src.Offset, ccComponent["Offset"]);
@@ -1244,10 +1244,7 @@ namespace ArcEngine
 
 			if (!filepath.empty())
 			{
-				std::filesystem::path path = Project::GetAssetFileSystemPath(filepath);
-				if (!std::filesystem::exists(path))
-					path = filepath;
-				src.MeshGeometry = AssetManager::GetMesh(path.string());
+				src.MeshGeometry = AssetManager::GetMesh(GetAssetPath(filepath, assetPaths));
 			}
 		}
 
@@ -1344,10 +1341,7 @@ namespace ArcEngine
 
 			if (!filepath.empty())
 			{
-				std::filesystem::path path = Project::GetAssetFileSystemPath(filepath);
-				if (!std::filesystem::exists(path))
-					path = filepath;
-				src.Source = CreateRef<AudioSource>(path.string().c_str());
+				src.Source = AssetManager::LoadAudioSource(GetAssetPath(filepath, assetPaths));
 			}
 		}
 
@@ -1463,4 +1457,36 @@ namespace ArcEngine
 
 		return root;
 	}
+
+	void EntitySerializer::GetAssetReferences(const YAML::Node& node, std::vector<SceneAssetReference>& outReferences)
+	{
+		ARC_PROFILE_SCOPE()
+
+		const auto addReference = [&outReferences](SceneAssetType type, const YAML::Node& component, const char* key)
+		{
+			if (!component)
+				return;
+
+			std::string path;
+			TrySet(path, component[key]);
+			if (!path.empty())
+				outReferences.push_back({ type, std::move(path) });
+		};
+
+		addReference(SceneAssetType::Texture2D, node["SpriteRendererComponent"], "TexturePath");
+		addReference(SceneAssetType::TextureCubemap, node["SkyLightComponent"], "TexturePath");
+		addReference(SceneAssetType::Texture2D, node["ParticleSystemComponent"], "TexturePath");
+		addReference(SceneAssetType::Mesh, node["MeshComponent"], "Filepath");
+		addReference(SceneAssetType::AudioSource, node["AudioSourceComponent"], "Filepath");
+	}
+
+	std::string EntitySerializer::ResolveAssetPath(const std::string& path)
+	{
+		ARC_PROFILE_SCOPE()
+
+		const std::filesystem::path assetPath = Project::GetAssetFileSystemPath(path);
+		if (std::filesystem::exists(assetPath))
+			return assetPath.string();
+		return path;
+	}
 }
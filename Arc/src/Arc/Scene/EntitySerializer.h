@@ -1,5 +1,7 @@
 #pragma once
 
+#include "Arc/Utils/StringUtils.h"
+
 namespace YAML
 {
 	class Emitter;
@@ -11,12 +13,35 @@ namespace ArcEngine
 	class Entity;
 	class Scene;
 
+	enum class SceneAssetType : uint8_t
+	{
+		Texture2D,
+		TextureCubemap,
+		Mesh,
+		AudioSource
+	};
+
+	struct SceneAssetReference
+	{
+		SceneAssetType Type;
+		std::string Path;		// As written in the scene file
+	};
+
+	// Asset path as written in the scene file -> path it is loaded from
+	using SceneAssetPathMap = std::unordered_map<std::string, std::string, UM_StringTransparentEquality>;
+
 	class EntitySerializer
 	{
 	public:
 		static void SerializeEntity(YAML::Emitter& out, Entity entity);
-		static UUID DeserializeEntity(const YAML::Node& node, Scene& scene, bool preserveUUID);
+		// Paths found in assetPaths are used as they are, others are resolved against the project on the spot
+		static UUID DeserializeEntity(const YAML::Node& node, Scene& scene, bool preserveUUID, const SceneAssetPathMap* assetPaths = nullptr);
 		static void SerializeEntityAsPrefab(const char* filepath, Entity entity);
 		static Entity DeserializeEntityAsPrefab(const char* filepath, Scene& scene);
+
+		// Assets an entity node refers to, without loading them
+		static void GetAssetReferences(const YAML::Node& node, std::vector<SceneAssetReference>& outReferences);
+		// Prefers the project asset directory and falls back to the path itself, touches the filesystem
+		[[nodiscard]] static std::string ResolveAssetPath(const std::string& path);
 	};
 }
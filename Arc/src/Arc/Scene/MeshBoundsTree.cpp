@@ -0,0 +1,113 @@
+#include "arcpch.h"
+#include "Arc/Scene/MeshBoundsTree.h"
+
+#include "Arc/Renderer/Mesh.h"
+#include "Arc/Scene/Components.h"
+#include "Arc/Scene/TransformCache.h"
+
+namespace ArcEngine
+{
+	void MeshBoundsTree::Clear()
+	{
+		ARC_PROFILE_SCOPE()
+
+		m_Tree.Clear();
+		m_Records.clear();
+		m_Visible.clear();
+	}
+
+	void MeshBoundsTree::Update()
+	{
+		ARC_PROFILE_SCOPE()
+
+		++m_UpdateIndex;
+
+		const auto view = m_Registry.view<MeshComponent>();
+		for (auto&& [entity, meshComponent] : view.each())
+		{
+			const size_t index = entt::to_entity(entity);
+			if (index >= m_Records.size())
+				m_Records.resize(index + 1);
+
+			Record& record = m_Records[index];
+			if (record.Handle != entity)
+			{
+				DestroyProxy(record);
+				record = Record();
+				record.Handle = entity;
+			}
+			record.LastUpdate = m_UpdateIndex;
+
+			const Submesh* submesh = nullptr;
+			if (meshComponent.MeshGeometry && meshComponent.MeshGeometry->GetSubmeshCount() != 0)
+			{
+				ARC_CORE_ASSERT(meshComponent.MeshGeometry->GetSubmeshCount() > meshComponent.SubmeshIndex, "Trying to access submesh index that does not exist!")
+				submesh = &meshComponent.MeshGeometry->GetSubmesh(meshComponent.SubmeshIndex);
+			}
+
+			if (!submesh)
+			{
+				DestroyProxy(record);
+				continue;
+			}
+
+			const uint64_t transformVersion = m_TransformCache.GetVersion(entity);
+			if (record.Proxy != DynamicAABBTree::NullNode && record.Geometry == submesh && record.TransformVersion == transformVersion)
+				continue;
+
+			const AABB bounds = submesh->BoundingBox.Transform(m_TransformCache.GetWorldTransform(entity));
+			if (record.Proxy == DynamicAABBTree::NullNode)
+				record.Proxy = m_Tree.CreateProxy(bounds, static_cast<uint32_t>(index));
+			else
+				m_Tree.MoveProxy(record.Proxy, bounds);
+
+			record.Geometry = submesh;
+			record.TransformVersion = m_TransformCache.GetVersion(entity);
+		}
+
+		// Entities that were destroyed or lost their MeshComponent
+		for (Record& record : m_Records)
+		{
+			if (record.Proxy != DynamicAABBTree::NullNode && record.LastUpdate != m_UpdateIndex)
+				DestroyProxy(record);
+		}
+	}
+
+	const std::vector<MeshBoundsTree::VisibleMesh>& MeshBoundsTree::Cull(std::span<const Frustum> frustums)
+	{
+		ARC_PROFILE_SCOPE()
+
+		ARC_CORE_ASSERT(frustums.size() <= 32, "Visibility mask only has room for 32 frustums")
+
+		++m_CullIndex;
+		m_Visible.clear();
+
+		for (uint32_t i = 0; i < static_cast<uint32_t>(frustums.size()); ++i)
+		{
+			const uint32_t bit = 1u << i;
+			m_Tree.Query(frustums[i], [this, bit](uint32_t index)
+			{
+				Record& record = m_Records[index];
+				if (record.LastCull != m_CullIndex)
+				{
+					record.LastCull = m_CullIndex;
+					record.VisibleIndex = static_cast<uint32_t>(m_Visible.size());
+					m_Visible.push_back({ record.Handle, 0 });
+				}
+				m_Visible[record.VisibleIndex].Mask |= bit;
+			});
+		}
+
+		return m_Visible;
+	}
+
+	void MeshBoundsTree::DestroyProxy(Record& record)
+	{
+		if (record.Proxy == DynamicAABBTree::NullNode)
+			return;
+
+		m_Tree.DestroyProxy(record.Proxy);
+		record.Proxy = DynamicAABBTree::NullNode;
+		record.Geometry = nullptr;
+	}
+}
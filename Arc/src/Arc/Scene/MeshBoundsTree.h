@@ -0,0 +1,63 @@
+#pragma once
+
+#include <span>
+
+#include <entt.hpp>
+
+#include "Arc/Utils/DynamicAABBTree.h"
+
+namespace ArcEngine
+{
+	class TransformCache;
+	struct Submesh;
+
+	// World space bounds of every MeshComponent kept in a dynamic BVH, so visibility queries
+	// only touch the part of the scene that is near the frustum.
+	// Proxies are refitted only when the entity's world transform or submesh changed.
+	class MeshBoundsTree
+	{
+	public:
+		struct VisibleMesh
+		{
+			entt::entity Handle;
+			uint32_t Mask;			// Bit i is set if the mesh is inside frustums[i]
+		};
+
+		MeshBoundsTree(entt::registry& registry, TransformCache& transformCache)
+			: m_Registry(registry), m_TransformCache(transformCache)
+		{
+		}
+
+		void Clear();
+		void Update();
+
+		// Every mesh that is inside at least one of the frustums, each reported once
+		[[nodiscard]] const std::vector<VisibleMesh>& Cull(std::span<const Frustum> frustums);
+
+		[[nodiscard]] size_t GetMeshCount() const { return m_Tree.GetProxyCount(); }
+
+	private:
+		struct Record
+		{
+			entt::entity Handle = entt::null;
+			int32_t Proxy = DynamicAABBTree::NullNode;
+			const Submesh* Geometry = nullptr;
+			uint64_t TransformVersion = 0;
+			uint32_t LastUpdate = 0;
+			uint32_t LastCull = 0;
+			uint32_t VisibleIndex = 0;
+		};
+
+		void DestroyProxy(Record& record);
+
+	private:
+		entt::registry& m_Registry;
+		TransformCache& m_TransformCache;
+
+		DynamicAABBTree m_Tree;
+		std::vector<Record> m_Records;
+		std::vector<VisibleMesh> m_Visible;
+		uint32_t m_UpdateIndex = 0;
+		uint32_t m_CullIndex = 0;
+	};
+}
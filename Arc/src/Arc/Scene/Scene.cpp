@@ -1,12 +1,15 @@
 #include "arcpch.h"
 #include "Arc/Scene/Scene.h"
 
+#include "Arc/Core/JobSystem.h"
 #include "Arc/Physics/Physics3D.h"
 #include "Arc/Physics/PhysicsUtils.h"
 #include "Arc/Renderer/EditorCamera.h"
 #include "Arc/Renderer/Renderer2D.h"
 #include "Arc/Renderer/Renderer3D.h"
 #include "Arc/Renderer/RenderGraphData.h"
+#include "Arc/Renderer/SpriteAtlas.h"
+#include "Arc/Renderer/Texture.h"
 #include "Arc/Scene/Components.h"
 #include "Arc/Scene/Entity.h"
 #include "Arc/Scripting/ScriptEngine.h"
@@ -17,7 +20,6 @@
 
 // Jolt includes
 #include <Jolt/Jolt.h>
-#include <Jolt/Core/JobSystemThreadPool.h>
 #include <Jolt/Physics/PhysicsSystem.h>
 #include <Jolt/Physics/Collision/Shape/BoxShape.h>
 #include <Jolt/Physics/Collision/Shape/SphereShape.h>
@@ -313,26 +315,31 @@ namespace ArcEngine
 
 	#pragma endregion
 
+	// Copies a component pool into another registry. entityMap takes the entity index in src to the entity in dst.
 	template<typename... Component>
-	static void CopyComponent(entt::registry& dst, entt::registry& src, std::unordered_map<UUID, entt::entity> enttMap)
+	static void CopyComponentPools(entt::registry& dst, const entt::registry& src, const std::vector<entt::entity>& entityMap, std::vector<entt::entity>& dstEntities)
 	{
 		([&]()
 		{
-			auto view = src.view<Component>();
-			for (auto e : view)
-			{
-				UUID uuid = src.get<IDComponent>(e).ID;
-				entt::entity dstEnttID = enttMap.at(uuid);
-				const auto& component = src.get<Component>(e);
-				dst.emplace_or_replace<Component>(dstEnttID, component);
-			}
+			const auto& srcStorage = src.storage<Component>();
+			if (srcStorage.empty())
+				return;
+
+			// Reverse iterators walk the packed arrays front to back, so the copy keeps the order of the source pool
+			const entt::sparse_set& srcEntities = srcStorage;
+			dstEntities.clear();
+			dstEntities.reserve(srcEntities.size());
+			for (auto it = srcEntities.rbegin(); it != srcEntities.rend(); ++it)
+				dstEntities.push_back(entityMap[entt::to_entity(*it)]);
+
+			dst.insert<Component>(dstEntities.begin(), dstEntities.end(), srcStorage.rbegin());
 		}(), ...);
 	}
 
 	template<typename... Component>
-	static void CopyComponent(ComponentGroup<Component...>, entt::registry& dst, entt::registry& src, std::unordered_map<UUID, entt::entity> enttMap)
+	static void CopyComponentPools(ComponentGroup<Component...>, entt::registry& dst, const entt::registry& src, const std::vector<entt::entity>& entityMap, std::vector<entt::entity>& dstEntities)
 	{
-		CopyComponent<Component...>(dst, src, enttMap);
+		CopyComponentPools<Component...>(dst, src, entityMap, dstEntities);
 	}
 
 	template<typename... Component>
@@ -365,27 +372,28 @@ namespace ArcEngine
 		newScene->m_ViewportWidth = other->m_ViewportWidth;
 		newScene->m_ViewportHeight = other->m_ViewportHeight;
 
-		const auto view = other->m_Registry.group<IDComponent, TagComponent>();
-		for (auto it = view.rbegin(); it != view.rend(); ++it)
-		{
-			auto [id, tag] = view.get<IDComponent, TagComponent>(*it);
-			Entity newEntity = newScene->CreateEntityWithUUID(id.ID, tag.Tag);
-			newEntity.GetComponent<TagComponent>().Enabled = tag.Enabled;
-			newEntity.GetComponent<TagComponent>().Layer = tag.Layer;
-		}
+		const entt::registry& srcRegistry = other->m_Registry;
+		entt::registry& dstRegistry = newScene->m_Registry;
+
+		// Every entity is created in one go and mapped by index, components are then copied pool by pool.
+		// Entities refer to each other by UUID, which the copies keep, so no component needs fixing up.
+		const auto& ids = srcRegistry.storage<IDComponent>();
+		const entt::sparse_set& srcEntities = ids;
+		std::vector<entt::entity> dstEntities(srcEntities.size());
+		dstRegistry.create(dstEntities.begin(), dstEntities.end());
 
-		for (const auto e : view)
+		std::vector<entt::entity> entityMap(srcRegistry.size(), entt::entity(entt::null));
+		newScene->m_EntityMap.reserve(srcEntities.size());
+		size_t index = 0;
+		for (auto it = srcEntities.rbegin(); it != srcEntities.rend(); ++it, ++index)
 		{
-			Entity src = { e, other.get() };
-			Entity dst = newScene->GetEntity(view.get<IDComponent>(e).ID);
-			if (Entity srcParent = src.GetParent())
-				dst.SetParent(newScene->GetEntity(srcParent.GetUUID()));
+			entityMap[entt::to_entity(*it)] = dstEntities[index];
+			newScene->m_EntityMap.emplace(ids.get(*it).ID, dstEntities[index]);
 		}
 
-		auto& srcRegistry = other->m_Registry;
-		auto& dstRegistry = newScene->m_Registry;
-
-		CopyComponent(AllComponents{}, dstRegistry, srcRegistry, newScene->m_EntityMap);
+		CopyComponentPools<IDComponent, TagComponent>(dstRegistry, srcRegistry, entityMap, dstEntities);
+		CopyComponentPools(AllComponents{}, dstRegistry, srcRegistry, entityMap, dstEntities);
+		newScene->m_TransformCache.InvalidateHierarchy();
 
 		return newScene;
 	}
@@ -403,6 +411,7 @@ namespace ArcEngine
 
 		Entity entity = { m_Registry.create(), this };
 		m_EntityMap.emplace(uuid, entity);
+		m_TransformCache.InvalidateHierarchy();
 
 		entity.AddComponent<IDComponent>(uuid);
 
@@ -430,6 +439,7 @@ namespace ArcEngine
 
 		m_EntityMap.erase(entity.GetUUID());
 		m_Registry.destroy(entity);
+		m_TransformCache.InvalidateHierarchy();
 	}
 
 	Entity Scene::Duplicate(Entity entity)
@@ -439,6 +449,8 @@ namespace ArcEngine
 		std::string name = entity.GetComponent<TagComponent>().Tag;
 		Entity duplicate = CreateEntity(name);
 		CopyComponent(AllComponents{}, m_Registry, entity, duplicate);
+		if (auto* particleSystem = m_Registry.try_get<ParticleSystemComponent>(duplicate))
+			particleSystem->System = particleSystem->System->Clone();
 		return duplicate;
 	}
 
@@ -464,7 +476,7 @@ namespace ArcEngine
 	{
 		ARC_PROFILE_SCOPE()
 
-		SortForSprites();
+		BuildSpriteAtlas();
 
 		m_IsRunning = true;
 
@@ -687,6 +699,10 @@ namespace ArcEngine
 			const auto particleSystemView = m_Registry.view<ParticleSystemComponent>();
 			for (auto&& [e, psc] : particleSystemView.each())
 			{
+				// Copied scenes share their systems with the scene they came from until they start simulating them
+				if (psc.System.use_count() > 1)
+					psc.System = psc.System->Clone();
+
 				if (psc.System->GetProperties().PlayOnAwake)
 					psc.System->Play();
 				else
@@ -730,6 +746,9 @@ namespace ArcEngine
 
 		m_IsRunning = false;
 
+		m_SpriteAtlas = nullptr;
+		m_SpriteRenderCache.SetAtlas(nullptr);
+
 		#pragma region Scripting
 		{
 			ARC_PROFILE_CATEGORY("OnDestroy", Profile::Category::Script)
@@ -813,9 +832,7 @@ namespace ArcEngine
 		{
 			ARC_PROFILE_CATEGORY("VFX", Profile::Category::VFX)
 
-			const auto particleSystemView = m_Registry.view<TransformComponent, ParticleSystemComponent>();
-			for (auto&& [e, tc, psc] : particleSystemView.each())
-				psc.System->OnUpdate(ts, tc.Translation);
+			UpdateParticleSystems(ts);
 		}
 		#pragma endregion
 
@@ -1043,6 +1060,8 @@ namespace ArcEngine
 		}
 		#pragma endregion
 
+		m_TransformCache.Update();
+
 		#pragma region Audio
 		{
 			ARC_PROFILE_CATEGORY("Audio", Profile::Category::Audio)
@@ -1079,9 +1098,7 @@ namespace ArcEngine
 		{
 			ARC_PROFILE_CATEGORY("VFX", Profile::Category::VFX)
 
-			const auto particleSystemView = m_Registry.view<TransformComponent, ParticleSystemComponent>();
-			for (auto&& [e, tc, psc] : particleSystemView.each())
-				psc.System->OnUpdate(ts, tc.Translation);
+			UpdateParticleSystems(ts);
 		}
 		#pragma endregion
 
@@ -1147,11 +1164,59 @@ namespace ArcEngine
 		return {};
 	}
 
-	void Scene::SortForSprites()
+	void Scene::BuildSpriteAtlas()
 	{
-		m_Registry.sort<SpriteRendererComponent>([](const auto& lhs, const auto& rhs)
+		ARC_PROFILE_SCOPE()
+
+		m_SpriteAtlas = nullptr;
+
+		// Tiled sprites wrap around their texture, which only works with a texture of their own.
+		// Textures that are still loading have no path yet and are drawn on their own as well.
+		std::vector<std::string> paths;
+		std::unordered_set<const Texture2D*> textures;
+		const auto view = m_Registry.view<SpriteRendererComponent>();
+		for (auto &&[entity, sprite] : view.each())
+		{
+			const Texture2D* texture = sprite.Texture.get();
+			if (texture && sprite.TilingFactor == 1.0f && !texture->GetPath().empty()
+				&& texture->GetWidth() <= SpriteAtlas::MaxSpriteSize && texture->GetHeight() <= SpriteAtlas::MaxSpriteSize
+				&& textures.insert(texture).second)
+			{
+				paths.push_back(texture->GetPath());
+			}
+		}
+
+		// One texture batches just as well without an atlas
+		if (paths.size() >= 2)
 		{
-			return lhs.SortingOrder < rhs.SortingOrder;
+			std::ranges::sort(paths);
+			m_SpriteAtlas = SpriteAtlas::Create(paths);
+		}
+		m_SpriteRenderCache.SetAtlas(m_SpriteAtlas);
+	}
+
+	void Scene::UpdateParticleSystems(Timestep ts)
+	{
+		ARC_PROFILE_SCOPE()
+
+		// Systems are independent of each other, but duplicated entities can share one.
+		// A shared system emits from the first of its entities in view order, the sort keeps that order.
+		m_ParticleSystemUpdates.clear();
+		const auto particleSystemView = m_Registry.view<TransformComponent, ParticleSystemComponent>();
+		for (auto&& [e, tc, psc] : particleSystemView.each())
+		{
+			if (psc.System)
+				m_ParticleSystemUpdates.emplace_back(psc.System.get(), tc.Translation);
+		}
+
+		std::ranges::stable_sort(m_ParticleSystemUpdates, {}, &std::pair<ParticleSystem*, glm::vec3>::first);
+		const auto duplicates = std::ranges::unique(m_ParticleSystemUpdates, {}, &std::pair<ParticleSystem*, glm::vec3>::first);
+		m_ParticleSystemUpdates.erase(duplicates.begin(), duplicates.end());
+
+		JobSystem::ParallelFor(static_cast<uint32_t>(m_ParticleSystemUpdates.size()), 1, [this, ts](uint32_t begin, uint32_t end)
+		{
+			for (uint32_t i = begin; i < end; ++i)
+				m_ParticleSystemUpdates[i].first->OnUpdate(ts, m_ParticleSystemUpdates[i].second);
 		});
 	}
 
@@ -1159,6 +1224,8 @@ namespace ArcEngine
 	{
 		ARC_PROFILE_CATEGORY("Rendering", Profile::Category::Rendering)
 
+		m_TransformCache.Update();
+
 		std::vector<Entity> lights;
 		{
 			ARC_PROFILE_SCOPE("Prepare Light Data")
@@ -1178,19 +1245,31 @@ namespace ArcEngine
 		}
 
 		Renderer3D::BeginScene(cameraData, skylight, std::move(lights));
+
+		// Frustum 0 is the camera, the rest are the shadow map cascades in visibility bit order.
+		// Each cascade only gets the meshes that can throw a shadow into it.
+		std::array<Frustum, Renderer3D::MAX_NUM_SHADOW_MAPS + 1> frustums;
+		uint32_t frustumCount = 0;
+		{
+			ARC_PROFILE_SCOPE("Prepare Frustums")
+
+			frustums[frustumCount++] = Frustum(cameraData.ViewProjection);
+			for (const Renderer3D::ShadowMap& shadowMap : Renderer3D::GetShadowMaps())
+				frustums[frustumCount++] = Frustum(shadowMap.Cascade.ViewProjection);
+		}
+
 		// Meshes
 		{
 			ARC_PROFILE_SCOPE("Submit Mesh Data")
 
-			const auto view = m_Registry.view<MeshComponent>();
-			Renderer3D::ReserveMeshes(view.size());
-			for (auto &&[entity, meshComponent] : view.each())
+			m_MeshBoundsTree.Update();
+			const auto& visibleMeshes = m_MeshBoundsTree.Cull({ frustums.data(), frustumCount });
+
+			Renderer3D::ReserveMeshes(visibleMeshes.size());
+			for (const auto& [entity, mask] : visibleMeshes)
 			{
-				if (meshComponent.MeshGeometry && meshComponent.MeshGeometry->GetSubmeshCount() != 0)
-				{
-					ARC_CORE_ASSERT(meshComponent.MeshGeometry->GetSubmeshCount() > meshComponent.SubmeshIndex, "Trying to access submesh index that does not exist!")
-					Renderer3D::SubmitMesh(Entity(entity, this).GetWorldTransform(), meshComponent.MeshGeometry->GetSubmesh(meshComponent.SubmeshIndex), meshComponent.CullMode);
-				}
+				const MeshComponent& meshComponent = m_Registry.get<MeshComponent>(entity);
+				Renderer3D::SubmitMesh(m_TransformCache.GetWorldTransform(entity), meshComponent.MeshGeometry->GetSubmesh(meshComponent.SubmeshIndex), meshComponent.CullMode, mask);
 			}
 		}
 		Renderer3D::EndScene(renderGraphData);
@@ -1206,11 +1285,8 @@ namespace ArcEngine
 		{
 			ARC_PROFILE_SCOPE("Submit 2D Data")
 
-			const auto view = m_Registry.view<SpriteRendererComponent>();
-			for (auto &&[entity, sprite] : view.each())
-			{
-				Renderer2D::DrawQuad(Entity(entity, this).GetWorldTransform(), sprite.Texture, sprite.Color, sprite.TilingFactor);
-			}
+			m_SpriteRenderCache.Update();
+			m_SpriteRenderCache.Submit(frustums[0]);
 		}
 		Renderer2D::EndScene(renderGraphData);
 	}
@@ -4,6 +4,9 @@
 
 #include "Arc/Core/UUID.h"
 #include "Arc/Core/Timestep.h"
+#include "Arc/Scene/MeshBoundsTree.h"
+#include "Arc/Scene/SpriteRenderCache.h"
+#include "Arc/Scene/TransformCache.h"
 
 class b2World;
 class b2Fixture;
@@ -14,6 +17,8 @@ namespace ArcEngine
 	class EditorCamera;
 	struct CameraData;
 	struct RenderGraphData;
+	class ParticleSystem;
+	class SpriteAtlas;
 
 	struct TransformComponent;
 
@@ -58,6 +63,8 @@ namespace ArcEngine
 		[[nodiscard]] bool HasEntity(UUID uuid) const;
 		[[nodiscard]] Entity GetEntity(UUID uuid);
 		[[nodiscard]] bool IsRunning() const { return m_IsRunning; }
+		// Unique per scene object, entity handles given to scripts are checked against it
+		[[nodiscard]] uint32_t GetInstanceID() const { return m_InstanceID; }
 
 		void OnUpdateEditor([[maybe_unused]] Timestep ts, const Ref<RenderGraphData>& renderGraphData, const EditorCamera& camera);
 		void OnUpdateRuntime([[maybe_unused]] Timestep ts, const Ref<RenderGraphData>& renderGraphData, const EditorCamera* overrideCamera = nullptr);
@@ -69,7 +76,6 @@ namespace ArcEngine
 		void MarkViewportDirty() { m_ViewportDirty = true; }
 		[[nodiscard]] bool IsViewportDirty() const { return m_ViewportDirty; }
 		[[nodiscard]] Entity GetPrimaryCameraEntity();
-		void SortForSprites();
 
 		template<typename... Components>
 		[[nodiscard]] auto GetAllEntitiesWith()
@@ -84,6 +90,9 @@ namespace ArcEngine
 		void CreateCircleCollider2D(Entity entity, const TransformComponent& transform, const Rigidbody2DComponent& rb, CircleCollider2DComponent& component) const;
 		void CreatePolygonCollider2D(Entity entity, const Rigidbody2DComponent& rb, PolygonCollider2DComponent& component) const;
 
+		void UpdateParticleSystems(Timestep ts);
+		void BuildSpriteAtlas();
+
 		template<typename T>
 		void OnComponentAdded([[maybe_unused]] Entity entity, [[maybe_unused]] T& component);
 	
@@ -91,12 +100,21 @@ namespace ArcEngine
 
 		friend class Entity;
 		friend class SceneSerializer;
+		friend class BinarySceneSerializer;
+		friend class SceneSnapshot;
 		friend class SceneHierarchyPanel;
+		friend class ScriptEngineRegistry;
 
 		entt::registry m_Registry;
 		std::unordered_map<UUID, entt::entity> m_EntityMap;
+		TransformCache m_TransformCache{ m_Registry, m_EntityMap };
+		MeshBoundsTree m_MeshBoundsTree{ m_Registry, m_TransformCache };
+		SpriteRenderCache m_SpriteRenderCache{ m_Registry, m_TransformCache };
 		bool m_IsRunning = false;
 
+		inline static std::atomic<uint32_t> s_NextInstanceID = 1;
+		uint32_t m_InstanceID = s_NextInstanceID++;
+
 		b2World* m_PhysicsWorld2D = nullptr;
 		Physics2DContactListener* m_ContactListener2D = nullptr;
 		Physics3DContactListener* m_ContactListener3D = nullptr;
@@ -106,5 +124,10 @@ namespace ArcEngine
 		bool m_ViewportDirty = true;
 
 		float m_PhysicsFrameAccumulator = 0.0f;
+
+		std::vector<std::pair<ParticleSystem*, glm::vec3>> m_ParticleSystemUpdates;
+
+		// Sprite textures packed at runtime start
+		Ref<SpriteAtlas> m_SpriteAtlas = nullptr;
 	};
 }
@@ -0,0 +1,467 @@
+#include "arcpch.h"
+#include "Arc/Scene/SceneLoader.h"
+
+#include <yaml-cpp/yaml.h>
+
+#include "Arc/Core/AssetManager.h"
+#include "Arc/Core/Filesystem.h"
+#include "Arc/Renderer/Mesh.h"
+#include "Arc/Renderer/Texture.h"
+#include "Arc/Scene/BinarySceneSerializer.h"
+#include "Arc/Scene/Scene.h"
+
+namespace ArcEngine
+{
+	static constexpr size_t s_EntitiesPerChunk = 64;
+	static constexpr uint32_t s_InvalidAsset = std::numeric_limits<uint32_t>::max();
+
+	// The entity list is a block sequence, so it can be cut at the start of any item and every piece parses
+	// on its own. Returns false if the text does not look like that, the file is then parsed as a whole.
+	static bool SplitEntities(std::string_view text, std::string_view& outHeader, std::vector<std::string_view>& outItems)
+	{
+		ARC_PROFILE_SCOPE()
+
+		constexpr std::string_view key = "\nEntities:";
+		const size_t keyOffset = text.find(key);
+		if (keyOffset == std::string_view::npos)
+			return false;
+
+		outHeader = text.substr(0, keyOffset + 1);
+
+		size_t lineBegin = text.find('\n', keyOffset + 1);
+		if (lineBegin == std::string_view::npos)
+			return true;
+
+		// Anything after the colon is an inline list, which is only written for empty scenes
+		const std::string_view keyLine = text.substr(keyOffset + key.size(), lineBegin - keyOffset - key.size());
+		if (keyLine.find_first_not_of(" \r") != std::string_view::npos)
+			return false;
+
+		std::string_view itemPrefix;
+		++lineBegin;
+		while (lineBegin < text.size())
+		{
+			size_t lineEnd = text.find('\n', lineBegin);
+			if (lineEnd == std::string_view::npos)
+				lineEnd = text.size();
+			const std::string_view line = text.substr(lineBegin, lineEnd - lineBegin);
+
+			const size_t indent = line.find_first_not_of(' ');
+			if (indent != std::string_view::npos && line[indent] != '\r')
+			{
+				if (itemPrefix.empty())
+				{
+					if (line.substr(indent, 2) != "- ")
+						return false;
+					itemPrefix = line.substr(0, indent + 2);
+				}
+
+				// Another top level key after the list
+				if (indent == 0 && itemPrefix.size() > 2)
+					return false;
+
+				if (line.starts_with(itemPrefix))
+					outItems.push_back(text.substr(lineBegin));
+			}
+
+			lineBegin = lineEnd + 1;
+		}
+
+		// Every item runs up to the next one
+		for (size_t i = 0; i + 1 < outItems.size(); ++i)
+			outItems[i] = outItems[i].substr(0, outItems[i].size() - outItems[i + 1].size());
+
+		return true;
+	}
+
+	SceneLoader::SceneLoader(const Ref<Scene>& scene, const std::filesystem::path& filepath)
+		: m_Scene(scene), m_Filepath(filepath)
+	{
+		ARC_PROFILE_SCOPE()
+
+		JobSystem::Submit([this]() { Parse(); }, &m_ParseCounter);
+	}
+
+	SceneLoader::~SceneLoader()
+	{
+		JobSystem::Wait(m_ParseCounter);
+	}
+
+	bool SceneLoader::Update(float budgetMilliseconds)
+	{
+		ARC_PROFILE_SCOPE()
+
+		if (m_State == State::Parsing)
+		{
+			if (!m_ParseCounter.IsDone())
+				return false;
+
+			BeginLoading();
+		}
+
+		if (m_State != State::Loading)
+			return true;
+
+		const auto begin = std::chrono::steady_clock::now();
+		const std::chrono::duration<float, std::milli> budget(budgetMilliseconds);
+
+		// Hierarchies go in file order, the ones still waiting for their assets are tried again next frame.
+		// A hierarchy is added as a whole, so every child listed by an entity in the scene exists too.
+		// At least one hierarchy is added per call, so the load keeps moving even with a tiny budget.
+		bool outOfTime = false;
+		size_t waitingCount = 0;
+		for (auto& hierarchy : m_Waiting)
+		{
+			if (outOfTime || !IsReady(hierarchy))
+			{
+				if (&m_Waiting[waitingCount] != &hierarchy)
+					m_Waiting[waitingCount] = std::move(hierarchy);
+				++waitingCount;
+				continue;
+			}
+
+			AddHierarchy(hierarchy);
+			outOfTime = budgetMilliseconds > 0.0f && std::chrono::steady_clock::now() - begin >= budget;
+		}
+		m_Waiting.resize(waitingCount);
+
+		if (m_Waiting.empty())
+			Complete();
+
+		return IsDone();
+	}
+
+	bool SceneLoader::Finish()
+	{
+		ARC_PROFILE_SCOPE()
+
+		JobSystem::Wait(m_ParseCounter);
+		if (m_State == State::Parsing)
+			BeginLoading();
+
+		if (m_State == State::Loading)
+		{
+			for (const auto& hierarchy : m_Waiting)
+				AddHierarchy(hierarchy);
+			m_Waiting.clear();
+			Complete();
+		}
+
+		return !HasFailed();
+	}
+
+	SceneLoadProgress SceneLoader::GetProgress() const
+	{
+		SceneLoadProgress progress;
+		progress.Parsed = m_State != State::Parsing;
+		progress.EntityCount = m_EntityCount;
+		progress.EntitiesLoaded = m_EntitiesLoaded;
+		progress.AssetCount = static_cast<uint32_t>(m_Assets.size());
+		for (const PendingAsset& asset : m_Assets)
+			progress.AssetsLoaded += AssetManager::IsLoading(asset.Handle) ? 0 : 1;
+		return progress;
+	}
+
+	void SceneLoader::Parse()
+	{
+		ARC_PROFILE_SCOPE()
+
+		if (BinarySceneSerializer::IsBinaryScene(m_Filepath))
+		{
+			m_IsBinary = true;
+			return;
+		}
+
+		m_Text = Filesystem::ReadFileText(m_Filepath);
+		if (m_Text.empty())
+		{
+			m_ParseFailed = true;
+			return;
+		}
+
+		std::string_view header;
+		std::vector<std::string_view> items;
+		if (SplitEntities(m_Text, header, items))
+		{
+			try
+			{
+				if (!YAML::Load(std::string(header))["Scene"])
+				{
+					ARC_CORE_ERROR("'{0}' is not a scene file", m_Filepath.string());
+					m_ParseFailed = true;
+					return;
+				}
+			}
+			catch (YAML::Exception& e)
+			{
+				ARC_CORE_ERROR("Failed to load scene file '{0}'\n     {1}", m_Filepath.string(), e.what());
+				m_ParseFailed = true;
+				return;
+			}
+
+			m_Chunks.resize((items.size() + s_EntitiesPerChunk - 1) / s_EntitiesPerChunk);
+			for (size_t i = 0; i < m_Chunks.size(); ++i)
+			{
+				const size_t first = i * s_EntitiesPerChunk;
+				const size_t last = glm::min(first + s_EntitiesPerChunk, items.size()) - 1;
+				m_Chunks[i].Text = { items[first].data(), static_cast<size_t>(items[last].data() + items[last].size() - items[first].data()) };
+			}
+
+			std::atomic<bool> failed = false;
+			JobSystem::ParallelFor(static_cast<uint32_t>(m_Chunks.size()), 1, [this, &failed](uint32_t begin, uint32_t end)
+			{
+				for (uint32_t i = begin; i < end; ++i)
+				{
+					if (!ParseChunk(m_Chunks[i]))
+						failed.store(true, std::memory_order_relaxed);
+				}
+			});
+
+			if (!failed)
+				return;
+		}
+
+		// Hand written files may not split cleanly, parse those in one go
+		m_Chunks.clear();
+		ParsedChunk& chunk = m_Chunks.emplace_back();
+		chunk.Text = m_Text;
+		chunk.IsDocument = true;
+		m_ParseFailed = !ParseChunk(chunk);
+	}
+
+	bool SceneLoader::ParseChunk(ParsedChunk& chunk) const
+	{
+		ARC_PROFILE_SCOPE()
+
+		try
+		{
+			const YAML::Node root = YAML::Load(std::string(chunk.Text));
+			if (chunk.IsDocument && !root["Scene"])
+				return false;
+
+			const YAML::Node entities = chunk.IsDocument ? root["Entities"] : root;
+			if (!entities)
+				return true;
+
+			// Paths are usually shared by many entities, each one is resolved once per chunk
+			std::unordered_map<std::string, uint32_t> assetIndices;
+			std::vector<SceneAssetReference> references;
+			for (const auto& node : entities)
+			{
+				ParsedEntity& entity = chunk.Entities.emplace_back();
+				entity.Node = chunk.Nodes.size();
+				chunk.Nodes.push_back(node);
+				if (const YAML::Node id = node["Entity"])
+					entity.ID = id.as<uint64_t>();
+				if (const YAML::Node relationship = node["RelationshipComponent"])
+				{
+					if (const YAML::Node parent = relationship["Parent"])
+						entity.Parent = parent.as<uint64_t>();
+				}
+
+				references.clear();
+				EntitySerializer::GetAssetReferences(node, references);
+				for (SceneAssetReference& reference : references)
+				{
+					const auto it = assetIndices.find(reference.Path);
+					if (it != assetIndices.end() && chunk.Assets[it->second].Type == reference.Type)
+					{
+						entity.Assets.push_back(it->second);
+						continue;
+					}
+
+					std::string resolvedPath = it != assetIndices.end() ? chunk.ResolvedPaths[it->second] : EntitySerializer::ResolveAssetPath(reference.Path);
+					const auto index = static_cast<uint32_t>(chunk.Assets.size());
+					entity.Assets.push_back(index);
+					chunk.ResolvedPaths.push_back(std::move(resolvedPath));
+					assetIndices.try_emplace(reference.Path, index);
+					chunk.Assets.push_back(std::move(reference));
+				}
+			}
+		}
+		catch (YAML::Exception& e)
+		{
+			// Split chunks are quietly parsed again as a whole file, which reports the error
+			if (chunk.IsDocument)
+				ARC_CORE_ERROR("Failed to load scene file '{0}'\n     {1}", m_Filepath.string(), e.what());
+			return false;
+		}
+
+		return true;
+	}
+
+	void SceneLoader::BeginLoading()
+	{
+		ARC_PROFILE_SCOPE()
+
+		if (m_ParseFailed)
+		{
+			m_State = State::Failed;
+			return;
+		}
+
+		if (m_IsBinary)
+		{
+			m_State = BinarySceneSerializer::Deserialize(*m_Scene, m_Filepath) ? State::Done : State::Failed;
+			return;
+		}
+
+		RequestAssets();
+
+		std::unordered_map<uint64_t, EntityIndex> indices;
+		for (uint32_t chunkIndex = 0; chunkIndex < m_Chunks.size(); ++chunkIndex)
+		{
+			const auto& entities = m_Chunks[chunkIndex].Entities;
+			for (uint32_t entityIndex = 0; entityIndex < entities.size(); ++entityIndex)
+			{
+				if (entities[entityIndex].ID)
+					indices.try_emplace(entities[entityIndex].ID, chunkIndex, entityIndex);
+			}
+		}
+		m_EntityCount = 0;
+
+		// Every entity joins the hierarchy of its topmost ancestor in the file. The walk is capped
+		// at the entity count, so a broken file with a parent cycle still ends.
+		std::unordered_map<uint64_t, size_t> hierarchies;
+		for (uint32_t chunkIndex = 0; chunkIndex < m_Chunks.size(); ++chunkIndex)
+		{
+			const auto& entities = m_Chunks[chunkIndex].Entities;
+			for (uint32_t entityIndex = 0; entityIndex < entities.size(); ++entityIndex)
+			{
+				uint64_t root = entities[entityIndex].ID;
+				uint64_t parent = entities[entityIndex].Parent;
+				for (size_t depth = 0; parent && depth < indices.size(); ++depth)
+				{
+					const auto it = indices.find(parent);
+					if (it == indices.end())
+						break;
+					root = parent;
+					parent = m_Chunks[it->second.first].Entities[it->second.second].Parent;
+				}
+
+				if (!root)
+				{
+					m_Waiting.emplace_back().emplace_back(chunkIndex, entityIndex);
+				}
+				else
+				{
+					const auto [it, inserted] = hierarchies.try_emplace(root, m_Waiting.size());
+					if (inserted)
+						m_Waiting.emplace_back();
+					m_Waiting[it->second].emplace_back(chunkIndex, entityIndex);
+				}
+				++m_EntityCount;
+			}
+		}
+		m_State = State::Loading;
+	}
+
+	void SceneLoader::RequestAssets()
+	{
+		ARC_PROFILE_SCOPE()
+
+		// One request per distinct asset, they stream in while the entities are parsed into the scene
+		std::array<std::unordered_map<std::string_view, uint32_t>, 4> assetIndices;
+		std::vector<uint32_t> remap;
+		for (ParsedChunk& chunk : m_Chunks)
+		{
+			remap.assign(chunk.Assets.size(), s_InvalidAsset);
+			for (size_t i = 0; i < chunk.Assets.size(); ++i)
+			{
+				const SceneAssetReference& reference = chunk.Assets[i];
+				const std::string& path = chunk.ResolvedPaths[i];
+				m_AssetPaths.try_emplace(reference.Path, path);
+
+				// Audio sources are not shared, each one is decoded when its entity is added
+				if (reference.Type == SceneAssetType::AudioSource)
+					continue;
+
+				auto& indices = assetIndices[static_cast<size_t>(reference.Type)];
+				const auto [it, inserted] = indices.try_emplace(path, static_cast<uint32_t>(m_Assets.size()));
+				remap[i] = it->second;
+				if (!inserted)
+					continue;
+
+				PendingAsset& asset = m_Assets.emplace_back();
+				switch (reference.Type)
+				{
+					case SceneAssetType::Texture2D:
+						asset.Asset = AssetManager::GetTexture2D(path);
+						break;
+					case SceneAssetType::TextureCubemap:
+						asset.Asset = AssetManager::GetTextureCubemap(path);
+						break;
+					case SceneAssetType::Mesh:
+						asset.Asset = AssetManager::GetMesh(path);
+						break;
+					case SceneAssetType::AudioSource:
+						break;
+				}
+				asset.Handle = asset.Asset.get();
+			}
+
+			for (ParsedEntity& entity : chunk.Entities)
+			{
+				for (uint32_t& index : entity.Assets)
+					index = remap[index];
+				std::erase(entity.Assets, s_InvalidAsset);
+			}
+		}
+	}
+
+	bool SceneLoader::IsReady(const ParsedEntity& entity) const
+	{
+		for (const uint32_t index : entity.Assets)
+		{
+			if (AssetManager::IsLoading(m_Assets[index].Handle))
+				return false;
+		}
+		return true;
+	}
+
+	bool SceneLoader::IsReady(const std::vector<EntityIndex>& hierarchy) const
+	{
+		for (const auto& [chunkIndex, entityIndex] : hierarchy)
+		{
+			if (!IsReady(m_Chunks[chunkIndex].Entities[entityIndex]))
+				return false;
+		}
+		return true;
+	}
+
+	void SceneLoader::AddEntity(const ParsedChunk& chunk, const ParsedEntity& entity)
+	{
+		ARC_PROFILE_SCOPE()
+
+		try
+		{
+			EntitySerializer::DeserializeEntity(chunk.Nodes[entity.Node], *m_Scene, true, &m_AssetPaths);
+		}
+		catch (YAML::Exception& e)
+		{
+			ARC_CORE_ERROR("Failed to load an entity of scene file '{0}'\n     {1}", m_Filepath.string(), e.what());
+		}
+		++m_EntitiesLoaded;
+	}
+
+	void SceneLoader::AddHierarchy(const std::vector<EntityIndex>& hierarchy)
+	{
+		ARC_PROFILE_SCOPE()
+
+		for (const auto& [chunkIndex, entityIndex] : hierarchy)
+			AddEntity(m_Chunks[chunkIndex], m_Chunks[chunkIndex].Entities[entityIndex]);
+	}
+
+	void SceneLoader::Complete()
+	{
+		ARC_PROFILE_SCOPE()
+
+		m_State = State::Done;
+
+		// Nodes and text are only needed until every entity is in
+		m_Chunks.clear();
+		m_Chunks.shrink_to_fit();
+		m_Text.clear();
+		m_Text.shrink_to_fit();
+	}
+}
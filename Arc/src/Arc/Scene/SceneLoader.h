@@ -0,0 +1,119 @@
+#pragma once
+
+#include "Arc/Core/JobSystem.h"
+#include "Arc/Scene/EntitySerializer.h"
+
+namespace ArcEngine
+{
+	class Scene;
+
+	struct SceneLoadProgress
+	{
+		uint32_t EntityCount = 0;
+		uint32_t EntitiesLoaded = 0;
+		uint32_t AssetCount = 0;
+		uint32_t AssetsLoaded = 0;
+		bool Parsed = false;
+
+		// Entities and assets weigh the same
+		[[nodiscard]] float GetFraction() const
+		{
+			const uint32_t total = EntityCount + AssetCount;
+			if (!Parsed)
+				return 0.0f;
+			return total == 0 ? 1.0f : static_cast<float>(EntitiesLoaded + AssetsLoaded) / static_cast<float>(total);
+		}
+	};
+
+	// Loads a scene file over several frames instead of blocking the main thread for the whole load.
+	// The file is parsed on the job system, one chunk of entities per job, which also resolves the asset paths.
+	// Every distinct asset is then requested once, and Update adds each hierarchy to the scene as soon as
+	// the assets used by all of its entities are uploaded, so a parent never shows up without its children.
+	// Binary scenes need no parsing and are read in one step.
+	class SceneLoader
+	{
+	public:
+		SceneLoader(const Ref<Scene>& scene, const std::filesystem::path& filepath);
+		~SceneLoader();
+
+		SceneLoader(const SceneLoader& other) = delete;
+		SceneLoader(SceneLoader&& other) = delete;
+
+		// Adds hierarchies whose assets are ready until the budget runs out, call once per frame on the main thread.
+		// Returns true once the load is over.
+		bool Update(float budgetMilliseconds = 2.0f);
+
+		// Adds everything that is left without waiting for the assets, returns false if the load failed
+		bool Finish();
+
+		[[nodiscard]] bool IsDone() const { return m_State == State::Done || m_State == State::Failed; }
+		[[nodiscard]] bool HasFailed() const { return m_State == State::Failed; }
+		[[nodiscard]] SceneLoadProgress GetProgress() const;
+		[[nodiscard]] const std::filesystem::path& GetFilepath() const { return m_Filepath; }
+
+	private:
+		enum class State : uint8_t
+		{
+			Parsing,
+			Loading,
+			Done,
+			Failed
+		};
+
+		struct ParsedEntity
+		{
+			size_t Node;							// Into ParsedChunk::Nodes
+			uint64_t ID = 0;
+			uint64_t Parent = 0;
+			std::vector<uint32_t> Assets;			// Into ParsedChunk::Assets until merged, then into m_Assets
+		};
+
+		struct ParsedChunk
+		{
+			std::string_view Text;
+			bool IsDocument = false;				// Whole file instead of a run of entity items
+			std::vector<YAML::Node> Nodes;
+			std::vector<ParsedEntity> Entities;
+			std::vector<SceneAssetReference> Assets;
+			std::vector<std::string> ResolvedPaths;
+		};
+
+		using EntityIndex = std::pair<uint32_t, uint32_t>;	// Chunk and entity index
+
+		struct PendingAsset
+		{
+			const void* Handle = nullptr;
+			Ref<void> Asset;						// Keeps the asset alive until the entities that use it exist
+		};
+
+		void Parse();
+		[[nodiscard]] bool ParseChunk(ParsedChunk& chunk) const;
+		void BeginLoading();
+		void RequestAssets();
+		[[nodiscard]] bool IsReady(const ParsedEntity& entity) const;
+		[[nodiscard]] bool IsReady(const std::vector<EntityIndex>& hierarchy) const;
+		void AddEntity(const ParsedChunk& chunk, const ParsedEntity& entity);
+		void AddHierarchy(const std::vector<EntityIndex>& hierarchy);
+		void Complete();
+
+	private:
+		Ref<Scene> m_Scene;
+		std::filesystem::path m_Filepath;
+
+		State m_State = State::Parsing;
+		JobCounter m_ParseCounter;
+
+		// Written by the parse job, read once it is done
+		bool m_IsBinary = false;
+		bool m_ParseFailed = false;
+
+		std::string m_Text;
+		std::vector<ParsedChunk> m_Chunks;
+		std::vector<std::vector<EntityIndex>> m_Waiting;		// Entities not in the scene yet, grouped by hierarchy in file order
+
+		SceneAssetPathMap m_AssetPaths;
+		std::vector<PendingAsset> m_Assets;
+		uint32_t m_EntityCount = 0;
+		uint32_t m_EntitiesLoaded = 0;
+	};
+}
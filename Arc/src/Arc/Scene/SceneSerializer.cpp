@@ -1,8 +1,13 @@
 #include "arcpch.h"
 #include "Arc/Scene/SceneSerializer.h"
 
+#include "Arc/Core/Filesystem.h"
+#include "Arc/Core/MappedFile.h"
+#include "Arc/Scene/BinarySceneSerializer.h"
 #include "Arc/Scene/Entity.h"
 #include "Arc/Scene/Scene.h"
+#include "Arc/Scene/SceneLoader.h"
+#include "Arc/Scene/SceneSnapshot.h"
 #include "EntitySerializer.h"
 
 #include <fstream>
@@ -38,36 +43,40 @@ namespace ArcEngine
 		fout << out.c_str();
 	}
 
-	void SceneSerializer::SerializeRuntime(const std::string&) const
+	void SceneSerializer::SerializeRuntime(const std::string& filepath) const
 	{
-		// Not implemented
+		ARC_PROFILE_SCOPE()
+
+		const std::vector<uint8_t> data = SceneSnapshot::Capture(*m_Scene)->Save();
+		if (!Filesystem::WriteFileBinary(filepath, data.data(), data.size()))
+			ARC_CORE_ERROR("Failed to write scene snapshot '{0}'", filepath);
+	}
+
+	bool SceneSerializer::SerializeBinary(const std::string& filepath) const
+	{
+		return BinarySceneSerializer::Serialize(*m_Scene, filepath);
 	}
 
 	bool SceneSerializer::Deserialize(const std::string& filepath) const
 	{
-		std::ifstream stream(filepath.c_str());
-		std::stringstream strStream;
-		strStream << stream.rdbuf();
+		ARC_PROFILE_SCOPE()
 
-		YAML::Node data = YAML::Load(strStream.str());
-		if (!data["Scene"])
-			return false;
+		SceneLoader loader(m_Scene, filepath);
+		return loader.Finish();
+	}
 
-		auto sceneName = data["Scene"].as<std::string>();
-		ARC_CORE_TRACE("Deserializing scene '{0}'", sceneName);
+	bool SceneSerializer::DeserializeRuntime(const std::string& filepath) const
+	{
+		ARC_PROFILE_SCOPE()
 
-		if (auto entities = data["Entities"])
+		const MappedFile file(filepath);
+		if (!file)
 		{
-			for (const auto& entity : entities)
-				EntitySerializer::DeserializeEntity(entity, *m_Scene, true);
+			ARC_CORE_ERROR("Failed to open scene snapshot '{0}'", filepath);
+			return false;
 		}
 
-		return true;
-	}
-
-	bool SceneSerializer::DeserializeRuntime(const std::string&) const
-	{
-		// Not implemented
-		return false;
+		const Ref<SceneSnapshot> snapshot = SceneSnapshot::Load({ file.GetData(), file.GetSize() });
+		return snapshot && snapshot->Restore(*m_Scene);
 	}
 }
@@ -10,8 +10,12 @@ namespace ArcEngine
 		explicit SceneSerializer(const Ref<Scene>& scene);
 
 		void Serialize(const std::string& filepath) const;
+		// Snapshot of a running scene, DeserializeRuntime restores it into an empty scene and starts it
 		void SerializeRuntime(const std::string& filepath) const;
+		// Same data as Serialize in the binary format, Deserialize reads both
+		bool SerializeBinary(const std::string& filepath) const;
 
+		// Blocks until the scene is loaded, SceneLoader spreads the load over several frames instead
 		[[nodiscard]] bool Deserialize(const std::string& filepath) const;
 		[[nodiscard]] bool DeserializeRuntime(const std::string& filepath) const;
 	private:
@@ -0,0 +1,387 @@
+#include "arcpch.h"
+#include "Arc/Scene/SceneSnapshot.h"
+
+#include "Arc/Audio/AudioSource.h"
+#include "Arc/Physics/Physics3D.h"
+#include "Arc/Scene/BinarySceneSerializer.h"
+#include "Arc/Scene/Components.h"
+#include "Arc/Scene/Entity.h"
+#include "Arc/Scene/Scene.h"
+#include "Arc/Scripting/ScriptEngine.h"
+
+#include <box2d/box2d.h>
+
+// Jolt includes
+#include <Jolt/Jolt.h>
+#include <Jolt/Physics/PhysicsSystem.h>
+#include <Jolt/Physics/Body/Body.h>
+#include <Jolt/Physics/Body/BodyInterface.h>
+
+namespace ArcEngine
+{
+	static constexpr uint32_t s_SnapshotMagic = 'A' | ('S' << 8) | ('N' << 16) | ('P' << 24);
+	static constexpr uint32_t s_SnapshotVersion = 1;
+
+	struct SnapshotHeader
+	{
+		uint32_t Magic = s_SnapshotMagic;
+		uint32_t Version = s_SnapshotVersion;
+		float PhysicsFrameAccumulator = 0.0f;
+		uint32_t BodyCount = 0;
+		uint32_t Body2DCount = 0;
+		uint32_t FieldCount = 0;
+		uint32_t AudioSourceCount = 0;
+		uint32_t StringCount = 0;
+		uint64_t SceneDataSize = 0;
+	};
+
+	// Raw value of a script field, strings are not captured
+	struct FieldBuffer
+	{
+		uint8_t Data[ScriptFieldInstance::MaxSize] = {};
+	};
+
+	template<typename T>
+	static void WriteArray(std::vector<uint8_t>& out, const T* data, size_t count)
+	{
+		const auto* bytes = reinterpret_cast<const uint8_t*>(data);
+		out.insert(out.end(), bytes, bytes + count * sizeof(T));
+	}
+
+	template<typename T>
+	[[nodiscard]] static bool ReadArray(std::span<const uint8_t>& data, T* out, size_t count)
+	{
+		const size_t size = count * sizeof(T);
+		if (data.size() < size)
+			return false;
+
+		if (size > 0)
+			memcpy(out, data.data(), size);
+		data = data.subspan(size);
+		return true;
+	}
+
+	Ref<SceneSnapshot> SceneSnapshot::Capture(Scene& scene)
+	{
+		ARC_PROFILE_SCOPE()
+
+		ARC_CORE_ASSERT(scene.IsRunning(), "Snapshots can only be taken of a running scene")
+
+		Ref<SceneSnapshot> snapshot = CreateRef<SceneSnapshot>();
+		BinarySceneSerializer::Serialize(scene, snapshot->m_SceneData);
+		snapshot->m_PhysicsFrameAccumulator = scene.m_PhysicsFrameAccumulator;
+
+		entt::registry& registry = scene.m_Registry;
+
+		{
+			const auto& bodyInterface = Physics3D::GetPhysicsSystem().GetBodyInterface();
+			const auto view = registry.view<IDComponent, RigidbodyComponent>();
+			snapshot->m_Bodies.reserve(view.size_hint());
+			for (auto &&[e, id, rb] : view.each())
+			{
+				const auto* body = static_cast<const JPH::Body*>(rb.RuntimeBody);
+				if (!body || body->IsStatic())
+					continue;
+
+				const JPH::Vec3 position = body->GetPosition();
+				const JPH::Quat rotation = body->GetRotation();
+				const JPH::Vec3 linearVelocity = body->GetLinearVelocity();
+				const JPH::Vec3 angularVelocity = body->GetAngularVelocity();
+
+				BodyState& state = snapshot->m_Bodies.emplace_back();
+				state.EntityID = id.ID;
+				state.Position = { position.GetX(), position.GetY(), position.GetZ() };
+				state.Orientation = { rotation.GetW(), rotation.GetX(), rotation.GetY(), rotation.GetZ() };
+				state.LinearVelocity = { linearVelocity.GetX(), linearVelocity.GetY(), linearVelocity.GetZ() };
+				state.AngularVelocity = { angularVelocity.GetX(), angularVelocity.GetY(), angularVelocity.GetZ() };
+				state.PreviousTranslation = rb.PreviousTranslation;
+				state.PreviousRotation = rb.PreviousRotation;
+				state.Translation = rb.Translation;
+				state.Rotation = rb.Rotation;
+				state.Active = bodyInterface.IsActive(body->GetID());
+			}
+		}
+
+		{
+			const auto view = registry.view<IDComponent, Rigidbody2DComponent>();
+			snapshot->m_Bodies2D.reserve(view.size_hint());
+			for (auto &&[e, id, rb] : view.each())
+			{
+				const auto* body = static_cast<const b2Body*>(rb.RuntimeBody);
+				if (!body || body->GetType() == b2_staticBody)
+					continue;
+
+				const b2Vec2 position = body->GetPosition();
+				const b2Vec2 linearVelocity = body->GetLinearVelocity();
+
+				Body2DState& state = snapshot->m_Bodies2D.emplace_back();
+				state.EntityID = id.ID;
+				state.Position = { position.x, position.y };
+				state.Angle = body->GetAngle();
+				state.LinearVelocity = { linearVelocity.x, linearVelocity.y };
+				state.AngularVelocity = body->GetAngularVelocity();
+				state.PreviousTranslationRotation = rb.PreviousTranslationRotation;
+				state.TranslationRotation = rb.TranslationRotation;
+				state.Awake = body->IsAwake();
+			}
+		}
+
+		{
+			const auto view = registry.view<IDComponent, ScriptComponent>();
+			for (auto &&[e, id, sc] : view.each())
+			{
+				const Entity entity = { e, &scene };
+				for (const std::string& className : sc.Classes)
+				{
+					if (!ScriptEngine::HasInstance(entity, className))
+						continue;
+
+					const ScriptInstance* instance = ScriptEngine::GetInstance(entity, className);
+					const uint32_t classIndex = snapshot->InternString(className);
+					for (const auto& [name, field] : ScriptEngine::GetFieldMap(className.c_str()))
+					{
+						if (field.Type == FieldType::Unknown || field.Type == FieldType::String)
+							continue;
+
+						FieldState& state = snapshot->m_Fields.emplace_back();
+						state.EntityID = id.ID;
+						state.ClassName = classIndex;
+						state.FieldName = snapshot->InternString(name);
+						state.Type = static_cast<uint32_t>(field.Type);
+
+						const FieldBuffer value = instance->GetFieldValue<FieldBuffer>(name);
+						memcpy(state.Value, value.Data, sizeof(state.Value));
+					}
+				}
+			}
+		}
+
+		{
+			const auto view = registry.view<IDComponent, AudioSourceComponent>();
+			for (auto &&[e, id, ac] : view.each())
+			{
+				if (!ac.Source)
+					continue;
+
+				AudioState& state = snapshot->m_AudioSources.emplace_back();
+				state.EntityID = id.ID;
+				state.Cursor = ac.Source->GetCursor();
+				state.Playing = ac.Source->IsPlaying();
+			}
+		}
+
+		return snapshot;
+	}
+
+	bool SceneSnapshot::Restore(Scene& scene) const
+	{
+		ARC_PROFILE_SCOPE()
+
+		ARC_CORE_ASSERT(!scene.IsRunning(), "Snapshots are restored into a stopped scene")
+
+		if (!BinarySceneSerializer::Deserialize(scene, m_SceneData))
+			return false;
+
+		// Scripts run OnCreate here, the captured field values are written over whatever it set up
+		ScriptEngine::SetScene(&scene);
+		scene.OnRuntimeStart();
+		scene.m_PhysicsFrameAccumulator = m_PhysicsFrameAccumulator;
+
+		auto& bodyInterface = Physics3D::GetPhysicsSystem().GetBodyInterface();
+		for (const BodyState& state : m_Bodies)
+		{
+			const Entity entity = scene.GetEntity(state.EntityID);
+			if (!entity || !entity.HasComponent<RigidbodyComponent>())
+				continue;
+
+			auto& rb = entity.GetComponent<RigidbodyComponent>();
+			const auto* body = static_cast<const JPH::Body*>(rb.RuntimeBody);
+			if (!body)
+				continue;
+
+			const JPH::BodyID bodyID = body->GetID();
+			bodyInterface.SetPositionAndRotation(bodyID,
+				{ state.Position.x, state.Position.y, state.Position.z },
+				{ state.Orientation.x, state.Orientation.y, state.Orientation.z, state.Orientation.w },
+				JPH::EActivation::DontActivate);
+			bodyInterface.SetLinearAndAngularVelocity(bodyID,
+				{ state.LinearVelocity.x, state.LinearVelocity.y, state.LinearVelocity.z },
+				{ state.AngularVelocity.x, state.AngularVelocity.y, state.AngularVelocity.z });
+			if (state.Active)
+				bodyInterface.ActivateBody(bodyID);
+			else
+				bodyInterface.DeactivateBody(bodyID);
+
+			rb.PreviousTranslation = state.PreviousTranslation;
+			rb.PreviousRotation = state.PreviousRotation;
+			rb.Translation = state.Translation;
+			rb.Rotation = state.Rotation;
+		}
+
+		for (const Body2DState& state : m_Bodies2D)
+		{
+			const Entity entity = scene.GetEntity(state.EntityID);
+			if (!entity || !entity.HasComponent<Rigidbody2DComponent>())
+				continue;
+
+			auto& rb = entity.GetComponent<Rigidbody2DComponent>();
+			auto* body = static_cast<b2Body*>(rb.RuntimeBody);
+			if (!body)
+				continue;
+
+			body->SetTransform({ state.Position.x, state.Position.y }, state.Angle);
+			body->SetLinearVelocity({ state.LinearVelocity.x, state.LinearVelocity.y });
+			body->SetAngularVelocity(state.AngularVelocity);
+			body->SetAwake(state.Awake);
+
+			rb.PreviousTranslationRotation = state.PreviousTranslationRotation;
+			rb.TranslationRotation = state.TranslationRotation;
+		}
+
+		for (const FieldState& state : m_Fields)
+		{
+			const Entity entity = scene.GetEntity(state.EntityID);
+			const std::string& className = m_Strings[state.ClassName];
+			if (!entity || !ScriptEngine::HasInstance(entity, className))
+				continue;
+
+			// Snapshots loaded from disk may be older than the scripts
+			const std::string& fieldName = m_Strings[state.FieldName];
+			const auto& fieldMap = ScriptEngine::GetFieldMap(className.c_str());
+			const auto fieldIt = fieldMap.find(fieldName);
+			if (fieldIt == fieldMap.end() || static_cast<uint32_t>(fieldIt->second.Type) != state.Type)
+				continue;
+
+			FieldBuffer value;
+			memcpy(value.Data, state.Value, sizeof(value.Data));
+			ScriptEngine::GetInstance(entity, className)->SetFieldValue(fieldName, value);
+		}
+
+		for (const AudioState& state : m_AudioSources)
+		{
+			const Entity entity = scene.GetEntity(state.EntityID);
+			if (!entity || !entity.HasComponent<AudioSourceComponent>())
+				continue;
+
+			const Ref<AudioSource>& source = entity.GetComponent<AudioSourceComponent>().Source;
+			if (!source)
+				continue;
+
+			if (state.Playing)
+			{
+				if (!source->IsPlaying())
+					source->Play();
+				source->SetCursor(state.Cursor);
+			}
+			else
+			{
+				source->Stop();
+			}
+		}
+
+		return true;
+	}
+
+	std::vector<uint8_t> SceneSnapshot::Save() const
+	{
+		ARC_PROFILE_SCOPE()
+
+		SnapshotHeader header;
+		header.PhysicsFrameAccumulator = m_PhysicsFrameAccumulator;
+		header.BodyCount = static_cast<uint32_t>(m_Bodies.size());
+		header.Body2DCount = static_cast<uint32_t>(m_Bodies2D.size());
+		header.FieldCount = static_cast<uint32_t>(m_Fields.size());
+		header.AudioSourceCount = static_cast<uint32_t>(m_AudioSources.size());
+		header.StringCount = static_cast<uint32_t>(m_Strings.size());
+		header.SceneDataSize = m_SceneData.size();
+
+		std::vector<uint8_t> out;
+		WriteArray(out, &header, 1);
+		WriteArray(out, m_SceneData.data(), m_SceneData.size());
+		WriteArray(out, m_Bodies.data(), m_Bodies.size());
+		WriteArray(out, m_Bodies2D.data(), m_Bodies2D.size());
+		WriteArray(out, m_Fields.data(), m_Fields.size());
+		WriteArray(out, m_AudioSources.data(), m_AudioSources.size());
+		for (const std::string& string : m_Strings)
+		{
+			const auto length = static_cast<uint32_t>(string.size());
+			WriteArray(out, &length, 1);
+			WriteArray(out, string.data(), string.size());
+		}
+		return out;
+	}
+
+	Ref<SceneSnapshot> SceneSnapshot::Load(std::span<const uint8_t> data)
+	{
+		ARC_PROFILE_SCOPE()
+
+		SnapshotHeader header;
+		if (!ReadArray(data, &header, 1) || header.Magic != s_SnapshotMagic)
+		{
+			ARC_CORE_ERROR("Data is not a scene snapshot");
+			return nullptr;
+		}
+
+		if (header.Version != s_SnapshotVersion)
+		{
+			ARC_CORE_ERROR("Unsupported scene snapshot version {0}", header.Version);
+			return nullptr;
+		}
+
+		Ref<SceneSnapshot> snapshot = CreateRef<SceneSnapshot>();
+		snapshot->m_PhysicsFrameAccumulator = header.PhysicsFrameAccumulator;
+
+		// Checked up front so a corrupt count cannot make the vectors below huge
+		const uint64_t fixedSize = header.SceneDataSize
+			+ static_cast<uint64_t>(header.BodyCount) * sizeof(BodyState)
+			+ static_cast<uint64_t>(header.Body2DCount) * sizeof(Body2DState)
+			+ static_cast<uint64_t>(header.FieldCount) * sizeof(FieldState)
+			+ static_cast<uint64_t>(header.AudioSourceCount) * sizeof(AudioState);
+		bool valid = header.SceneDataSize <= data.size() && fixedSize <= data.size();
+		if (valid)
+		{
+			snapshot->m_SceneData.resize(header.SceneDataSize);
+			snapshot->m_Bodies.resize(header.BodyCount);
+			snapshot->m_Bodies2D.resize(header.Body2DCount);
+			snapshot->m_Fields.resize(header.FieldCount);
+			snapshot->m_AudioSources.resize(header.AudioSourceCount);
+
+			valid = ReadArray(data, snapshot->m_SceneData.data(), snapshot->m_SceneData.size())
+				&& ReadArray(data, snapshot->m_Bodies.data(), snapshot->m_Bodies.size())
+				&& ReadArray(data, snapshot->m_Bodies2D.data(), snapshot->m_Bodies2D.size())
+				&& ReadArray(data, snapshot->m_Fields.data(), snapshot->m_Fields.size())
+				&& ReadArray(data, snapshot->m_AudioSources.data(), snapshot->m_AudioSources.size());
+		}
+
+		for (uint32_t i = 0; valid && i < header.StringCount; ++i)
+		{
+			uint32_t length = 0;
+			valid = ReadArray(data, &length, 1) && length <= data.size();
+			if (valid)
+			{
+				std::string& string = snapshot->m_Strings.emplace_back(reinterpret_cast<const char*>(data.data()), length);
+				snapshot->m_StringIndices.emplace(string, i);
+				data = data.subspan(length);
+			}
+		}
+
+		for (const FieldState& field : snapshot->m_Fields)
+			valid = valid && field.ClassName < header.StringCount && field.FieldName < header.StringCount;
+
+		if (!valid)
+		{
+			ARC_CORE_ERROR("Scene snapshot is truncated or corrupt");
+			return nullptr;
+		}
+
+		return snapshot;
+	}
+
+	uint32_t SceneSnapshot::InternString(const std::string& string)
+	{
+		const auto [it, inserted] = m_StringIndices.try_emplace(string, static_cast<uint32_t>(m_Strings.size()));
+		if (inserted)
+			m_Strings.push_back(string);
+		return it->second;
+	}
+}
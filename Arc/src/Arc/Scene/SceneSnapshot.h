@@ -0,0 +1,85 @@
+#pragma once
+
+#include <span>
+
+#include "Arc/Core/UUID.h"
+#include "Arc/Scripting/ScriptEngine.h"
+
+namespace ArcEngine
+{
+	class Scene;
+
+	// State of a running scene at one point in time.
+	// The registry is kept in the binary scene format, on top of it come the parts that only exist while
+	// the scene runs: physics bodies, script field values and audio playback positions.
+	class SceneSnapshot
+	{
+	public:
+		[[nodiscard]] static Ref<SceneSnapshot> Capture(Scene& scene);
+
+		// Loads the snapshot into an empty scene and starts it. Physics and script instances are global and
+		// keyed by UUID, so the scene it was captured from has to be stopped first.
+		[[nodiscard]] bool Restore(Scene& scene) const;
+
+		[[nodiscard]] std::vector<uint8_t> Save() const;
+		[[nodiscard]] static Ref<SceneSnapshot> Load(std::span<const uint8_t> data);
+
+	private:
+		struct BodyState
+		{
+			UUID EntityID = 0;
+			glm::vec3 Position = glm::vec3(0.0f);
+			glm::quat Orientation = glm::quat(1.0f, 0.0f, 0.0f, 0.0f);
+			glm::vec3 LinearVelocity = glm::vec3(0.0f);
+			glm::vec3 AngularVelocity = glm::vec3(0.0f);
+
+			// Interpolation state of the RigidbodyComponent
+			glm::vec3 PreviousTranslation = glm::vec3(0.0f);
+			glm::quat PreviousRotation = glm::quat(1.0f, 0.0f, 0.0f, 0.0f);
+			glm::vec3 Translation = glm::vec3(0.0f);
+			glm::quat Rotation = glm::quat(1.0f, 0.0f, 0.0f, 0.0f);
+			uint32_t Active = 0;
+		};
+
+		struct Body2DState
+		{
+			UUID EntityID = 0;
+			glm::vec2 Position = glm::vec2(0.0f);
+			float Angle = 0.0f;
+			glm::vec2 LinearVelocity = glm::vec2(0.0f);
+			float AngularVelocity = 0.0f;
+			glm::vec3 PreviousTranslationRotation = glm::vec3(0.0f);
+			glm::vec3 TranslationRotation = glm::vec3(0.0f);
+			uint32_t Awake = 0;
+		};
+
+		struct FieldState
+		{
+			UUID EntityID = 0;
+			uint32_t ClassName = 0;			// Into m_Strings
+			uint32_t FieldName = 0;			// Into m_Strings
+			uint32_t Type = 0;
+			uint8_t Value[ScriptFieldInstance::MaxSize] = {};
+		};
+
+		struct AudioState
+		{
+			UUID EntityID = 0;
+			uint64_t Cursor = 0;
+			uint32_t Playing = 0;
+		};
+
+		[[nodiscard]] uint32_t InternString(const std::string& string);
+
+	private:
+		std::vector<uint8_t> m_SceneData;
+		float m_PhysicsFrameAccumulator = 0.0f;
+
+		std::vector<BodyState> m_Bodies;
+		std::vector<Body2DState> m_Bodies2D;
+		std::vector<FieldState> m_Fields;
+		std::vector<AudioState> m_AudioSources;
+		std::vector<std::string> m_Strings;
+		std::unordered_map<std::string, uint32_t> m_StringIndices;
+	};
+}
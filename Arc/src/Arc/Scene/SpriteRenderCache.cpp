@@ -0,0 +1,377 @@
+#include "arcpch.h"
+#include "Arc/Scene/SpriteRenderCache.h"
+
+#include "Arc/Renderer/SpriteAtlas.h"
+#include "Arc/Renderer/Texture.h"
+#include "Arc/Scene/Components.h"
+#include "Arc/Scene/Scene.h"
+#include "Arc/Scene/TransformCache.h"
+
+namespace ArcEngine
+{
+	static constexpr glm::vec4 s_FullUVRect = { 0.0f, 0.0f, 1.0f, 1.0f };
+	static const AABB s_QuadBounds = { { -0.5f, -0.5f, 0.0f }, { 0.5f, 0.5f, 0.0f } };
+
+	SpriteRenderCache::SpriteRenderCache(entt::registry& registry, TransformCache& transformCache)
+		: m_Registry(registry), m_TransformCache(transformCache)
+	{
+		m_Registry.on_construct<SpriteRendererComponent>().connect<&SpriteRenderCache::OnSpriteChanged>(*this);
+		m_Registry.on_update<SpriteRendererComponent>().connect<&SpriteRenderCache::OnSpriteChanged>(*this);
+		m_Registry.on_destroy<SpriteRendererComponent>().connect<&SpriteRenderCache::OnSpriteDestroyed>(*this);
+		m_Registry.on_update<TagComponent>().connect<&SpriteRenderCache::OnTagChanged>(*this);
+	}
+
+	SpriteRenderCache::~SpriteRenderCache()
+	{
+		m_Registry.on_construct<SpriteRendererComponent>().disconnect(this);
+		m_Registry.on_update<SpriteRendererComponent>().disconnect(this);
+		m_Registry.on_destroy<SpriteRendererComponent>().disconnect(this);
+		m_Registry.on_update<TagComponent>().disconnect(this);
+	}
+
+	void SpriteRenderCache::Clear()
+	{
+		ARC_PROFILE_SCOPE()
+
+		m_SpriteTree.Clear();
+		m_ChunkTree.Clear();
+		m_Records.clear();
+		m_Chunks.clear();
+		m_FreeChunks.clear();
+		m_ChunkMap.clear();
+		m_DrawList.clear();
+		m_Changed.clear();
+
+		for (const entt::entity entity : m_Registry.view<SpriteRendererComponent>())
+			OnSpriteChanged(m_Registry, entity);
+	}
+
+	void SpriteRenderCache::SetAtlas(const Ref<SpriteAtlas>& atlas)
+	{
+		ARC_PROFILE_SCOPE()
+
+		m_Atlas = atlas;
+		m_AtlasedTextures.clear();
+		for (Chunk& chunk : m_Chunks)
+			chunk.Dirty = !chunk.Sprites.empty();
+	}
+
+	void SpriteRenderCache::Update()
+	{
+		ARC_PROFILE_SCOPE()
+
+		// Moved sprites, the transform cache lists every entity, most of them are not sprites
+		m_TransformCache.TakeChangedEntities(m_TransformChanges);
+		for (const entt::entity entity : m_TransformChanges)
+		{
+			const size_t index = entt::to_entity(entity);
+			if (index < m_Records.size() && m_Records[index].Handle == entity)
+				Queue(entity);
+		}
+
+		for (const entt::entity entity : m_Changed)
+		{
+			const size_t index = entt::to_entity(entity);
+			if (m_Records[index].Handle != entity)
+				continue;
+
+			m_Records[index].Queued = false;
+			UpdateRecord(entity);
+		}
+		m_Changed.clear();
+
+		for (Chunk& chunk : m_Chunks)
+		{
+			if (chunk.Dirty)
+				RebuildChunk(chunk);
+		}
+	}
+
+	void SpriteRenderCache::Submit(const Frustum& frustum)
+	{
+		ARC_PROFILE_SCOPE()
+
+		m_DrawList.clear();
+		m_ChunkTree.Query(frustum, [this](uint32_t index)
+		{
+			m_DrawList.push_back({ std::get<2>(m_Chunks[index].Key), index, true });
+		});
+		m_SpriteTree.Query(frustum, [this](uint32_t index)
+		{
+			m_DrawList.push_back({ m_Records[index].SortingOrder, index, false });
+		});
+
+		// The order of the tree does not depend on the scene, the tie breaks keep it from changing between frames
+		std::ranges::sort(m_DrawList, [](const DrawItem& lhs, const DrawItem& rhs)
+		{
+			if (lhs.SortingOrder != rhs.SortingOrder)
+				return lhs.SortingOrder < rhs.SortingOrder;
+			if (lhs.IsChunk != rhs.IsChunk)
+				return lhs.IsChunk;
+			return lhs.Index < rhs.Index;
+		});
+
+		for (const DrawItem& item : m_DrawList)
+		{
+			if (item.IsChunk)
+			{
+				const Chunk& chunk = m_Chunks[item.Index];
+				for (const TextureRun& run : chunk.Runs)
+					Renderer2D::DrawQuads({ chunk.Vertices.data() + run.FirstVertex, run.VertexCount }, run.Texture);
+				continue;
+			}
+
+			const entt::entity entity = m_Records[item.Index].Handle;
+			const auto& sprite = m_Registry.get<SpriteRendererComponent>(entity);
+			const glm::mat4& transform = m_TransformCache.GetWorldTransform(entity);
+			const auto [texture, uvRect] = ResolveTexture(sprite);
+			if (texture != &sprite.Texture)
+				Renderer2D::DrawQuad(transform, *texture, uvRect, sprite.Color);
+			else
+				Renderer2D::DrawQuad(transform, sprite.Texture, sprite.Color, sprite.TilingFactor);
+		}
+	}
+
+	void SpriteRenderCache::OnSpriteChanged([[maybe_unused]] entt::registry& registry, entt::entity entity)
+	{
+		const size_t index = entt::to_entity(entity);
+		if (index >= m_Records.size())
+			m_Records.resize(index + 1);
+
+		Record& record = m_Records[index];
+		if (record.Handle != entity)
+		{
+			RemoveFromChunk(record);
+			DestroyProxy(record);
+			record = Record();
+			record.Handle = entity;
+		}
+		Queue(entity);
+	}
+
+	void SpriteRenderCache::OnSpriteDestroyed([[maybe_unused]] entt::registry& registry, entt::entity entity)
+	{
+		const size_t index = entt::to_entity(entity);
+		if (index >= m_Records.size() || m_Records[index].Handle != entity)
+			return;
+
+		Record& record = m_Records[index];
+		RemoveFromChunk(record);
+		DestroyProxy(record);
+		record = Record();
+	}
+
+	void SpriteRenderCache::OnTagChanged([[maybe_unused]] entt::registry& registry, entt::entity entity)
+	{
+		// The layer decides between a chunk and a proxy
+		const size_t index = entt::to_entity(entity);
+		if (index < m_Records.size() && m_Records[index].Handle == entity)
+			Queue(entity);
+	}
+
+	void SpriteRenderCache::Queue(entt::entity entity)
+	{
+		Record& record = m_Records[entt::to_entity(entity)];
+		if (record.Queued)
+			return;
+
+		record.Queued = true;
+		m_Changed.push_back(entity);
+	}
+
+	void SpriteRenderCache::UpdateRecord(entt::entity entity)
+	{
+		const auto* tag = m_Registry.try_get<TagComponent>(entity);
+		if (!tag)
+			return;
+
+		const auto& sprite = m_Registry.get<SpriteRendererComponent>(entity);
+		const size_t index = entt::to_entity(entity);
+		Record& record = m_Records[index];
+
+		const uint64_t transformVersion = m_TransformCache.GetVersion(entity);
+		const bool isStatic = tag->Layer == Scene::StaticLayer;
+		const bool placed = isStatic ? record.Chunk != InvalidIndex : record.Proxy != DynamicAABBTree::NullNode;
+		if (placed && record.Static == isStatic && record.TransformVersion == transformVersion && record.Texture == sprite.Texture
+			&& record.Color == sprite.Color && record.TilingFactor == sprite.TilingFactor && record.SortingOrder == sprite.SortingOrder)
+		{
+			return;
+		}
+
+		// The atlas entry of the old texture is looked up again by whoever still uses it
+		if (record.Texture && record.Texture != sprite.Texture)
+			m_AtlasedTextures.erase(record.Texture->GetPath());
+
+		const glm::mat4& transform = m_TransformCache.GetWorldTransform(entity);
+		if (isStatic)
+		{
+			DestroyProxy(record);
+
+			// Sprites belong to the cell their center is in, the chunk bounds grow to fit whatever sticks out
+			const ChunkKey key = {
+				static_cast<int32_t>(glm::floor(transform[3].x / ChunkSize)),
+				static_cast<int32_t>(glm::floor(transform[3].y / ChunkSize)),
+				sprite.SortingOrder
+			};
+			if (record.Chunk != InvalidIndex && m_Chunks[record.Chunk].Key == key)
+			{
+				m_Chunks[record.Chunk].Dirty = true;
+			}
+			else
+			{
+				RemoveFromChunk(record);
+				AddToChunk(record, key);
+			}
+		}
+		else
+		{
+			RemoveFromChunk(record);
+
+			const AABB bounds = s_QuadBounds.Transform(transform);
+			if (record.Proxy == DynamicAABBTree::NullNode)
+				record.Proxy = m_SpriteTree.CreateProxy(bounds, static_cast<uint32_t>(index));
+			else
+				m_SpriteTree.MoveProxy(record.Proxy, bounds);
+		}
+
+		// Recomputing the transform above may have bumped the version
+		record.TransformVersion = m_TransformCache.GetVersion(entity);
+		record.Texture = sprite.Texture;
+		record.Color = sprite.Color;
+		record.TilingFactor = sprite.TilingFactor;
+		record.SortingOrder = sprite.SortingOrder;
+		record.Static = isStatic;
+	}
+
+	std::pair<const Ref<Texture2D>*, glm::vec4> SpriteRenderCache::ResolveTexture(const SpriteRendererComponent& sprite)
+	{
+		// Tiled sprites wrap around their texture, which only works with a texture of their own
+		if (!m_Atlas || !sprite.Texture || sprite.TilingFactor != 1.0f)
+			return { &sprite.Texture, s_FullUVRect };
+
+		// Textures that are still loading have no path yet, they are looked up again once they do
+		const std::string& path = sprite.Texture->GetPath();
+		if (path.empty())
+			return { &sprite.Texture, s_FullUVRect };
+
+		auto it = m_AtlasedTextures.find(path);
+		if (it == m_AtlasedTextures.end())
+		{
+			const SpriteAtlas::Region* region = m_Atlas->GetRegion(path);
+			it = m_AtlasedTextures.emplace(path, region
+				? std::make_pair(m_Atlas->GetPage(region->Page), region->UVRect)
+				: std::make_pair(Ref<Texture2D>(nullptr), s_FullUVRect)).first;
+		}
+
+		if (!it->second.first)
+			return { &sprite.Texture, s_FullUVRect };
+		return { &it->second.first, it->second.second };
+	}
+
+	void SpriteRenderCache::AddToChunk(Record& record, const ChunkKey& key)
+	{
+		auto [it, inserted] = m_ChunkMap.try_emplace(key, InvalidIndex);
+		if (inserted)
+		{
+			if (m_FreeChunks.empty())
+			{
+				it->second = static_cast<uint32_t>(m_Chunks.size());
+				m_Chunks.emplace_back();
+			}
+			else
+			{
+				it->second = m_FreeChunks.back();
+				m_FreeChunks.pop_back();
+			}
+			m_Chunks[it->second].Key = key;
+		}
+
+		Chunk& chunk = m_Chunks[it->second];
+		chunk.Sprites.push_back(record.Handle);
+		chunk.Dirty = true;
+		record.Chunk = it->second;
+	}
+
+	void SpriteRenderCache::RemoveFromChunk(Record& record)
+	{
+		if (record.Chunk == InvalidIndex)
+			return;
+
+		Chunk& chunk = m_Chunks[record.Chunk];
+		const auto it = std::ranges::find(chunk.Sprites, record.Handle);
+		if (it != chunk.Sprites.end())
+		{
+			*it = chunk.Sprites.back();
+			chunk.Sprites.pop_back();
+		}
+		chunk.Dirty = true;
+		record.Chunk = InvalidIndex;
+	}
+
+	void SpriteRenderCache::RebuildChunk(Chunk& chunk)
+	{
+		ARC_PROFILE_SCOPE()
+
+		chunk.Dirty = false;
+		chunk.Vertices.clear();
+		chunk.Runs.clear();
+
+		if (chunk.Sprites.empty())
+		{
+			if (chunk.Proxy != DynamicAABBTree::NullNode)
+				m_ChunkTree.DestroyProxy(chunk.Proxy);
+			chunk.Proxy = DynamicAABBTree::NullNode;
+
+			const auto it = m_ChunkMap.find(chunk.Key);
+			m_FreeChunks.push_back(it->second);
+			m_ChunkMap.erase(it);
+			return;
+		}
+
+		// Sprites of a chunk share a sorting order, so they can be drawn in any order. Grouping them by
+		// texture keeps the number of draw calls down.
+		m_BuildSprites.clear();
+		for (const entt::entity entity : chunk.Sprites)
+		{
+			const auto& sprite = m_Registry.get<SpriteRendererComponent>(entity);
+			const auto [texture, uvRect] = ResolveTexture(sprite);
+			m_BuildSprites.push_back({ texture, uvRect, entity });
+		}
+		std::ranges::sort(m_BuildSprites, [](const BuildSprite& lhs, const BuildSprite& rhs)
+		{
+			return lhs.Texture->get() != rhs.Texture->get() ? lhs.Texture->get() < rhs.Texture->get() : lhs.Handle < rhs.Handle;
+		});
+
+		chunk.Vertices.resize(m_BuildSprites.size() * 4);
+		AABB bounds(glm::vec3(std::numeric_limits<float>::max()), glm::vec3(std::numeric_limits<float>::lowest()));
+		for (size_t i = 0; i < m_BuildSprites.size(); ++i)
+		{
+			const BuildSprite& buildSprite = m_BuildSprites[i];
+			const auto& sprite = m_Registry.get<SpriteRendererComponent>(buildSprite.Handle);
+			const float tilingFactor = buildSprite.Texture != &sprite.Texture ? 1.0f : sprite.TilingFactor;
+
+			const std::span<Renderer2D::QuadVertex, 4> vertices(chunk.Vertices.data() + i * 4, 4);
+			Renderer2D::BuildQuad(m_TransformCache.GetWorldTransform(buildSprite.Handle), buildSprite.UVRect, sprite.Color, tilingFactor, vertices);
+			for (const Renderer2D::QuadVertex& vertex : vertices)
+				bounds.Expand(vertex.Position);
+
+			if (chunk.Runs.empty() || chunk.Runs.back().Texture.get() != buildSprite.Texture->get())
+				chunk.Runs.push_back({ *buildSprite.Texture, static_cast<uint32_t>(i * 4), 0 });
+			chunk.Runs.back().VertexCount += 4;
+		}
+
+		if (chunk.Proxy == DynamicAABBTree::NullNode)
+			chunk.Proxy = m_ChunkTree.CreateProxy(bounds, static_cast<uint32_t>(&chunk - m_Chunks.data()));
+		else
+			m_ChunkTree.MoveProxy(chunk.Proxy, bounds);
+	}
+
+	void SpriteRenderCache::DestroyProxy(Record& record)
+	{
+		if (record.Proxy == DynamicAABBTree::NullNode)
+			return;
+
+		m_SpriteTree.DestroyProxy(record.Proxy);
+		record.Proxy = DynamicAABBTree::NullNode;
+	}
+}
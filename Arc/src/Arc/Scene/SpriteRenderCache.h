@@ -0,0 +1,130 @@
+#pragma once
+
+#include <entt.hpp>
+
+#include "Arc/Renderer/Renderer2D.h"
+#include "Arc/Utils/DynamicAABBTree.h"
+
+namespace ArcEngine
+{
+	class TransformCache;
+	class Texture2D;
+	class SpriteAtlas;
+	struct SpriteRendererComponent;
+
+	// Culls and draws every SpriteRendererComponent of a scene.
+	// Sprites on the static layer are grouped into chunks by grid cell and sorting order. A chunk keeps the
+	// transformed vertices of its sprites and is rebuilt only when one of them changes, so drawing it is a copy.
+	// Other sprites get their own proxy. Chunks and proxies live in dynamic BVHs, so only the part of
+	// the scene that is near the camera is touched when drawing.
+	// Only sprites that changed are looked at on Update: added and removed ones through registry signals,
+	// moved ones through the transform cache. Edits in place have to be reported with Entity::PatchComponent,
+	// either on the SpriteRendererComponent or, for the layer, on the TagComponent.
+	class SpriteRenderCache
+	{
+	public:
+		// World units covered by one chunk along x and y
+		static constexpr float ChunkSize = 32.0f;
+
+		SpriteRenderCache(entt::registry& registry, TransformCache& transformCache);
+		~SpriteRenderCache();
+
+		SpriteRenderCache(const SpriteRenderCache& other) = delete;
+		SpriteRenderCache(SpriteRenderCache&& other) = delete;
+
+		// Drops everything and picks up every sprite again on the next Update
+		void Clear();
+		// Sprites with a texture in the atlas are drawn from its pages, rebuilds every chunk
+		void SetAtlas(const Ref<SpriteAtlas>& atlas);
+		void Update();
+
+		// Draws the sprites inside the frustum through Renderer2D, in sorting order
+		void Submit(const Frustum& frustum);
+
+		[[nodiscard]] size_t GetChunkCount() const { return m_ChunkTree.GetProxyCount(); }
+
+	private:
+		static constexpr uint32_t InvalidIndex = std::numeric_limits<uint32_t>::max();
+
+		// Cell x, cell y, sorting order
+		using ChunkKey = std::tuple<int32_t, int32_t, int>;
+
+		struct Record
+		{
+			entt::entity Handle = entt::null;
+			uint64_t TransformVersion = 0;
+			Ref<Texture2D> Texture = nullptr;			// Held, so a new texture can never reuse its address
+			glm::vec4 Color = glm::vec4(0.0f);
+			float TilingFactor = 0.0f;
+			int SortingOrder = 0;
+			bool Static = false;
+
+			int32_t Proxy = DynamicAABBTree::NullNode;		// Dynamic sprites
+			uint32_t Chunk = InvalidIndex;					// Static sprites
+			bool Queued = false;							// In m_Changed
+		};
+
+		struct TextureRun
+		{
+			Ref<Texture2D> Texture;
+			uint32_t FirstVertex = 0;
+			uint32_t VertexCount = 0;
+		};
+
+		struct Chunk
+		{
+			ChunkKey Key = {};
+			std::vector<entt::entity> Sprites;
+			std::vector<Renderer2D::QuadVertex> Vertices;		// Grouped by texture
+			std::vector<TextureRun> Runs;
+			int32_t Proxy = DynamicAABBTree::NullNode;
+			bool Dirty = false;
+		};
+
+		struct DrawItem
+		{
+			int SortingOrder;
+			uint32_t Index;			// Into m_Chunks or m_Records
+			bool IsChunk;
+		};
+
+		struct BuildSprite
+		{
+			const Ref<Texture2D>* Texture;
+			glm::vec4 UVRect;
+			entt::entity Handle;
+		};
+
+		void OnSpriteChanged(entt::registry& registry, entt::entity entity);
+		void OnSpriteDestroyed(entt::registry& registry, entt::entity entity);
+		void OnTagChanged(entt::registry& registry, entt::entity entity);
+		void Queue(entt::entity entity);
+		void UpdateRecord(entt::entity entity);
+
+		// Texture and UV rect the sprite is drawn with, an atlas page if its texture was packed
+		[[nodiscard]] std::pair<const Ref<Texture2D>*, glm::vec4> ResolveTexture(const SpriteRendererComponent& sprite);
+
+		void AddToChunk(Record& record, const ChunkKey& key);
+		void RemoveFromChunk(Record& record);
+		void RebuildChunk(Chunk& chunk);
+		void DestroyProxy(Record& record);
+
+	private:
+		entt::registry& m_Registry;
+		TransformCache& m_TransformCache;
+
+		DynamicAABBTree m_SpriteTree;
+		DynamicAABBTree m_ChunkTree{ 0.0f };
+		std::vector<Record> m_Records;
+		std::vector<Chunk> m_Chunks;
+		std::vector<uint32_t> m_FreeChunks;
+		std::map<ChunkKey, uint32_t> m_ChunkMap;
+		std::vector<DrawItem> m_DrawList;
+		std::vector<BuildSprite> m_BuildSprites;
+		std::vector<entt::entity> m_Changed;
+		std::vector<entt::entity> m_TransformChanges;
+
+		Ref<SpriteAtlas> m_Atlas = nullptr;
+		std::unordered_map<std::string, std::pair<Ref<Texture2D>, glm::vec4>> m_AtlasedTextures;		// By texture path
+	};
+}
@@ -0,0 +1,226 @@
+#include "arcpch.h"
+#include "Arc/Scene/TransformCache.h"
+
+#include <glm/gtc/matrix_transform.hpp>
+
+#include "Arc/Scene/Components.h"
+
+namespace ArcEngine
+{
+	static const glm::mat4 s_IdentityTransform = glm::mat4(1.0f);
+
+	void TransformCache::Clear()
+	{
+		ARC_PROFILE_SCOPE()
+
+		m_Nodes.clear();
+		m_Order.clear();
+		m_Chain.clear();
+		m_Changed.clear();
+		m_HierarchyDirty = true;
+	}
+
+	void TransformCache::Update()
+	{
+		ARC_PROFILE_SCOPE()
+
+		if (m_HierarchyDirty)
+			RebuildHierarchy();
+
+		bool rebuilt = false;
+		for (size_t i = 0; i < m_Order.size(); ++i)
+		{
+			const entt::entity entity = m_Order[i];
+			if (!IsHierarchyValid(entity))
+			{
+				if (rebuilt)
+					continue;
+
+				// Relationship was edited without going through Entity, reorder and start over
+				RebuildHierarchy();
+				rebuilt = true;
+				i = static_cast<size_t>(-1);
+				continue;
+			}
+
+			Resolve(entity);
+		}
+	}
+
+	const glm::mat4& TransformCache::GetWorldTransform(entt::entity entity)
+	{
+		ARC_PROFILE_SCOPE()
+
+		if (m_HierarchyDirty || !IsHierarchyValid(entity))
+		{
+			RebuildHierarchy();
+			if (!IsHierarchyValid(entity))
+				return s_IdentityTransform;
+		}
+
+		// Collect the ancestors, validating them on the way up
+		m_Chain.clear();
+		for (entt::entity current = entity; current != entt::null; current = m_Nodes[entt::to_entity(current)].Parent)
+		{
+			if (!IsHierarchyValid(current))
+			{
+				RebuildHierarchy();
+				return GetWorldTransform(entity);
+			}
+
+			m_Chain.push_back(current);
+		}
+
+		// Resolve from the root down, only the nodes that are out of date get recomputed
+		for (auto it = m_Chain.rbegin(); it != m_Chain.rend(); ++it)
+			Resolve(*it);
+
+		return m_Nodes[entt::to_entity(entity)].World;
+	}
+
+	void TransformCache::TakeChangedEntities(std::vector<entt::entity>& outEntities)
+	{
+		ARC_PROFILE_SCOPE()
+
+		for (const entt::entity entity : m_Changed)
+		{
+			const size_t index = entt::to_entity(entity);
+			if (index < m_Nodes.size() && m_Nodes[index].Handle == entity)
+				m_Nodes[index].Changed = false;
+		}
+
+		outEntities.clear();
+		std::swap(outEntities, m_Changed);
+	}
+
+	void TransformCache::RebuildHierarchy()
+	{
+		ARC_PROFILE_SCOPE()
+
+		m_HierarchyDirty = false;
+		m_Order.clear();
+
+		const auto view = m_Registry.view<RelationshipComponent, TransformComponent>();
+
+		size_t maxIndex = 0;
+		for (const entt::entity entity : view)
+			maxIndex = glm::max(maxIndex, static_cast<size_t>(entt::to_entity(entity)));
+		if (m_Nodes.size() <= maxIndex)
+			m_Nodes.resize(maxIndex + 1);
+
+		// Link every node to its parent
+		for (auto&& [entity, rc, tc] : view.each())
+		{
+			Node& node = m_Nodes[entt::to_entity(entity)];
+			if (node.Handle != entity)
+			{
+				node = Node();
+				node.Handle = entity;
+			}
+
+			entt::entity parent = entt::null;
+			if (rc.Parent != 0)
+			{
+				const auto it = m_EntityMap.find(rc.Parent);
+				if (it != m_EntityMap.end() && it->second != entity && view.contains(it->second))
+					parent = it->second;
+			}
+
+			if (node.Parent != parent)
+				node.Dirty = true;
+			node.Parent = parent;
+			node.ParentID = rc.Parent;
+			node.Depth = Node::UnknownDepth;
+		}
+
+		// Depth of every node, walking up until a node with a known depth is hit
+		uint32_t maxDepth = 0;
+		for (const entt::entity entity : view)
+		{
+			m_Chain.clear();
+			entt::entity current = entity;
+			uint32_t depth = 0;
+			while (current != entt::null)
+			{
+				const Node& node = m_Nodes[entt::to_entity(current)];
+				if (node.Depth != Node::UnknownDepth)
+				{
+					depth = node.Depth + 1;
+					break;
+				}
+
+				// Guard against cycles in malformed scenes
+				if (m_Chain.size() > m_Nodes.size())
+				{
+					ARC_CORE_ERROR("Cycle detected in the entity hierarchy");
+					m_Nodes[entt::to_entity(current)].Parent = entt::null;
+					break;
+				}
+
+				m_Chain.push_back(current);
+				current = node.Parent;
+			}
+
+			for (auto it = m_Chain.rbegin(); it != m_Chain.rend(); ++it)
+			{
+				m_Nodes[entt::to_entity(*it)].Depth = depth;
+				maxDepth = glm::max(maxDepth, depth);
+				++depth;
+			}
+		}
+
+		// Counting sort by depth gives a parent-before-child order
+		std::vector<uint32_t> depthOffsets(static_cast<size_t>(maxDepth) + 2, 0);
+		for (const entt::entity entity : view)
+			++depthOffsets[m_Nodes[entt::to_entity(entity)].Depth + 1];
+		for (size_t i = 1; i < depthOffsets.size(); ++i)
+			depthOffsets[i] += depthOffsets[i - 1];
+
+		m_Order.resize(depthOffsets.back());
+		for (const entt::entity entity : view)
+			m_Order[depthOffsets[m_Nodes[entt::to_entity(entity)].Depth]++] = entity;
+
+		m_Chain.clear();
+	}
+
+	bool TransformCache::IsHierarchyValid(entt::entity entity) const
+	{
+		const size_t index = entt::to_entity(entity);
+		if (index >= m_Nodes.size() || !m_Registry.valid(entity))
+			return false;
+
+		const Node& node = m_Nodes[index];
+		return node.Handle == entity && m_Registry.get<RelationshipComponent>(entity).Parent == node.ParentID;
+	}
+
+	void TransformCache::Resolve(entt::entity entity)
+	{
+		Node& node = m_Nodes[entt::to_entity(entity)];
+		const auto& tc = m_Registry.get<TransformComponent>(entity);
+
+		if (node.Dirty || node.Translation != tc.Translation || node.Rotation != tc.Rotation || node.Scale != tc.Scale)
+		{
+			node.Translation = tc.Translation;
+			node.Rotation = tc.Rotation;
+			node.Scale = tc.Scale;
+			node.Local = glm::translate(glm::mat4(1.0f), tc.Translation) * glm::toMat4(glm::quat(tc.Rotation)) * glm::scale(glm::mat4(1.0f), tc.Scale);
+			node.Dirty = true;
+		}
+
+		const Node* parent = node.Parent != entt::null ? &m_Nodes[entt::to_entity(node.Parent)] : nullptr;
+		const uint64_t parentVersion = parent ? parent->Version : 0;
+		if (!node.Dirty && parentVersion == node.ParentVersion)
+			return;
+
+		node.World = parent ? parent->World * node.Local : node.Local;
+		node.ParentVersion = parentVersion;
+		node.Version = ++m_VersionCounter;
+		node.Dirty = false;
+
+		if (!node.Changed)
+		{
+			node.Changed = true;
+			m_Changed.push_back(entity);
+		}
+	}
+}
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <entt.hpp>
+
+#include "Arc/Core/UUID.h"
+
+namespace ArcEngine
+{
+	// Caches the world transform of every entity in a scene.
+	// Local edits are picked up by comparing each TransformComponent against the values
+	// its cached matrix was built from, and invalidation flows down the hierarchy through
+	// per-node versions, so only the changed subtrees are recomputed.
+	class TransformCache
+	{
+	public:
+		TransformCache(entt::registry& registry, const std::unordered_map<UUID, entt::entity>& entityMap)
+			: m_Registry(registry), m_EntityMap(entityMap)
+		{
+		}
+
+		// Marks the parent/child ordering as stale, it is rebuilt on the next access
+		void InvalidateHierarchy() { m_HierarchyDirty = true; }
+		void Clear();
+
+		// Single topologically ordered pass, parents are always resolved before their children
+		void Update();
+
+		[[nodiscard]] const glm::mat4& GetWorldTransform(entt::entity entity);
+
+		// Moves out the entities whose world transform was recomputed since the last call, each listed once.
+		// Meant for a single consumer, entities may have been destroyed since.
+		void TakeChangedEntities(std::vector<entt::entity>& outEntities);
+
+		// Changes every time the world transform of the entity is recomputed, zero if it never was
+		[[nodiscard]] uint64_t GetVersion(entt::entity entity) const
+		{
+			const size_t index = entt::to_entity(entity);
+			return index < m_Nodes.size() && m_Nodes[index].Handle == entity ? m_Nodes[index].Version : 0;
+		}
+
+	private:
+		struct Node
+		{
+			entt::entity Handle = entt::null;
+			entt::entity Parent = entt::null;
+			UUID ParentID = 0;
+
+			glm::vec3 Translation = glm::vec3(0.0f);
+			glm::vec3 Rotation = glm::vec3(0.0f);
+			glm::vec3 Scale = glm::vec3(1.0f);
+
+			glm::mat4 Local = glm::mat4(1.0f);
+			glm::mat4 World = glm::mat4(1.0f);
+
+			uint64_t Version = 0;			// Unique stamp taken every time World is recomputed
+			uint64_t ParentVersion = 0;		// Parent's Version that World was computed against
+
+			static constexpr uint32_t UnknownDepth = std::numeric_limits<uint32_t>::max();
+			uint32_t Depth = UnknownDepth;
+			bool Dirty = true;
+			bool Changed = false;			// In m_Changed
+		};
+
+		void RebuildHierarchy();
+		[[nodiscard]] bool IsHierarchyValid(entt::entity entity) const;
+		void Resolve(entt::entity entity);
+
+	private:
+		entt::registry& m_Registry;
+		const std::unordered_map<UUID, entt::entity>& m_EntityMap;
+
+		std::vector<Node> m_Nodes;
+		std::vector<entt::entity> m_Order;
+		std::vector<entt::entity> m_Chain;
+		std::vector<entt::entity> m_Changed;
+		uint64_t m_VersionCounter = 0;
+		bool m_HierarchyDirty = true;
+	};
+}
@@ -62,6 +62,14 @@ namespace ArcEngine
 		MonoClass* TooltipAttribute = nullptr;
 		MonoClass* RangeAttribute = nullptr;
 
+		// Methods of the Entity base class, shared by every script instance
+		Ref<ScriptClass> EntityScriptClass;
+		MonoMethod* EntityConstructor = nullptr;
+		ScriptCollisionThunk OnCollisionEnter2DThunk = nullptr;
+		ScriptCollisionThunk OnCollisionExit2DThunk = nullptr;
+		ScriptCollisionThunk OnSensorEnter2DThunk = nullptr;
+		ScriptCollisionThunk OnSensorExit2DThunk = nullptr;
+
 		bool EnableDebugging = true;
 
 		std::unordered_map<std::string, Ref<ScriptClass>, UM_StringTransparentEquality> EntityClasses;
@@ -75,6 +83,13 @@ namespace ArcEngine
 
 	Scene* ScriptEngine::s_CurrentScene = nullptr;
 
+	static void LogException(MonoObject* exception)
+	{
+		MonoString* monoString = mono_object_to_string(exception, nullptr);
+		const std::string ex = MonoUtils::MonoStringToUTF8(monoString);
+		ARC_APP_CRITICAL(ex);
+	}
+
 	void ScriptEngine::Init()
 	{
 		ARC_PROFILE_SCOPE()
@@ -120,6 +135,7 @@ namespace ArcEngine
 		s_Data->EntityClasses.clear();
 		s_Data->EntityFields.clear();
 		s_Data->EntityRuntimeInstances.clear();
+		s_Data->EntityScriptClass.reset();
 
 		mono_domain_set(s_Data->RootDomain, false);
 		if (s_Data->AppDomain)
@@ -152,6 +168,13 @@ namespace ArcEngine
 		s_Data->HeaderAttribute = mono_class_from_name(s_Data->CoreImage, "ArcEngine", "HeaderAttribute");
 		s_Data->TooltipAttribute = mono_class_from_name(s_Data->CoreImage, "ArcEngine", "TooltipAttribute");
 		s_Data->RangeAttribute = mono_class_from_name(s_Data->CoreImage, "ArcEngine", "RangeAttribute");
+
+		const auto& entityClass = s_Data->EntityScriptClass = CreateRef<ScriptClass>(s_Data->EntityClass);
+		s_Data->EntityConstructor = entityClass->GetMethod(".ctor", 2);
+		s_Data->OnCollisionEnter2DThunk = reinterpret_cast<ScriptCollisionThunk>(entityClass->GetMethodThunk("HandleOnCollisionEnter2D", 3));
+		s_Data->OnCollisionExit2DThunk = reinterpret_cast<ScriptCollisionThunk>(entityClass->GetMethodThunk("HandleOnCollisionExit2D", 3));
+		s_Data->OnSensorEnter2DThunk = reinterpret_cast<ScriptCollisionThunk>(entityClass->GetMethodThunk("HandleOnSensorEnter2D", 3));
+		s_Data->OnSensorExit2DThunk = reinterpret_cast<ScriptCollisionThunk>(entityClass->GetMethodThunk("HandleOnSensorExit2D", 3));
 	}
 
 	void ScriptEngine::LoadClientAssembly()
@@ -267,9 +290,8 @@ namespace ArcEngine
 		ARC_PROFILE_SCOPE()
 
 		const auto& scriptClass = s_Data->EntityClasses.at(name);
-		const UUID entityID = entity.GetUUID();
-		auto* instance = new ScriptInstance(scriptClass, entityID);
-		s_Data->EntityRuntimeInstances[entityID][name] = instance;
+		auto* instance = new ScriptInstance(scriptClass, entity);
+		s_Data->EntityRuntimeInstances[entity.GetUUID()][name] = instance;
 		return instance;
 	}
 
@@ -302,6 +324,24 @@ namespace ArcEngine
 		s_Data->EntityRuntimeInstances[entity.GetUUID()].erase(name);
 	}
 
+	uint64_t ScriptEngine::GetEntityHandle(Entity entity)
+	{
+		ARC_CORE_ASSERT(entity.GetScene(), "Scene is null!")
+		return (static_cast<uint64_t>(entity.GetScene()->GetInstanceID()) << 32) | static_cast<uint32_t>(entity);
+	}
+
+	Entity ScriptEngine::GetEntity(uint64_t handle)
+	{
+		ARC_PROFILE_SCOPE()
+
+		if (!s_CurrentScene || static_cast<uint32_t>(handle >> 32) != s_CurrentScene->GetInstanceID())
+			return {};
+
+		// Entity checks the version against the registry
+		const Entity entity(static_cast<entt::entity>(static_cast<uint32_t>(handle)), s_CurrentScene);
+		return entity ? entity : Entity {};
+	}
+
 	MonoDomain* ScriptEngine::GetDomain()
 	{
 		return s_Data->AppDomain;
@@ -346,6 +386,7 @@ namespace ArcEngine
 
 		m_MonoClass = mono_class_from_name(s_Data->AppImage, classNamespace.c_str(), className.c_str());
 		LoadFields();
+		LoadMethods();
 	}
 
 	GCHandle ScriptClass::Instantiate() const
@@ -382,14 +423,27 @@ namespace ArcEngine
 
 		mono_runtime_invoke(method, reference, params, &exception);
 		if (exception)
-		{
-			MonoString* monoString = mono_object_to_string(exception, nullptr);
-			const std::string ex = MonoUtils::MonoStringToUTF8(monoString);
-			ARC_APP_CRITICAL(ex);
-		}
+			LogException(exception);
 		return gcHandle;
 	}
 
+	void* ScriptClass::GetMethodThunk(const char* methodName, uint32_t parameterCount) const
+	{
+		ARC_PROFILE_SCOPE()
+
+		MonoMethod* method = GetMethod(methodName, parameterCount);
+		return method ? mono_method_get_unmanaged_thunk(method) : nullptr;
+	}
+
+	void ScriptClass::LoadMethods()
+	{
+		ARC_PROFILE_SCOPE()
+
+		m_OnCreateThunk = reinterpret_cast<ScriptMethodThunk>(GetMethodThunk("OnCreate", 0));
+		m_OnUpdateThunk = reinterpret_cast<ScriptUpdateThunk>(GetMethodThunk("OnUpdate", 1));
+		m_OnDestroyThunk = reinterpret_cast<ScriptMethodThunk>(GetMethodThunk("OnDestroy", 0));
+	}
+
 	enum class Accessibility : uint8_t
 	{
 		None = 0,
@@ -564,17 +618,17 @@ namespace ArcEngine
 	// Script Instance /////////////////////////////////////////////////////
 	////////////////////////////////////////////////////////////////////////
 
-	ScriptInstance::ScriptInstance(const Ref<ScriptClass>& scriptClass, UUID entityID)
+	ScriptInstance::ScriptInstance(const Ref<ScriptClass>& scriptClass, Entity entity)
 		: m_ScriptClass(scriptClass)
 	{
 		ARC_PROFILE_SCOPE()
 
 		m_Handle = scriptClass->Instantiate();
 
-		m_EntityClass = CreateRef<ScriptClass>(s_Data->EntityClass);
-		m_Constructor = m_EntityClass->GetMethod(".ctor", 1);
-		void* params = &entityID;
-		m_EntityClass->InvokeMethod(m_Handle, m_Constructor, &params);
+		UUID entityID = entity.GetUUID();
+		uint64_t entityHandle = ScriptEngine::GetEntityHandle(entity);
+		void* params[] = { &entityID, &entityHandle };
+		s_Data->EntityScriptClass->InvokeMethod(m_Handle, s_Data->EntityConstructor, params);
 		
 		const std::string fullClassName = fmt::format("{}.{}", scriptClass->m_ClassNamespace, scriptClass->m_ClassName);
 		auto& fieldsMap = s_Data->EntityFields[entityID][fullClassName];
@@ -587,15 +641,6 @@ namespace ArcEngine
 				SetFieldValueInternal(fieldName, fieldInstance.GetBuffer());
 			}
 		}
-
-		m_OnCreateMethod = scriptClass->GetMethod("OnCreate", 0);
-		m_OnUpdateMethod = scriptClass->GetMethod("OnUpdate", 1);
-		m_OnDestroyMethod = scriptClass->GetMethod("OnDestroy", 0);
-
-		m_OnCollisionEnter2DMethod = m_EntityClass->GetMethod("HandleOnCollisionEnter2D", 1);
-		m_OnCollisionExit2DMethod = m_EntityClass->GetMethod("HandleOnCollisionExit2D", 1);
-		m_OnSensorEnter2DMethod = m_EntityClass->GetMethod("HandleOnSensorEnter2D", 1);
-		m_OnSensorExit2DMethod = m_EntityClass->GetMethod("HandleOnSensorExit2D", 1);
 	}
 
 	ScriptInstance::~ScriptInstance()
@@ -605,22 +650,44 @@ namespace ArcEngine
 		GCManager::ReleaseObjectReference(m_Handle);
 	}
 
+	// Thunks take the object itself, so the handle is resolved here the same way InvokeMethod does it
+	static MonoObject* GetInstanceObject(GCHandle handle)
+	{
+		MonoObject* reference = GCManager::GetReferencedObject(handle);
+		if (!reference)
+			ARC_APP_CRITICAL("System.NullReferenceException: Object reference not set to an instance of an object.");
+		return reference;
+	}
+
 	void ScriptInstance::InvokeOnCreate() const
 	{
 		ARC_PROFILE_SCOPE()
 
-		if (m_OnCreateMethod)
-			m_ScriptClass->InvokeMethod(m_Handle, m_OnCreateMethod);
+		if (const auto thunk = m_ScriptClass->m_OnCreateThunk)
+		{
+			if (MonoObject* reference = GetInstanceObject(m_Handle))
+			{
+				MonoException* exception = nullptr;
+				thunk(reference, &exception);
+				if (exception)
+					LogException(reinterpret_cast<MonoObject*>(exception));
+			}
+		}
 	}
 
 	void ScriptInstance::InvokeOnUpdate(float ts) const
 	{
 		ARC_PROFILE_SCOPE()
 
-		if (m_OnUpdateMethod)
+		if (const auto thunk = m_ScriptClass->m_OnUpdateThunk)
 		{
-			void* params = &ts;
-			m_ScriptClass->InvokeMethod(m_Handle, m_OnUpdateMethod, &params);
+			if (MonoObject* reference = GetInstanceObject(m_Handle))
+			{
+				MonoException* exception = nullptr;
+				thunk(reference, ts, &exception);
+				if (exception)
+					LogException(reinterpret_cast<MonoObject*>(exception));
+			}
 		}
 	}
 
@@ -628,40 +695,58 @@ namespace ArcEngine
 	{
 		ARC_PROFILE_SCOPE()
 
-		if (m_OnDestroyMethod)
-			m_ScriptClass->InvokeMethod(m_Handle, m_OnDestroyMethod);
+		if (const auto thunk = m_ScriptClass->m_OnDestroyThunk)
+		{
+			if (MonoObject* reference = GetInstanceObject(m_Handle))
+			{
+				MonoException* exception = nullptr;
+				thunk(reference, &exception);
+				if (exception)
+					LogException(reinterpret_cast<MonoObject*>(exception));
+			}
+		}
 	}
 
 	void ScriptInstance::InvokeOnCollisionEnter2D(Collision2DData& other) const
 	{
 		ARC_PROFILE_SCOPE()
 
-		void* params = &other;
-		m_EntityClass->InvokeMethod(m_Handle, m_OnCollisionEnter2DMethod, &params);
+		InvokeCollision(s_Data->OnCollisionEnter2DThunk, other);
 	}
 
 	void ScriptInstance::InvokeOnCollisionExit2D(Collision2DData& other) const
 	{
 		ARC_PROFILE_SCOPE()
 
-		void* params = &other;
-		m_EntityClass->InvokeMethod(m_Handle, m_OnCollisionExit2DMethod, &params);
+		InvokeCollision(s_Data->OnCollisionExit2DThunk, other);
 	}
 
 	void ScriptInstance::InvokeOnSensorEnter2D(Collision2DData& other) const
 	{
 		ARC_PROFILE_SCOPE()
 
-		void* params = &other;
-		m_EntityClass->InvokeMethod(m_Handle, m_OnSensorEnter2DMethod, &params);
+		InvokeCollision(s_Data->OnSensorEnter2DThunk, other);
 	}
 
 	void ScriptInstance::InvokeOnSensorExit2D(Collision2DData& other) const
 	{
 		ARC_PROFILE_SCOPE()
 
-		void* params = &other;
-		m_EntityClass->InvokeMethod(m_Handle, m_OnSensorExit2DMethod, &params);
+		InvokeCollision(s_Data->OnSensorExit2DThunk, other);
+	}
+
+	void ScriptInstance::InvokeCollision(ScriptCollisionThunk thunk, const Collision2DData& other) const
+	{
+		if (!thunk)
+			return;
+
+		if (MonoObject* reference = GetInstanceObject(m_Handle))
+		{
+			MonoException* exception = nullptr;
+			thunk(reference, other.EntityID, other.RelativeVelocity.x, other.RelativeVelocity.y, &exception);
+			if (exception)
+				LogException(reinterpret_cast<MonoObject*>(exception));
+		}
 	}
 
     GCHandle ScriptInstance::GetHandle() const
@@ -11,6 +11,15 @@ typedef struct _MonoMethod MonoMethod;
 typedef struct _MonoProperty MonoProperty;
 typedef struct _MonoClassField MonoClassField;
 typedef struct _MonoType MonoType;
+typedef struct _MonoObject MonoObject;
+typedef struct _MonoException MonoException;
+
+// Unmanaged thunks use the stdcall convention on Windows
+#if defined(ARC_PLATFORM_WINDOWS)
+	#define ARC_MONO_THUNK_CALL __stdcall
+#else
+	#define ARC_MONO_THUNK_CALL
+#endif
 
 namespace ArcEngine
 {
@@ -19,6 +28,11 @@ namespace ArcEngine
 
 	using GCHandle = uint32_t;
 
+	// Direct calls into managed methods, without boxing the arguments like mono_runtime_invoke does
+	using ScriptMethodThunk = void(ARC_MONO_THUNK_CALL*)(MonoObject* instance, MonoException** exception);
+	using ScriptUpdateThunk = void(ARC_MONO_THUNK_CALL*)(MonoObject* instance, float ts, MonoException** exception);
+	using ScriptCollisionThunk = void(ARC_MONO_THUNK_CALL*)(MonoObject* instance, uint64_t entityID, float velocityX, float velocityY, MonoException** exception);
+
 	enum class FieldType
 	{
 		Unknown = 0,
@@ -121,12 +135,15 @@ namespace ArcEngine
 		[[nodiscard]] GCHandle Instantiate() const;
 		[[nodiscard]] MonoMethod* GetMethod(const char* methodName, uint32_t parameterCount) const;
 		GCHandle InvokeMethod(GCHandle gcHandle, MonoMethod* method, void** params = nullptr) const;
+		// Returns nullptr if the class has no such method
+		[[nodiscard]] void* GetMethodThunk(const char* methodName, uint32_t parameterCount) const;
 
 		[[nodiscard]] const std::vector<std::string>& GetFields() const { return m_Fields; }
 		[[nodiscard]] const std::unordered_map<std::string, ScriptField, UM_StringTransparentEquality>& GetFieldsMap() const { return m_FieldsMap; }
 
 	private:
 		void LoadFields();
+		void LoadMethods();
 
 	private:
 		friend class ScriptEngine;
@@ -136,6 +153,12 @@ namespace ArcEngine
 		std::string m_ClassName;
 
 		MonoClass* m_MonoClass = nullptr;
+
+		// Shared by all instances of the class
+		ScriptMethodThunk m_OnCreateThunk = nullptr;
+		ScriptUpdateThunk m_OnUpdateThunk = nullptr;
+		ScriptMethodThunk m_OnDestroyThunk = nullptr;
+
 		std::vector<std::string> m_Fields;
 		std::unordered_map<std::string, ScriptField, UM_StringTransparentEquality> m_FieldsMap;
 	};
@@ -149,7 +172,7 @@ namespace ArcEngine
 	class ScriptInstance
 	{
 	public:
-		ScriptInstance(const Ref<ScriptClass>& scriptClass, UUID entityID);
+		ScriptInstance(const Ref<ScriptClass>& scriptClass, Entity entity);
 
 		ScriptInstance(const ScriptInstance& other) = delete;
 		ScriptInstance(ScriptInstance&& other) = delete;
@@ -190,20 +213,12 @@ namespace ArcEngine
 		void SetFieldValueInternal(const std::string& name, const void* value) const;
 		[[nodiscard]] std::string GetFieldValueStringInternal(const std::string& name) const;
 
+		void InvokeCollision(ScriptCollisionThunk thunk, const Collision2DData& other) const;
+
 	private:
-		Ref<ScriptClass> m_EntityClass;
 		Ref<ScriptClass> m_ScriptClass;
 
 		GCHandle m_Handle = 0;
-		MonoMethod* m_Constructor = nullptr;
-		MonoMethod* m_OnCreateMethod = nullptr;
-		MonoMethod* m_OnUpdateMethod = nullptr;
-		MonoMethod* m_OnDestroyMethod = nullptr;
-
-		MonoMethod* m_OnCollisionEnter2DMethod = nullptr;
-		MonoMethod* m_OnCollisionExit2DMethod = nullptr;
-		MonoMethod* m_OnSensorEnter2DMethod = nullptr;
-		MonoMethod* m_OnSensorExit2DMethod = nullptr;
 	};
 
 	class ScriptEngine
@@ -225,6 +240,12 @@ namespace ArcEngine
 		[[nodiscard]] static bool HasInstance(Entity entity, const std::string& name);
 		[[nodiscard]] static ScriptInstance* GetInstance(Entity entity, const std::string& name);
 		static void RemoveInstance(Entity entity, const std::string& name);
+
+		// Handles given to scripts in place of UUIDs: the scene instance ID in the high bits and the entity
+		// with its version in the low bits. They resolve without hashing, and stop resolving once the entity
+		// is destroyed or another scene becomes active.
+		[[nodiscard]] static uint64_t GetEntityHandle(Entity entity);
+		[[nodiscard]] static Entity GetEntity(uint64_t handle);
 		
 		[[nodiscard]] static std::unordered_map<std::string, Ref<ScriptClass>, UM_StringTransparentEquality>& GetClasses();
 		[[nodiscard]] static const std::vector<std::string>& GetFields (const char* className);
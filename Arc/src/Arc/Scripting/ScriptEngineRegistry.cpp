@@ -2,6 +2,8 @@
 #include "ScriptEngineRegistry.h"
 
 #include <mono/jit/jit.h>
+#include <mono/metadata/object.h>
+#include <span>
 #include <glm/gtc/type_ptr.hpp>
 #include <box2d/b2_body.h>
 
@@ -14,9 +16,10 @@
 
 namespace ArcEngine
 {
-	std::unordered_map<MonoType*, std::function<bool(const Entity&, MonoType*)>> ScriptEngineRegistry::s_HasComponentFuncs;
-	std::unordered_map<MonoType*, std::function<void(const Entity&, MonoType*)>> ScriptEngineRegistry::s_AddComponentFuncs;
-	std::unordered_map<MonoType*, std::function<GCHandle(const Entity&, MonoType*)>> ScriptEngineRegistry::s_GetComponentFuncs;
+	std::unordered_map<MonoType*, ScriptEngineRegistry::HasComponentFunc> ScriptEngineRegistry::s_HasComponentFuncs;
+	std::unordered_map<MonoType*, ScriptEngineRegistry::AddComponentFunc> ScriptEngineRegistry::s_AddComponentFuncs;
+	std::unordered_map<MonoType*, ScriptEngineRegistry::GetComponentFunc> ScriptEngineRegistry::s_GetComponentFuncs;
+	std::unordered_map<MonoType*, ScriptEngineRegistry::GetStorageFunc> ScriptEngineRegistry::s_GetStorageFuncs;
 
 	template<typename... Component>
 	void ScriptEngineRegistry::RegisterComponent()
@@ -45,6 +48,7 @@ namespace ArcEngine
 				ARC_CORE_TRACE("Registering {}", name);
 				s_HasComponentFuncs[type] = [](const Entity& entity, [[maybe_unused]] MonoType*) { return entity.HasComponent<Component>(); };
 				s_AddComponentFuncs[type] = [](const Entity& entity, [[maybe_unused]] MonoType*) { entity.AddComponent<Component>(); };
+				s_GetStorageFuncs[type] = [](Scene& scene) -> entt::sparse_set& { return scene.m_Registry.storage<Component>(); };
 			}
 		}(), ...);
 	}
@@ -121,6 +125,7 @@ namespace ArcEngine
 		s_HasComponentFuncs.clear();
 		s_GetComponentFuncs.clear();
 		s_AddComponentFuncs.clear();
+		s_GetStorageFuncs.clear();
 	}
 
 	///////////////////////////////////////////////////////////////////////////////////////////
@@ -180,33 +185,44 @@ namespace ArcEngine
 	///////////////////////////////////////////////////////////////////////////////////////////
 	// Entity /////////////////////////////////////////////////////////////////////////////////
 	///////////////////////////////////////////////////////////////////////////////////////////
-	static Entity GetEntity(uint64_t entityID)
+	static Entity GetEntity(uint64_t handle)
 	{
 		ARC_PROFILE_SCOPE()
 
 		ARC_CORE_ASSERT(ScriptEngine::GetScene(), "Active scene is null")
-		return ScriptEngine::GetScene()->GetEntity(entityID);
+		const Entity entity = ScriptEngine::GetEntity(handle);
+		ARC_CORE_ASSERT(entity, "Entity handle is stale or from another scene")
+		return entity;
 	}
 
-	void ScriptEngineRegistry::AddComponent(uint64_t entityID, void* type)
+	static uint64_t Entity_GetHandle(uint64_t entityID)
+	{
+		ARC_PROFILE_SCOPE()
+
+		ARC_CORE_ASSERT(ScriptEngine::GetScene(), "Active scene is null")
+		const Entity entity = ScriptEngine::GetScene()->GetEntity(entityID);
+		return entity ? ScriptEngine::GetEntityHandle(entity) : 0;
+	}
+
+	void ScriptEngineRegistry::AddComponent(uint64_t handle, void* type)
 	{
 		ARC_PROFILE_SCOPE()
 
 		MonoType* monoType = mono_reflection_type_get_type(static_cast<MonoReflectionType*>(type));
 		ARC_CORE_ASSERT(s_AddComponentFuncs.contains(monoType))
-		s_AddComponentFuncs.at(monoType)(GetEntity(entityID), monoType);
+		s_AddComponentFuncs.at(monoType)(GetEntity(handle), monoType);
 	}
 
-	bool ScriptEngineRegistry::HasComponent(uint64_t entityID, void* type)
+	bool ScriptEngineRegistry::HasComponent(uint64_t handle, void* type)
 	{
 		ARC_PROFILE_SCOPE()
 
 		MonoType* monoType = mono_reflection_type_get_type(static_cast<MonoReflectionType*>(type));
 		ARC_CORE_ASSERT(s_HasComponentFuncs.contains(monoType))
-		return s_HasComponentFuncs.at(monoType)(GetEntity(entityID), monoType);
+		return s_HasComponentFuncs.at(monoType)(GetEntity(handle), monoType);
 	}
 
-	MonoObject* ScriptEngineRegistry::GetComponent(uint64_t entityID, void* type)
+	MonoObject* ScriptEngineRegistry::GetComponent(uint64_t handle, void* type)
 	{
 		ARC_PROFILE_SCOPE()
 
@@ -215,122 +231,253 @@ namespace ArcEngine
 		const auto it = s_GetComponentFuncs.find(monoType);
 		if (it != s_GetComponentFuncs.end())
 		{
-			if (const GCHandle handle = it->second(GetEntity(entityID), monoType))
-				return GCManager::GetReferencedObject(handle);
+			if (const GCHandle gcHandle = it->second(GetEntity(handle), monoType))
+				return GCManager::GetReferencedObject(gcHandle);
 		}
 
 		return nullptr;
 	}
 
+	MonoArray* ScriptEngineRegistry::Query(MonoArray* types, MonoArray** outEntityIDs)
+	{
+		ARC_PROFILE_SCOPE()
+
+		Scene* scene = ScriptEngine::GetScene();
+		ARC_CORE_ASSERT(scene, "Active scene is null")
+
+		// Same iteration as a view over the component types, which are only known at runtime here
+		entt::runtime_view view;
+		bool valid = true;
+		const size_t typeCount = mono_array_length(types);
+		for (size_t i = 0; i < typeCount; ++i)
+		{
+			MonoType* monoType = mono_reflection_type_get_type(mono_array_get(types, MonoReflectionType*, i));
+			const auto it = s_GetStorageFuncs.find(monoType);
+			if (it == s_GetStorageFuncs.end())
+			{
+				char* typeName = mono_type_get_name(monoType);
+				ARC_APP_ERROR("{} cannot be queried, only built-in components can", typeName);
+				mono_free(typeName);
+				valid = false;
+				break;
+			}
+			view.iterate(it->second(*scene));
+		}
+
+		std::vector<entt::entity> entities;
+		if (valid && typeCount > 0)
+		{
+			entities.reserve(view.size_hint());
+			for (const entt::entity entity : view)
+				entities.push_back(entity);
+		}
+
+		MonoDomain* domain = mono_domain_get();
+		MonoArray* handles = mono_array_new(domain, mono_get_uint64_class(), entities.size());
+		MonoArray* entityIDs = mono_array_new(domain, mono_get_uint64_class(), entities.size());
+		for (size_t i = 0; i < entities.size(); ++i)
+		{
+			const Entity entity = { entities[i], scene };
+			mono_array_set(handles, uint64_t, i, ScriptEngine::GetEntityHandle(entity));
+			mono_array_set(entityIDs, uint64_t, i, static_cast<uint64_t>(entity.GetUUID()));
+		}
+
+		*outEntityIDs = entityIDs;
+		return handles;
+	}
+
+	///////////////////////////////////////////////////////////////////////////////////////////
+	// Bulk access ////////////////////////////////////////////////////////////////////////////
+	///////////////////////////////////////////////////////////////////////////////////////////
+
+	// Elements of a managed array of blittable values
+	template<typename T>
+	static std::span<T> GetArrayElements(MonoArray* array)
+	{
+		if (!array)
+			return {};
+		return { mono_array_addr(array, T, 0), mono_array_length(array) };
+	}
+
+	// Calls func with the component of every entity in handles and the matching element of values.
+	// Stops at the end of the shorter array, entities that are gone or lack the component are skipped.
+	template<typename Component, typename Value, typename Func>
+	static void ForEachComponent(MonoArray* handles, MonoArray* values, Func func)
+	{
+		ARC_CORE_ASSERT(ScriptEngine::GetScene(), "Active scene is null")
+
+		const std::span<const uint64_t> entityHandles = GetArrayElements<const uint64_t>(handles);
+		const std::span<Value> elements = GetArrayElements<Value>(values);
+		const size_t count = glm::min(entityHandles.size(), elements.size());
+		for (size_t i = 0; i < count; ++i)
+		{
+			const Entity entity = ScriptEngine::GetEntity(entityHandles[i]);
+			if (!entity)
+				continue;
+
+			if (Component* component = entity.TryGetComponent<Component>())
+				func(*component, elements[i]);
+		}
+	}
+
+	// The managed Transform has the same layout
+	static_assert(sizeof(TransformComponent) == sizeof(glm::vec3) * 3);
+
+	static void TransformComponent_GetTransforms(MonoArray* handles, MonoArray* outTransforms)
+	{
+		ARC_PROFILE_SCOPE()
+
+		ForEachComponent<TransformComponent, TransformComponent>(handles, outTransforms, [](const TransformComponent& component, TransformComponent& outTransform) { outTransform = component; });
+	}
+
+	static void TransformComponent_SetTransforms(MonoArray* handles, MonoArray* transforms)
+	{
+		ARC_PROFILE_SCOPE()
+
+		ForEachComponent<TransformComponent, const TransformComponent>(handles, transforms, [](TransformComponent& component, const TransformComponent& transform) { component = transform; });
+	}
+
+	static void TransformComponent_GetTranslations(MonoArray* handles, MonoArray* outTranslations)
+	{
+		ARC_PROFILE_SCOPE()
+
+		ForEachComponent<TransformComponent, glm::vec3>(handles, outTranslations, [](const TransformComponent& component, glm::vec3& outTranslation) { outTranslation = component.Translation; });
+	}
+
+	static void TransformComponent_SetTranslations(MonoArray* handles, MonoArray* translations)
+	{
+		ARC_PROFILE_SCOPE()
+
+		ForEachComponent<TransformComponent, const glm::vec3>(handles, translations, [](TransformComponent& component, const glm::vec3& translation) { component.Translation = translation; });
+	}
+
+	static void TransformComponent_GetRotations(MonoArray* handles, MonoArray* outRotations)
+	{
+		ARC_PROFILE_SCOPE()
+
+		ForEachComponent<TransformComponent, glm::vec3>(handles, outRotations, [](const TransformComponent& component, glm::vec3& outRotation) { outRotation = component.Rotation; });
+	}
+
+	static void TransformComponent_SetRotations(MonoArray* handles, MonoArray* rotations)
+	{
+		ARC_PROFILE_SCOPE()
+
+		ForEachComponent<TransformComponent, const glm::vec3>(handles, rotations, [](TransformComponent& component, const glm::vec3& rotation) { component.Rotation = rotation; });
+	}
+
 	///////////////////////////////////////////////////////////////////////////////////////////
 	// Transform //////////////////////////////////////////////////////////////////////////////
 	///////////////////////////////////////////////////////////////////////////////////////////
 
-	static void TransformComponent_GetTransform(uint64_t entityID, TransformComponent* outTransform)
+	static void TransformComponent_GetTransform(uint64_t handle, TransformComponent* outTransform)
 	{
 		ARC_PROFILE_SCOPE()
 
-		*outTransform = GetEntity(entityID).GetComponent<TransformComponent>();
+		*outTransform = GetEntity(handle).GetComponent<TransformComponent>();
 	}
 	
-	static void TransformComponent_SetTransform(uint64_t entityID, const TransformComponent* inTransform)
+	static void TransformComponent_SetTransform(uint64_t handle, const TransformComponent* inTransform)
 	{
 		ARC_PROFILE_SCOPE()
 
-		GetEntity(entityID).GetComponent<TransformComponent>() = *inTransform;
+		GetEntity(handle).GetComponent<TransformComponent>() = *inTransform;
 	}
 
-	static void TransformComponent_GetTranslation(uint64_t entityID, glm::vec3* outTranslation)
+	static void TransformComponent_GetTranslation(uint64_t handle, glm::vec3* outTranslation)
 	{
 		ARC_PROFILE_SCOPE()
 
-		*outTranslation = GetEntity(entityID).GetComponent<TransformComponent>().Translation;
+		*outTranslation = GetEntity(handle).GetComponent<TransformComponent>().Translation;
 	}
 
-	static void TransformComponent_SetTranslation(uint64_t entityID, const glm::vec3* inTranslation)
+	static void TransformComponent_SetTranslation(uint64_t handle, const glm::vec3* inTranslation)
 	{
 		ARC_PROFILE_SCOPE()
 
-		GetEntity(entityID).GetComponent<TransformComponent>().Translation = *inTranslation;
+		GetEntity(handle).GetComponent<TransformComponent>().Translation = *inTranslation;
 	}
 
-	static void TransformComponent_GetRotation(uint64_t entityID, glm::vec3* outRotation)
+	static void TransformComponent_GetRotation(uint64_t handle, glm::vec3* outRotation)
 	{
 		ARC_PROFILE_SCOPE()
 
-		*outRotation = GetEntity(entityID).GetComponent<TransformComponent>().Rotation;
+		*outRotation = GetEntity(handle).GetComponent<TransformComponent>().Rotation;
 	}
 
-	static void TransformComponent_SetRotation(uint64_t entityID, const glm::vec3* inRotation)
+	static void TransformComponent_SetRotation(uint64_t handle, const glm::vec3* inRotation)
 	{
 		ARC_PROFILE_SCOPE()
 
-		GetEntity(entityID).GetComponent<TransformComponent>().Rotation = *inRotation;
+		GetEntity(handle).GetComponent<TransformComponent>().Rotation = *inRotation;
 	}
 
-	static void TransformComponent_GetScale(uint64_t entityID, glm::vec3* outScale)
+	static void TransformComponent_GetScale(uint64_t handle, glm::vec3* outScale)
 	{
 		ARC_PROFILE_SCOPE()
 
-		*outScale = GetEntity(entityID).GetComponent<TransformComponent>().Scale;
+		*outScale = GetEntity(handle).GetComponent<TransformComponent>().Scale;
 	}
 
-	static void TransformComponent_SetScale(uint64_t entityID, const glm::vec3* inScale)
+	static void TransformComponent_SetScale(uint64_t handle, const glm::vec3* inScale)
 	{
 		ARC_PROFILE_SCOPE()
 
-		GetEntity(entityID).GetComponent<TransformComponent>().Scale = *inScale;
+		GetEntity(handle).GetComponent<TransformComponent>().Scale = *inScale;
 	}
 
 	///////////////////////////////////////////////////////////////////////////////////////////
 	// Tag ////////////////////////////////////////////////////////////////////////////////////
 	///////////////////////////////////////////////////////////////////////////////////////////
 
-	static MonoString* TagComponent_GetTag(uint64_t entityID)
+	static MonoString* TagComponent_GetTag(uint64_t handle)
 	{
 		ARC_PROFILE_SCOPE()
 
-		const auto& tag = GetEntity(entityID).GetComponent<TagComponent>();
+		const auto& tag = GetEntity(handle).GetComponent<TagComponent>();
 		return mono_string_new(mono_domain_get(), tag.Tag.c_str());
 	}
 
-	static void TagComponent_SetTag(uint64_t entityID, MonoString* tag)
+	static void TagComponent_SetTag(uint64_t handle, MonoString* tag)
 	{
 		ARC_PROFILE_SCOPE()
 
-		GetEntity(entityID).GetComponent<TagComponent>().Tag = MonoUtils::MonoStringToUTF8(tag);
+		GetEntity(handle).GetComponent<TagComponent>().Tag = MonoUtils::MonoStringToUTF8(tag);
 	}
 
 	///////////////////////////////////////////////////////////////////////////////////////////
 	// Sprite Renderer ////////////////////////////////////////////////////////////////////////
 	///////////////////////////////////////////////////////////////////////////////////////////
 
-	static void SpriteRendererComponent_GetColor(uint64_t entityID, glm::vec4* outTint)
+	static void SpriteRendererComponent_GetColor(uint64_t handle, glm::vec4* outTint)
 	{
 		ARC_PROFILE_SCOPE()
 
-		*outTint = GetEntity(entityID).GetComponent<SpriteRendererComponent>().Color;
+		*outTint = GetEntity(handle).GetComponent<SpriteRendererComponent>().Color;
 	}
 
-	static void SpriteRendererComponent_SetColor(uint64_t entityID, const glm::vec4* tint)
+	static void SpriteRendererComponent_SetColor(uint64_t handle, const glm::vec4* tint)
 	{
 		ARC_PROFILE_SCOPE()
 
-		GetEntity(entityID).GetComponent<SpriteRendererComponent>().Color = *tint;
+		const Entity entity = GetEntity(handle);
+		entity.GetComponent<SpriteRendererComponent>().Color = *tint;
+		entity.PatchComponent<SpriteRendererComponent>();
 	}
 
-	static void SpriteRendererComponent_GetTilingFactor(uint64_t entityID, float* outTiling)
+	static void SpriteRendererComponent_GetTilingFactor(uint64_t handle, float* outTiling)
 	{
 		ARC_PROFILE_SCOPE()
 
-		*outTiling = GetEntity(entityID).GetComponent<SpriteRendererComponent>().TilingFactor;
+		*outTiling = GetEntity(handle).GetComponent<SpriteRendererComponent>().TilingFactor;
 	}
 
-	static void SpriteRendererComponent_SetTilingFactor(uint64_t entityID, const float* tiling)
+	static void SpriteRendererComponent_SetTilingFactor(uint64_t handle, const float* tiling)
 	{
 		ARC_PROFILE_SCOPE()
 
-		GetEntity(entityID).GetComponent<SpriteRendererComponent>().TilingFactor = *tiling;
+		const Entity entity = GetEntity(handle);
+		entity.GetComponent<SpriteRendererComponent>().TilingFactor = *tiling;
+		entity.PatchComponent<SpriteRendererComponent>();
 	}
 
 	///////////////////////////////////////////////////////////////////////////////////////////
@@ -346,35 +493,35 @@ namespace ArcEngine
 		return nullptr;
 	}
 
-	static void Rigidbody2DComponent_GetBodyType(uint64_t entityID, int32_t* outType)
+	static void Rigidbody2DComponent_GetBodyType(uint64_t handle, int32_t* outType)
 	{
 		ARC_PROFILE_SCOPE()
 
-		*outType = static_cast<int32_t>(GetEntity(entityID).GetComponent<Rigidbody2DComponent>().Type);
+		*outType = static_cast<int32_t>(GetEntity(handle).GetComponent<Rigidbody2DComponent>().Type);
 	}
 
-	static void Rigidbody2DComponent_SetBodyType(uint64_t entityID, const int32_t* type)
+	static void Rigidbody2DComponent_SetBodyType(uint64_t handle, const int32_t* type)
 	{
 		ARC_PROFILE_SCOPE()
 
-		auto& component = GetEntity(entityID).GetComponent<Rigidbody2DComponent>();
+		auto& component = GetEntity(handle).GetComponent<Rigidbody2DComponent>();
 		component.Type = static_cast<Rigidbody2DComponent::BodyType>(*type);
 		if (auto* body = GetB2Body(component))
 			body->SetType(static_cast<b2BodyType>(*type));
 	}
 
-	static void Rigidbody2DComponent_GetAutoMass(uint64_t entityID, bool* outAutoMass)
+	static void Rigidbody2DComponent_GetAutoMass(uint64_t handle, bool* outAutoMass)
 	{
 		ARC_PROFILE_SCOPE()
 
-		*outAutoMass = GetEntity(entityID).GetComponent<Rigidbody2DComponent>().AutoMass;
+		*outAutoMass = GetEntity(handle).GetComponent<Rigidbody2DComponent>().AutoMass;
 	}
 
-	static void Rigidbody2DComponent_SetAutoMass(uint64_t entityID, const bool* autoMass)
+	static void Rigidbody2DComponent_SetAutoMass(uint64_t handle, const bool* autoMass)
 	{
 		ARC_PROFILE_SCOPE()
 
-		auto& component = GetEntity(entityID).GetComponent<Rigidbody2DComponent>();
+		auto& component = GetEntity(handle).GetComponent<Rigidbody2DComponent>();
 		component.AutoMass = *autoMass;
 		if (auto* body = GetB2Body(component))
 		{
@@ -391,18 +538,18 @@ namespace ArcEngine
 		}
 	}
 
-	static void Rigidbody2DComponent_GetMass(uint64_t entityID, float* outMass)
+	static void Rigidbody2DComponent_GetMass(uint64_t handle, float* outMass)
 	{
 		ARC_PROFILE_SCOPE()
 
-		*outMass = GetEntity(entityID).GetComponent<Rigidbody2DComponent>().Mass;
+		*outMass = GetEntity(handle).GetComponent<Rigidbody2DComponent>().Mass;
 	}
 
-	static void Rigidbody2DComponent_SetMass(uint64_t entityID, const float* mass)
+	static void Rigidbody2DComponent_SetMass(uint64_t handle, const float* mass)
 	{
 		ARC_PROFILE_SCOPE()
 
-		auto& component = GetEntity(entityID).GetComponent<Rigidbody2DComponent>();
+		auto& component = GetEntity(handle).GetComponent<Rigidbody2DComponent>();
 		if (auto* body = GetB2Body(component))
 		{
 			if (!component.AutoMass)
@@ -419,220 +566,220 @@ namespace ArcEngine
 		}
 	}
 
-	static void Rigidbody2DComponent_GetLinearDrag(uint64_t entityID, float* outDrag)
+	static void Rigidbody2DComponent_GetLinearDrag(uint64_t handle, float* outDrag)
 	{
 		ARC_PROFILE_SCOPE()
 
-		*outDrag = GetEntity(entityID).GetComponent<Rigidbody2DComponent>().LinearDrag;
+		*outDrag = GetEntity(handle).GetComponent<Rigidbody2DComponent>().LinearDrag;
 	}
 
-	static void Rigidbody2DComponent_SetLinearDrag(uint64_t entityID, const float* drag)
+	static void Rigidbody2DComponent_SetLinearDrag(uint64_t handle, const float* drag)
 	{
 		ARC_PROFILE_SCOPE()
 
-		auto& component = GetEntity(entityID).GetComponent<Rigidbody2DComponent>();
+		auto& component = GetEntity(handle).GetComponent<Rigidbody2DComponent>();
 		component.LinearDrag = glm::max(*drag, 0.0f);
 		if (auto* body = GetB2Body(component))
 			body->SetLinearDamping(component.LinearDrag);
 	}
 
-	static void Rigidbody2DComponent_GetAngularDrag(uint64_t entityID, float* outDrag)
+	static void Rigidbody2DComponent_GetAngularDrag(uint64_t handle, float* outDrag)
 	{
 		ARC_PROFILE_SCOPE()
 
-		*outDrag = GetEntity(entityID).GetComponent<Rigidbody2DComponent>().AngularDrag;
+		*outDrag = GetEntity(handle).GetComponent<Rigidbody2DComponent>().AngularDrag;
 	}
 
-	static void Rigidbody2DComponent_SetAngularDrag(uint64_t entityID, const float* drag)
+	static void Rigidbody2DComponent_SetAngularDrag(uint64_t handle, const float* drag)
 	{
 		ARC_PROFILE_SCOPE()
 
-		auto& component = GetEntity(entityID).GetComponent<Rigidbody2DComponent>();
+		auto& component = GetEntity(handle).GetComponent<Rigidbody2DComponent>();
 		component.AngularDrag = glm::max(*drag, 0.0f);
 		if (auto* body = GetB2Body(component))
 			body->SetAngularDamping(component.AngularDrag);
 	}
 
-	static void Rigidbody2DComponent_GetAllowSleep(uint64_t entityID, bool* outState)
+	static void Rigidbody2DComponent_GetAllowSleep(uint64_t handle, bool* outState)
 	{
 		ARC_PROFILE_SCOPE()
 
-		*outState = GetEntity(entityID).GetComponent<Rigidbody2DComponent>().AllowSleep;
+		*outState = GetEntity(handle).GetComponent<Rigidbody2DComponent>().AllowSleep;
 	}
 
-	static void Rigidbody2DComponent_SetAllowSleep(uint64_t entityID, const bool* state)
+	static void Rigidbody2DComponent_SetAllowSleep(uint64_t handle, const bool* state)
 	{
 		ARC_PROFILE_SCOPE()
 
-		auto& component = GetEntity(entityID).GetComponent<Rigidbody2DComponent>();
+		auto& component = GetEntity(handle).GetComponent<Rigidbody2DComponent>();
 		component.AllowSleep = *state;
 		if (auto* body = GetB2Body(component))
 			body->SetSleepingAllowed(component.AllowSleep);
 	}
 
-	static void Rigidbody2DComponent_GetAwake(uint64_t entityID, bool* outState)
+	static void Rigidbody2DComponent_GetAwake(uint64_t handle, bool* outState)
 	{
 		ARC_PROFILE_SCOPE()
 
-		*outState = GetEntity(entityID).GetComponent<Rigidbody2DComponent>().Awake;
+		*outState = GetEntity(handle).GetComponent<Rigidbody2DComponent>().Awake;
 	}
 
-	static void Rigidbody2DComponent_SetAwake(uint64_t entityID, const bool* state)
+	static void Rigidbody2DComponent_SetAwake(uint64_t handle, const bool* state)
 	{
 		ARC_PROFILE_SCOPE()
 
-		auto& component = GetEntity(entityID).GetComponent<Rigidbody2DComponent>();
+		auto& component = GetEntity(handle).GetComponent<Rigidbody2DComponent>();
 		component.Awake = *state;
 		if (auto* body = GetB2Body(component))
 			body->SetAwake(component.Awake);
 	}
 
-	static void Rigidbody2DComponent_GetContinuous(uint64_t entityID, bool* outState)
+	static void Rigidbody2DComponent_GetContinuous(uint64_t handle, bool* outState)
 	{
 		ARC_PROFILE_SCOPE()
 
-		*outState = GetEntity(entityID).GetComponent<Rigidbody2DComponent>().Continuous;
+		*outState = GetEntity(handle).GetComponent<Rigidbody2DComponent>().Continuous;
 	}
 
-	static void Rigidbody2DComponent_SetContinuous(uint64_t entityID, const bool* state)
+	static void Rigidbody2DComponent_SetContinuous(uint64_t handle, const bool* state)
 	{
 		ARC_PROFILE_SCOPE()
 
-		auto& component = GetEntity(entityID).GetComponent<Rigidbody2DComponent>();
+		auto& component = GetEntity(handle).GetComponent<Rigidbody2DComponent>();
 		component.Continuous = *state;
 		if (auto* body = GetB2Body(component))
 			body->SetBullet(component.Continuous);
 	}
 
-	static void Rigidbody2DComponent_GetFreezeRotation(uint64_t entityID, bool* outState)
+	static void Rigidbody2DComponent_GetFreezeRotation(uint64_t handle, bool* outState)
 	{
 		ARC_PROFILE_SCOPE()
 
-		*outState = GetEntity(entityID).GetComponent<Rigidbody2DComponent>().FreezeRotation;
+		*outState = GetEntity(handle).GetComponent<Rigidbody2DComponent>().FreezeRotation;
 	}
 
-	static void Rigidbody2DComponent_SetFreezeRotation(uint64_t entityID, const bool* state)
+	static void Rigidbody2DComponent_SetFreezeRotation(uint64_t handle, const bool* state)
 	{
 		ARC_PROFILE_SCOPE()
 
-		auto& component = GetEntity(entityID).GetComponent<Rigidbody2DComponent>();
+		auto& component = GetEntity(handle).GetComponent<Rigidbody2DComponent>();
 		component.FreezeRotation = *state;
 		if (auto* body = GetB2Body(component))
 			body->SetFixedRotation(component.FreezeRotation);
 	}
 
-	static void Rigidbody2DComponent_GetGravityScale(uint64_t entityID, float* outGravityScale)
+	static void Rigidbody2DComponent_GetGravityScale(uint64_t handle, float* outGravityScale)
 	{
 		ARC_PROFILE_SCOPE()
 
-		*outGravityScale = GetEntity(entityID).GetComponent<Rigidbody2DComponent>().GravityScale;
+		*outGravityScale = GetEntity(handle).GetComponent<Rigidbody2DComponent>().GravityScale;
 	}
 
-	static void Rigidbody2DComponent_SetGravityScale(uint64_t entityID, const bool* gravityScale)
+	static void Rigidbody2DComponent_SetGravityScale(uint64_t handle, const bool* gravityScale)
 	{
 		ARC_PROFILE_SCOPE()
 
-		auto& component = GetEntity(entityID).GetComponent<Rigidbody2DComponent>();
+		auto& component = GetEntity(handle).GetComponent<Rigidbody2DComponent>();
 		component.GravityScale = *gravityScale;
 		if (auto* body = GetB2Body(component))
 			body->SetGravityScale(component.GravityScale);
 	}
 
-	static void Rigidbody2DComponent_ApplyForceAtCenter(uint64_t entityID, const glm::vec2* force)
+	static void Rigidbody2DComponent_ApplyForceAtCenter(uint64_t handle, const glm::vec2* force)
 	{
 		ARC_PROFILE_SCOPE()
 
-		const auto& component = GetEntity(entityID).GetComponent<Rigidbody2DComponent>();
+		const auto& component = GetEntity(handle).GetComponent<Rigidbody2DComponent>();
 		if (auto* body = GetB2Body(component))
 			body->ApplyForceToCenter({ force->x, force->y }, true);
 	}
 
-	static void Rigidbody2DComponent_ApplyForce(uint64_t entityID, const glm::vec2* force, const glm::vec2* point)
+	static void Rigidbody2DComponent_ApplyForce(uint64_t handle, const glm::vec2* force, const glm::vec2* point)
 	{
 		ARC_PROFILE_SCOPE()
 
-		const auto& component = GetEntity(entityID).GetComponent<Rigidbody2DComponent>();
+		const auto& component = GetEntity(handle).GetComponent<Rigidbody2DComponent>();
 		if (auto* body = GetB2Body(component))
 			body->ApplyForce({ force->x, force->y }, { point->x, point->y }, true);
 	}
 
-	static void Rigidbody2DComponent_ApplyLinearImpulse(uint64_t entityID, const glm::vec2* impulse, const glm::vec2* point)
+	static void Rigidbody2DComponent_ApplyLinearImpulse(uint64_t handle, const glm::vec2* impulse, const glm::vec2* point)
 	{
 		ARC_PROFILE_SCOPE()
 
-		const auto& component = GetEntity(entityID).GetComponent<Rigidbody2DComponent>();
+		const auto& component = GetEntity(handle).GetComponent<Rigidbody2DComponent>();
 		if (auto* body = GetB2Body(component))
 			body->ApplyLinearImpulse({ impulse->x, impulse->y }, { point->x, point->y }, true);
 	}
 
-	static void Rigidbody2DComponent_ApplyLinearImpulseAtCenter(uint64_t entityID, const glm::vec2* impulse)
+	static void Rigidbody2DComponent_ApplyLinearImpulseAtCenter(uint64_t handle, const glm::vec2* impulse)
 	{
 		ARC_PROFILE_SCOPE()
 
-		const auto& component = GetEntity(entityID).GetComponent<Rigidbody2DComponent>();
+		const auto& component = GetEntity(handle).GetComponent<Rigidbody2DComponent>();
 		if (auto* body = GetB2Body(component))
 			body->ApplyLinearImpulseToCenter({ impulse->x, impulse->y }, true);
 	}
 
-	static void Rigidbody2DComponent_ApplyAngularImpulse(uint64_t entityID, const float* impulse)
+	static void Rigidbody2DComponent_ApplyAngularImpulse(uint64_t handle, const float* impulse)
 	{
 		ARC_PROFILE_SCOPE()
 
-		const auto& component = GetEntity(entityID).GetComponent<Rigidbody2DComponent>();
+		const auto& component = GetEntity(handle).GetComponent<Rigidbody2DComponent>();
 		if (auto* body = GetB2Body(component))
 			body->ApplyAngularImpulse(*impulse, true);
 	}
 
-	static void Rigidbody2DComponent_ApplyTorque(uint64_t entityID, const float* torque)
+	static void Rigidbody2DComponent_ApplyTorque(uint64_t handle, const float* torque)
 	{
 		ARC_PROFILE_SCOPE()
 
-		const auto& component = GetEntity(entityID).GetComponent<Rigidbody2DComponent>();
+		const auto& component = GetEntity(handle).GetComponent<Rigidbody2DComponent>();
 		if (auto* body = GetB2Body(component))
 			body->ApplyTorque(*torque, true);
 	}
 
-	static void Rigidbody2DComponent_IsAwake(uint64_t entityID, bool* outAwake)
+	static void Rigidbody2DComponent_IsAwake(uint64_t handle, bool* outAwake)
 	{
 		ARC_PROFILE_SCOPE()
 
-		const auto& component = GetEntity(entityID).GetComponent<Rigidbody2DComponent>();
+		const auto& component = GetEntity(handle).GetComponent<Rigidbody2DComponent>();
 		const auto* body = GetB2Body(component);
 		*outAwake = body ? body->IsAwake() : false;
 	}
 
-	static void Rigidbody2DComponent_IsSleeping(uint64_t entityID, bool* outSleeping)
+	static void Rigidbody2DComponent_IsSleeping(uint64_t handle, bool* outSleeping)
 	{
 		ARC_PROFILE_SCOPE()
 
 		bool awake;
-		Rigidbody2DComponent_IsAwake(entityID, &awake);
+		Rigidbody2DComponent_IsAwake(handle, &awake);
 		*outSleeping = !awake;
 	}
 
-	static void Rigidbody2DComponent_MovePosition(uint64_t entityID, const glm::vec2* position)
+	static void Rigidbody2DComponent_MovePosition(uint64_t handle, const glm::vec2* position)
 	{
 		ARC_PROFILE_SCOPE()
 
-		const auto& component = GetEntity(entityID).GetComponent<Rigidbody2DComponent>();
+		const auto& component = GetEntity(handle).GetComponent<Rigidbody2DComponent>();
 		if (auto* body = GetB2Body(component))
 			body->SetTransform({ position->x, position->y }, body->GetAngle());
 	}
 
-	static void Rigidbody2DComponent_MoveRotation(uint64_t entityID, const float* angleRadians)
+	static void Rigidbody2DComponent_MoveRotation(uint64_t handle, const float* angleRadians)
 	{
 		ARC_PROFILE_SCOPE()
 
-		const auto& component = GetEntity(entityID).GetComponent<Rigidbody2DComponent>();
+		const auto& component = GetEntity(handle).GetComponent<Rigidbody2DComponent>();
 		if (auto* body = GetB2Body(component))
 			body->SetTransform(body->GetPosition(), *angleRadians);
 	}
 
-	static void Rigidbody2DComponent_GetVelocity(uint64_t entityID, glm::vec2* outVelocity)
+	static void Rigidbody2DComponent_GetVelocity(uint64_t handle, glm::vec2* outVelocity)
 	{
 		ARC_PROFILE_SCOPE()
 
-		const auto& component = GetEntity(entityID).GetComponent<Rigidbody2DComponent>();
+		const auto& component = GetEntity(handle).GetComponent<Rigidbody2DComponent>();
 		if (const auto* body = GetB2Body(component))
 		{
 			const b2Vec2 velocity = body->GetLinearVelocity();
@@ -645,47 +792,76 @@ namespace ArcEngine
 		}
 	}
 
-	static void Rigidbody2DComponent_SetVelocity(uint64_t entityID, const glm::vec2* velocity)
+	static void Rigidbody2DComponent_SetVelocity(uint64_t handle, const glm::vec2* velocity)
 	{
 		ARC_PROFILE_SCOPE()
 
-		const auto& component = GetEntity(entityID).GetComponent<Rigidbody2DComponent>();
+		const auto& component = GetEntity(handle).GetComponent<Rigidbody2DComponent>();
 		if (auto* body = GetB2Body(component))
 			body->SetLinearVelocity({ velocity->x, velocity->y });
 	}
 
-	static void Rigidbody2DComponent_GetAngularVelocity(uint64_t entityID, float* outVelocity)
+	static void Rigidbody2DComponent_GetVelocities(MonoArray* handles, MonoArray* outVelocities)
+	{
+		ARC_PROFILE_SCOPE()
+
+		ForEachComponent<Rigidbody2DComponent, glm::vec2>(handles, outVelocities, [](const Rigidbody2DComponent& component, glm::vec2& outVelocity)
+		{
+			if (const auto* body = GetB2Body(component))
+			{
+				const b2Vec2 velocity = body->GetLinearVelocity();
+				outVelocity = { velocity.x, velocity.y };
+			}
+			else
+			{
+				outVelocity = glm::vec2(0.0f);
+			}
+		});
+	}
+
+	static void Rigidbody2DComponent_SetVelocities(MonoArray* handles, MonoArray* velocities)
+	{
+		ARC_PROFILE_SCOPE()
+
+		ForEachComponent<Rigidbody2DComponent, const glm::vec2>(handles, velocities, [](const Rigidbody2DComponent& component, const glm::vec2& velocity)
+		{
+			if (auto* body = GetB2Body(component))
+				body->SetLinearVelocity({ velocity.x, velocity.y });
+		});
+	}
+
+	static void Rigidbody2DComponent_GetAngularVelocity(uint64_t handle, float* outVelocity)
 	{
 		ARC_PROFILE_SCOPE()
 
-		const auto& component = GetEntity(entityID).GetComponent<Rigidbody2DComponent>();
+		const auto& component = GetEntity(handle).GetComponent<Rigidbody2DComponent>();
 		const auto* body = GetB2Body(component);
 		*outVelocity = body ? body->GetAngularVelocity() : 0.0f;
 	}
 
-	static void Rigidbody2DComponent_SetAngularVelocity(uint64_t entityID, const float* velocity)
+	static void Rigidbody2DComponent_SetAngularVelocity(uint64_t handle, const float* velocity)
 	{
 		ARC_PROFILE_SCOPE()
 
-		const auto& component = GetEntity(entityID).GetComponent<Rigidbody2DComponent>();
+		const auto& component = GetEntity(handle).GetComponent<Rigidbody2DComponent>();
 		if (auto* body = GetB2Body(component))
 			body->SetAngularVelocity(*velocity);
 	}
 
-	static void Rigidbody2DComponent_Sleep(uint64_t entityID)
+	static void Rigidbody2DComponent_Sleep(uint64_t handle)
 	{
 		ARC_PROFILE_SCOPE()
 
-		const auto& component = GetEntity(entityID).GetComponent<Rigidbody2DComponent>();
+		const auto& component = GetEntity(handle).GetComponent<Rigidbody2DComponent>();
 		if (auto* body = GetB2Body(component))
 			body->SetAwake(false);
 	}
 
-	static void Rigidbody2DComponent_WakeUp(uint64_t entityID)
+	static void Rigidbody2DComponent_WakeUp(uint64_t handle)
 	{
 		ARC_PROFILE_SCOPE()
 
-		const auto& component = GetEntity(entityID).GetComponent<Rigidbody2DComponent>();
+		const auto& component = GetEntity(handle).GetComponent<Rigidbody2DComponent>();
 		if (auto* body = GetB2Body(component))
 			body->SetAwake(true);
 	}
@@ -694,246 +870,246 @@ namespace ArcEngine
 	// Audio Source ////////////////////////////////////////////////////////////////////////
 	///////////////////////////////////////////////////////////////////////////////////////////
 
-	static void AudioSourceComponent_GetVolume(uint64_t entityID, float* outVolume)
+	static void AudioSourceComponent_GetVolume(uint64_t handle, float* outVolume)
 	{
 		ARC_PROFILE_SCOPE()
 
-		*outVolume = GetEntity(entityID).GetComponent<AudioSourceComponent>().Config.VolumeMultiplier;
+		*outVolume = GetEntity(handle).GetComponent<AudioSourceComponent>().Config.VolumeMultiplier;
 	}
 
-	static void AudioSourceComponent_SetVolume(uint64_t entityID, const float* volume)
+	static void AudioSourceComponent_SetVolume(uint64_t handle, const float* volume)
 	{
 		ARC_PROFILE_SCOPE()
 
-		auto& component = GetEntity(entityID).GetComponent<AudioSourceComponent>();
+		auto& component = GetEntity(handle).GetComponent<AudioSourceComponent>();
 		component.Config.VolumeMultiplier = *volume;
 		if (component.Source)
 			component.Source->SetVolume(*volume);
 	}
 
-	static void AudioSourceComponent_GetPitch(uint64_t entityID, float* outPitch)
+	static void AudioSourceComponent_GetPitch(uint64_t handle, float* outPitch)
 	{
 		ARC_PROFILE_SCOPE()
 
-		*outPitch = GetEntity(entityID).GetComponent<AudioSourceComponent>().Config.PitchMultiplier;
+		*outPitch = GetEntity(handle).GetComponent<AudioSourceComponent>().Config.PitchMultiplier;
 	}
 
-	static void AudioSourceComponent_SetPitch(uint64_t entityID, const float* pitch)
+	static void AudioSourceComponent_SetPitch(uint64_t handle, const float* pitch)
 	{
 		ARC_PROFILE_SCOPE()
 
-		auto& component = GetEntity(entityID).GetComponent<AudioSourceComponent>();
+		auto& component = GetEntity(handle).GetComponent<AudioSourceComponent>();
 		component.Config.PitchMultiplier = *pitch;
 		if (component.Source)
 			component.Source->SetVolume(*pitch);
 	}
 
-	static void AudioSourceComponent_GetPlayOnAwake(uint64_t entityID, bool* outPlayOnAwake)
+	static void AudioSourceComponent_GetPlayOnAwake(uint64_t handle, bool* outPlayOnAwake)
 	{
 		ARC_PROFILE_SCOPE()
 
-		*outPlayOnAwake = GetEntity(entityID).GetComponent<AudioSourceComponent>().Config.PlayOnAwake;
+		*outPlayOnAwake = GetEntity(handle).GetComponent<AudioSourceComponent>().Config.PlayOnAwake;
 	}
 
-	static void AudioSourceComponent_SetPlayOnAwake(uint64_t entityID, const bool* playOnAwake)
+	static void AudioSourceComponent_SetPlayOnAwake(uint64_t handle, const bool* playOnAwake)
 	{
 		ARC_PROFILE_SCOPE()
 
-		GetEntity(entityID).GetComponent<AudioSourceComponent>().Config.PlayOnAwake = *playOnAwake;
+		GetEntity(handle).GetComponent<AudioSourceComponent>().Config.PlayOnAwake = *playOnAwake;
 	}
 
-	static void AudioSourceComponent_GetLooping(uint64_t entityID, bool* outLooping)
+	static void AudioSourceComponent_GetLooping(uint64_t handle, bool* outLooping)
 	{
 		ARC_PROFILE_SCOPE()
 
-		*outLooping = GetEntity(entityID).GetComponent<AudioSourceComponent>().Config.Looping;
+		*outLooping = GetEntity(handle).GetComponent<AudioSourceComponent>().Config.Looping;
 	}
 
-	static void AudioSourceComponent_SetLooping(uint64_t entityID, const bool* looping)
+	static void AudioSourceComponent_SetLooping(uint64_t handle, const bool* looping)
 	{
 		ARC_PROFILE_SCOPE()
 
-		auto& component = GetEntity(entityID).GetComponent<AudioSourceComponent>();
+		auto& component = GetEntity(handle).GetComponent<AudioSourceComponent>();
 		component.Config.Looping = *looping;
 		if (component.Source)
 			component.Source->SetLooping(*looping);
 	}
 
-	static void AudioSourceComponent_GetSpatialization(uint64_t entityID, bool* outSpatialization)
+	static void AudioSourceComponent_GetSpatialization(uint64_t handle, bool* outSpatialization)
 	{
 		ARC_PROFILE_SCOPE()
 
-		*outSpatialization = GetEntity(entityID).GetComponent<AudioSourceComponent>().Config.Spatialization;
+		*outSpatialization = GetEntity(handle).GetComponent<AudioSourceComponent>().Config.Spatialization;
 	}
 
-	static void AudioSourceComponent_SetSpatialization(uint64_t entityID, const bool* spatialization)
+	static void AudioSourceComponent_SetSpatialization(uint64_t handle, const bool* spatialization)
 	{
 		ARC_PROFILE_SCOPE()
 
-		auto& component = GetEntity(entityID).GetComponent<AudioSourceComponent>();
+		auto& component = GetEntity(handle).GetComponent<AudioSourceComponent>();
 		component.Config.Spatialization = *spatialization;
 		if (component.Source)
 			component.Source->SetSpatialization(*spatialization);
 	}
 
-	static void AudioSourceComponent_GetAttenuationModel(uint64_t entityID, int* outAttenuationModel)
+	static void AudioSourceComponent_GetAttenuationModel(uint64_t handle, int* outAttenuationModel)
 	{
 		ARC_PROFILE_SCOPE()
 
-		*outAttenuationModel = static_cast<int>(GetEntity(entityID).GetComponent<AudioSourceComponent>().Config.AttenuationModel);
+		*outAttenuationModel = static_cast<int>(GetEntity(handle).GetComponent<AudioSourceComponent>().Config.AttenuationModel);
 	}
 
-	static void AudioSourceComponent_SetAttenuationModel(uint64_t entityID, const int* attenuationModel)
+	static void AudioSourceComponent_SetAttenuationModel(uint64_t handle, const int* attenuationModel)
 	{
 		ARC_PROFILE_SCOPE()
 
-		auto& component = GetEntity(entityID).GetComponent<AudioSourceComponent>();
+		auto& component = GetEntity(handle).GetComponent<AudioSourceComponent>();
 		component.Config.AttenuationModel = static_cast<AttenuationModelType>(*attenuationModel);
 		if (component.Source)
 			component.Source->SetAttenuationModel(component.Config.AttenuationModel);
 	}
 
-	static void AudioSourceComponent_GetRollOff(uint64_t entityID, float* outRollOff)
+	static void AudioSourceComponent_GetRollOff(uint64_t handle, float* outRollOff)
 	{
 		ARC_PROFILE_SCOPE()
 
-		*outRollOff = GetEntity(entityID).GetComponent<AudioSourceComponent>().Config.RollOff;
+		*outRollOff = GetEntity(handle).GetComponent<AudioSourceComponent>().Config.RollOff;
 	}
 
-	static void AudioSourceComponent_SetRollOff(uint64_t entityID, const float* rollOff)
+	static void AudioSourceComponent_SetRollOff(uint64_t handle, const float* rollOff)
 	{
 		ARC_PROFILE_SCOPE()
 
-		auto& component = GetEntity(entityID).GetComponent<AudioSourceComponent>();
+		auto& component = GetEntity(handle).GetComponent<AudioSourceComponent>();
 		component.Config.RollOff = *rollOff;
 		if (component.Source)
 			component.Source->SetRollOff(*rollOff);
 	}
 
-	static void AudioSourceComponent_GetMinGain(uint64_t entityID, float* outMinGain)
+	static void AudioSourceComponent_GetMinGain(uint64_t handle, float* outMinGain)
 	{
 		ARC_PROFILE_SCOPE()
 
-		*outMinGain = GetEntity(entityID).GetComponent<AudioSourceComponent>().Config.MinGain;
+		*outMinGain = GetEntity(handle).GetComponent<AudioSourceComponent>().Config.MinGain;
 	}
 
-	static void AudioSourceComponent_SetMinGain(uint64_t entityID, const float* minGain)
+	static void AudioSourceComponent_SetMinGain(uint64_t handle, const float* minGain)
 	{
 		ARC_PROFILE_SCOPE()
 
-		auto& component = GetEntity(entityID).GetComponent<AudioSourceComponent>();
+		auto& component = GetEntity(handle).GetComponent<AudioSourceComponent>();
 		component.Config.MinGain = *minGain;
 		if (component.Source)
 			component.Source->SetMinGain(*minGain);
 	}
 
-	static void AudioSourceComponent_GetMaxGain(uint64_t entityID, float* outMaxGain)
+	static void AudioSourceComponent_GetMaxGain(uint64_t handle, float* outMaxGain)
 	{
 		ARC_PROFILE_SCOPE()
 
-		*outMaxGain = GetEntity(entityID).GetComponent<AudioSourceComponent>().Config.MaxGain;
+		*outMaxGain = GetEntity(handle).GetComponent<AudioSourceComponent>().Config.MaxGain;
 	}
 
-	static void AudioSourceComponent_SetMaxGain(uint64_t entityID, const float* maxGain)
+	static void AudioSourceComponent_SetMaxGain(uint64_t handle, const float* maxGain)
 	{
 		ARC_PROFILE_SCOPE()
 
-		auto& component = GetEntity(entityID).GetComponent<AudioSourceComponent>();
+		auto& component = GetEntity(handle).GetComponent<AudioSourceComponent>();
 		component.Config.MaxGain = *maxGain;
 		if (component.Source)
 			component.Source->SetMaxGain(*maxGain);
 	}
 
-	static void AudioSourceComponent_GetMinDistance(uint64_t entityID, float* outMinDistance)
+	static void AudioSourceComponent_GetMinDistance(uint64_t handle, float* outMinDistance)
 	{
 		ARC_PROFILE_SCOPE()
 
-		*outMinDistance = GetEntity(entityID).GetComponent<AudioSourceComponent>().Config.MinDistance;
+		*outMinDistance = GetEntity(handle).GetComponent<AudioSourceComponent>().Config.MinDistance;
 	}
 
-	static void AudioSourceComponent_SetMinDistance(uint64_t entityID, const float* minDistance)
+	static void AudioSourceComponent_SetMinDistance(uint64_t handle, const float* minDistance)
 	{
 		ARC_PROFILE_SCOPE()
 
-		auto& component = GetEntity(entityID).GetComponent<AudioSourceComponent>();
+		auto& component = GetEntity(handle).GetComponent<AudioSourceComponent>();
 		component.Config.MinDistance = *minDistance;
 		if (component.Source)
 			component.Source->SetMinDistance(*minDistance);
 	}
 
-	static void AudioSourceComponent_GetMaxDistance(uint64_t entityID, float* outMaxDistance)
+	static void AudioSourceComponent_GetMaxDistance(uint64_t handle, float* outMaxDistance)
 	{
 		ARC_PROFILE_SCOPE()
 
-		*outMaxDistance = GetEntity(entityID).GetComponent<AudioSourceComponent>().Config.MaxDistance;
+		*outMaxDistance = GetEntity(handle).GetComponent<AudioSourceComponent>().Config.MaxDistance;
 	}
 
-	static void AudioSourceComponent_SetMaxDistance(uint64_t entityID, const float* maxDistance)
+	static void AudioSourceComponent_SetMaxDistance(uint64_t handle, const float* maxDistance)
 	{
 		ARC_PROFILE_SCOPE()
 
-		auto& component = GetEntity(entityID).GetComponent<AudioSourceComponent>();
+		auto& component = GetEntity(handle).GetComponent<AudioSourceComponent>();
 		component.Config.MaxDistance = *maxDistance;
 		if (component.Source)
 			component.Source->SetMaxDistance(*maxDistance);
 	}
 
-	static void AudioSourceComponent_GetConeInnerAngle(uint64_t entityID, float* outConeInnerAngle)
+	static void AudioSourceComponent_GetConeInnerAngle(uint64_t handle, float* outConeInnerAngle)
 	{
 		ARC_PROFILE_SCOPE()
 
-		*outConeInnerAngle = GetEntity(entityID).GetComponent<AudioSourceComponent>().Config.ConeInnerAngle;
+		*outConeInnerAngle = GetEntity(handle).GetComponent<AudioSourceComponent>().Config.ConeInnerAngle;
 	}
 
-	static void AudioSourceComponent_SetConeInnerAngle(uint64_t entityID, const float* coneInnerAngle)
+	static void AudioSourceComponent_SetConeInnerAngle(uint64_t handle, const float* coneInnerAngle)
 	{
 		ARC_PROFILE_SCOPE()
 
-		auto& component = GetEntity(entityID).GetComponent<AudioSourceComponent>();
+		auto& component = GetEntity(handle).GetComponent<AudioSourceComponent>();
 		component.Config.ConeInnerAngle = *coneInnerAngle;
 		if (component.Source)
 			component.Source->SetCone(component.Config.ConeInnerAngle, component.Config.ConeOuterAngle, component.Config.ConeOuterGain);
 	}
 
-	static void AudioSourceComponent_GetConeOuterAngle(uint64_t entityID, float* outConeOuterAngle)
+	static void AudioSourceComponent_GetConeOuterAngle(uint64_t handle, float* outConeOuterAngle)
 	{
 		ARC_PROFILE_SCOPE()
 
-		*outConeOuterAngle = GetEntity(entityID).GetComponent<AudioSourceComponent>().Config.ConeOuterAngle;
+		*outConeOuterAngle = GetEntity(handle).GetComponent<AudioSourceComponent>().Config.ConeOuterAngle;
 	}
 
-	static void AudioSourceComponent_SetConeOuterAngle(uint64_t entityID, const float* coneOuterAngle)
+	static void AudioSourceComponent_SetConeOuterAngle(uint64_t handle, const float* coneOuterAngle)
 	{
 		ARC_PROFILE_SCOPE()
 
-		auto& component = GetEntity(entityID).GetComponent<AudioSourceComponent>();
+		auto& component = GetEntity(handle).GetComponent<AudioSourceComponent>();
 		component.Config.ConeOuterAngle = *coneOuterAngle;
 		if (component.Source)
 			component.Source->SetCone(component.Config.ConeInnerAngle, component.Config.ConeOuterAngle, component.Config.ConeOuterGain);
 	}
 
-	static void AudioSourceComponent_GetConeOuterGain(uint64_t entityID, float* outConeOuterGain)
+	static void AudioSourceComponent_GetConeOuterGain(uint64_t handle, float* outConeOuterGain)
 	{
 		ARC_PROFILE_SCOPE()
 
-		*outConeOuterGain = GetEntity(entityID).GetComponent<AudioSourceComponent>().Config.ConeOuterGain;
+		*outConeOuterGain = GetEntity(handle).GetComponent<AudioSourceComponent>().Config.ConeOuterGain;
 	}
 
-	static void AudioSourceComponent_SetConeOuterGain(uint64_t entityID, const float* coneOuterGain)
+	static void AudioSourceComponent_SetConeOuterGain(uint64_t handle, const float* coneOuterGain)
 	{
 		ARC_PROFILE_SCOPE()
 
-		auto& component = GetEntity(entityID).GetComponent<AudioSourceComponent>();
+		auto& component = GetEntity(handle).GetComponent<AudioSourceComponent>();
 		component.Config.ConeOuterGain = *coneOuterGain;
 		if (component.Source)
 			component.Source->SetCone(component.Config.ConeInnerAngle, component.Config.ConeOuterAngle, component.Config.ConeOuterGain);
 	}
 
-	static void AudioSourceComponent_SetCone(uint64_t entityID, const float* coneInnerAngle, const float* coneOuterAngle, const float* coneOuterGain)
+	static void AudioSourceComponent_SetCone(uint64_t handle, const float* coneInnerAngle, const float* coneOuterAngle, const float* coneOuterGain)
 	{
 		ARC_PROFILE_SCOPE()
 
-		auto& component = GetEntity(entityID).GetComponent<AudioSourceComponent>();
+		auto& component = GetEntity(handle).GetComponent<AudioSourceComponent>();
 		component.Config.ConeInnerAngle = *coneInnerAngle;
 		component.Config.ConeOuterAngle = *coneOuterAngle;
 		component.Config.ConeOuterGain = *coneOuterGain;
@@ -941,66 +1117,66 @@ namespace ArcEngine
 			component.Source->SetCone(component.Config.ConeInnerAngle, component.Config.ConeOuterAngle, component.Config.ConeOuterGain);
 	}
 
-	static void AudioSourceComponent_GetDopplerFactor(uint64_t entityID, float* outDopplerFactor)
+	static void AudioSourceComponent_GetDopplerFactor(uint64_t handle, float* outDopplerFactor)
 	{
 		ARC_PROFILE_SCOPE()
 
-		*outDopplerFactor = GetEntity(entityID).GetComponent<AudioSourceComponent>().Config.DopplerFactor;
+		*outDopplerFactor = GetEntity(handle).GetComponent<AudioSourceComponent>().Config.DopplerFactor;
 	}
 
-	static void AudioSourceComponent_SetDopplerFactor(uint64_t entityID, const float* dopplerFactor)
+	static void AudioSourceComponent_SetDopplerFactor(uint64_t handle, const float* dopplerFactor)
 	{
 		ARC_PROFILE_SCOPE()
 
-		auto& component = GetEntity(entityID).GetComponent<AudioSourceComponent>();
+		auto& component = GetEntity(handle).GetComponent<AudioSourceComponent>();
 		component.Config.DopplerFactor = *dopplerFactor;
 		if (component.Source)
 			component.Source->SetDopplerFactor(*dopplerFactor);
 	}
 
-	static void AudioSourceComponent_IsPlaying(uint64_t entityID, bool* outIsPlaying)
+	static void AudioSourceComponent_IsPlaying(uint64_t handle, bool* outIsPlaying)
 	{
 		ARC_PROFILE_SCOPE()
 
-		const auto& component = GetEntity(entityID).GetComponent<AudioSourceComponent>();
+		const auto& component = GetEntity(handle).GetComponent<AudioSourceComponent>();
 		if (component.Source)
 			*outIsPlaying = component.Source->IsPlaying();
 		else
 			*outIsPlaying = false;
 	}
 
-	static void AudioSourceComponent_Play(uint64_t entityID)
+	static void AudioSourceComponent_Play(uint64_t handle)
 	{
 		ARC_PROFILE_SCOPE()
 
-		const auto& component = GetEntity(entityID).GetComponent<AudioSourceComponent>();
+		const auto& component = GetEntity(handle).GetComponent<AudioSourceComponent>();
 		if (component.Source)
 			component.Source->Play();
 	}
 
-	static void AudioSourceComponent_Pause(uint64_t entityID)
+	static void AudioSourceComponent_Pause(uint64_t handle)
 	{
 		ARC_PROFILE_SCOPE()
 
-		const auto& component = GetEntity(entityID).GetComponent<AudioSourceComponent>();
+		const auto& component = GetEntity(handle).GetComponent<AudioSourceComponent>();
 		if (component.Source)
 			component.Source->Pause();
 	}
 
-	static void AudioSourceComponent_UnPause(uint64_t entityID)
+	static void AudioSourceComponent_UnPause(uint64_t handle)
 	{
 		ARC_PROFILE_SCOPE()
 
-		const auto& component = GetEntity(entityID).GetComponent<AudioSourceComponent>();
+		const auto& component = GetEntity(handle).GetComponent<AudioSourceComponent>();
 		if (component.Source)
 			component.Source->UnPause();
 	}
 
-	static void AudioSourceComponent_Stop(uint64_t entityID)
+	static void AudioSourceComponent_Stop(uint64_t handle)
 	{
 		ARC_PROFILE_SCOPE()
 
-		const auto& component = GetEntity(entityID).GetComponent<AudioSourceComponent>();
+		const auto& component = GetEntity(handle).GetComponent<AudioSourceComponent>();
 		if (component.Source)
 			component.Source->Stop();
 	}
@@ -1021,6 +1197,8 @@ namespace ArcEngine
 		mono_add_internal_call("ArcEngine.InternalCalls::Entity_AddComponent", reinterpret_cast<void*>(&ScriptEngineRegistry::AddComponent));
 		mono_add_internal_call("ArcEngine.InternalCalls::Entity_HasComponent", reinterpret_cast<void*>(&ScriptEngineRegistry::HasComponent));
 		mono_add_internal_call("ArcEngine.InternalCalls::Entity_GetComponent", reinterpret_cast<void*>(&ScriptEngineRegistry::GetComponent));
+		ARC_ADD_INTERNAL_CALL(Entity_GetHandle);
+		mono_add_internal_call("ArcEngine.InternalCalls::Scene_Query", reinterpret_cast<void*>(&ScriptEngineRegistry::Query));
 
 		///////////////////////////////////////////////////////////////
 		// Tag ////////////////////////////////////////////////////////
@@ -1039,6 +1217,12 @@ namespace ArcEngine
 		ARC_ADD_INTERNAL_CALL(TransformComponent_SetRotation);
 		ARC_ADD_INTERNAL_CALL(TransformComponent_GetScale);
 		ARC_ADD_INTERNAL_CALL(TransformComponent_SetScale);
+		ARC_ADD_INTERNAL_CALL(TransformComponent_GetTransforms);
+		ARC_ADD_INTERNAL_CALL(TransformComponent_SetTransforms);
+		ARC_ADD_INTERNAL_CALL(TransformComponent_GetTranslations);
+		ARC_ADD_INTERNAL_CALL(TransformComponent_SetTranslations);
+		ARC_ADD_INTERNAL_CALL(TransformComponent_GetRotations);
+		ARC_ADD_INTERNAL_CALL(TransformComponent_SetRotations);
 
 		///////////////////////////////////////////////////////////////
 		// Input //////////////////////////////////////////////////////
@@ -1095,6 +1279,8 @@ namespace ArcEngine
 		ARC_ADD_INTERNAL_CALL(Rigidbody2DComponent_MoveRotation);
 		ARC_ADD_INTERNAL_CALL(Rigidbody2DComponent_GetVelocity);
 		ARC_ADD_INTERNAL_CALL(Rigidbody2DComponent_SetVelocity);
+		ARC_ADD_INTERNAL_CALL(Rigidbody2DComponent_GetVelocities);
+		ARC_ADD_INTERNAL_CALL(Rigidbody2DComponent_SetVelocities);
 		ARC_ADD_INTERNAL_CALL(Rigidbody2DComponent_GetAngularVelocity);
 		ARC_ADD_INTERNAL_CALL(Rigidbody2DComponent_SetAngularVelocity);
 		ARC_ADD_INTERNAL_CALL(Rigidbody2DComponent_Sleep);
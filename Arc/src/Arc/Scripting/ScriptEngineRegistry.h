@@ -1,11 +1,15 @@
 #pragma once
 
+#include <entt.hpp>
+
 typedef struct _MonoType MonoType;
 typedef struct _MonoObject MonoObject;
+typedef struct _MonoArray MonoArray;
 
 namespace ArcEngine
 {
 	class Entity;
+	class Scene;
 	template<typename... Component>
 	struct ComponentGroup;
 
@@ -21,9 +25,10 @@ namespace ArcEngine
 	private:
 		static void InitComponentTypes();
 		static void InitScriptComponentTypes();
-		static void AddComponent(uint64_t entityID, void* type);
-		static bool HasComponent(uint64_t entityID, void* type);
-		[[nodiscard]] static MonoObject* GetComponent(uint64_t entityID, void* type);
+		static void AddComponent(uint64_t handle, void* type);
+		static bool HasComponent(uint64_t handle, void* type);
+		[[nodiscard]] static MonoObject* GetComponent(uint64_t handle, void* type);
+		[[nodiscard]] static MonoArray* Query(MonoArray* types, MonoArray** outEntityIDs);
 
 		template<typename... Component>
 		static void RegisterComponent();
@@ -31,8 +36,15 @@ namespace ArcEngine
 		static void RegisterComponent(ComponentGroup<Component...>);
 		static void RegisterScriptComponent(const std::string& className);
 
-		static std::unordered_map<MonoType*, std::function<bool(const Entity&, MonoType*)>> s_HasComponentFuncs;
-		static std::unordered_map<MonoType*, std::function<void(const Entity&, MonoType*)>> s_AddComponentFuncs;
-		static std::unordered_map<MonoType*, std::function<GCHandle(const Entity&, MonoType*)>> s_GetComponentFuncs;
+		// Plain function pointers, none of the registered lambdas capture anything
+		using HasComponentFunc = bool(*)(const Entity&, MonoType*);
+		using AddComponentFunc = void(*)(const Entity&, MonoType*);
+		using GetComponentFunc = GCHandle(*)(const Entity&, MonoType*);
+		using GetStorageFunc = entt::sparse_set&(*)(Scene&);
+
+		static std::unordered_map<MonoType*, HasComponentFunc> s_HasComponentFuncs;
+		static std::unordered_map<MonoType*, AddComponentFunc> s_AddComponentFuncs;
+		static std::unordered_map<MonoType*, GetComponentFunc> s_GetComponentFuncs;
+		static std::unordered_map<MonoType*, GetStorageFunc> s_GetStorageFuncs;		// Built-in components only, for queries
 	};
 }
@@ -10,10 +10,57 @@ namespace ArcEngine
 			: Min(min), Max(max)
 		{
 		}
-		
+
 		glm::vec3 Min;
 		glm::vec3 Max;
 
 		[[nodiscard]] glm::vec3 GetPosition() const { return glm::vec3(Max.x - Min.x, Max.y - Min.y, Max.z - Min.z) * 0.5f; }
+		[[nodiscard]] glm::vec3 GetCenter() const { return (Min + Max) * 0.5f; }
+		[[nodiscard]] glm::vec3 GetExtents() const { return (Max - Min) * 0.5f; }
+		[[nodiscard]] bool IsValid() const { return Min.x <= Max.x && Min.y <= Max.y && Min.z <= Max.z; }
+
+		// Half of the surface area, used as the cost metric when building trees
+		[[nodiscard]] float GetPerimeter() const
+		{
+			const glm::vec3 d = Max - Min;
+			return d.x * d.y + d.y * d.z + d.z * d.x;
+		}
+
+		[[nodiscard]] bool Contains(const AABB& other) const
+		{
+			return Min.x <= other.Min.x && Min.y <= other.Min.y && Min.z <= other.Min.z
+				&& other.Max.x <= Max.x && other.Max.y <= Max.y && other.Max.z <= Max.z;
+		}
+
+		[[nodiscard]] bool Overlaps(const AABB& other) const
+		{
+			return Min.x <= other.Max.x && Max.x >= other.Min.x
+				&& Min.y <= other.Max.y && Max.y >= other.Min.y
+				&& Min.z <= other.Max.z && Max.z >= other.Min.z;
+		}
+
+		void Expand(const glm::vec3& point)
+		{
+			Min = glm::min(Min, point);
+			Max = glm::max(Max, point);
+		}
+
+		[[nodiscard]] static AABB Merge(const AABB& a, const AABB& b)
+		{
+			return { glm::min(a.Min, b.Min), glm::max(a.Max, b.Max) };
+		}
+
+		// Bounds of this box after the transform, without transforming all eight corners
+		[[nodiscard]] AABB Transform(const glm::mat4& transform) const
+		{
+			const glm::vec3 center = glm::vec3(transform * glm::vec4(GetCenter(), 1.0f));
+			const glm::vec3 extents = GetExtents();
+			const glm::vec3 worldExtents =
+				glm::abs(glm::vec3(transform[0])) * extents.x +
+				glm::abs(glm::vec3(transform[1])) * extents.y +
+				glm::abs(glm::vec3(transform[2])) * extents.z;
+
+			return { center - worldExtents, center + worldExtents };
+		}
 	};
 }
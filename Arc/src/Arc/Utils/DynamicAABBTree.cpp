@@ -0,0 +1,351 @@
+#include "arcpch.h"
+#include "Arc/Utils/DynamicAABBTree.h"
+
+namespace ArcEngine
+{
+	DynamicAABBTree::DynamicAABBTree(float margin)
+		: m_Margin(margin)
+	{
+	}
+
+	int32_t DynamicAABBTree::CreateProxy(const AABB& aabb, uint32_t userData)
+	{
+		ARC_PROFILE_SCOPE()
+
+		const int32_t proxyId = AllocateNode();
+
+		Node& node = m_Nodes[proxyId];
+		node.Bounds = AABB(aabb.Min - glm::vec3(m_Margin), aabb.Max + glm::vec3(m_Margin));
+		node.UserData = userData;
+		node.Height = 0;
+
+		InsertLeaf(proxyId);
+		++m_ProxyCount;
+
+		return proxyId;
+	}
+
+	void DynamicAABBTree::DestroyProxy(int32_t proxyId)
+	{
+		ARC_PROFILE_SCOPE()
+
+		ARC_CORE_ASSERT(proxyId >= 0 && static_cast<size_t>(proxyId) < m_Nodes.size() && m_Nodes[proxyId].IsLeaf())
+
+		RemoveLeaf(proxyId);
+		FreeNode(proxyId);
+		--m_ProxyCount;
+	}
+
+	bool DynamicAABBTree::MoveProxy(int32_t proxyId, const AABB& aabb)
+	{
+		ARC_PROFILE_SCOPE()
+
+		ARC_CORE_ASSERT(proxyId >= 0 && static_cast<size_t>(proxyId) < m_Nodes.size() && m_Nodes[proxyId].IsLeaf())
+
+		const AABB fatAABB(aabb.Min - glm::vec3(m_Margin), aabb.Max + glm::vec3(m_Margin));
+		const AABB& treeAABB = m_Nodes[proxyId].Bounds;
+		if (treeAABB.Contains(aabb))
+		{
+			// Still fits, unless the fat box has become far too large for the object
+			const AABB hugeAABB(fatAABB.Min - glm::vec3(4.0f * m_Margin), fatAABB.Max + glm::vec3(4.0f * m_Margin));
+			if (hugeAABB.Contains(treeAABB))
+				return false;
+		}
+
+		RemoveLeaf(proxyId);
+		m_Nodes[proxyId].Bounds = fatAABB;
+		InsertLeaf(proxyId);
+
+		return true;
+	}
+
+	void DynamicAABBTree::Clear()
+	{
+		ARC_PROFILE_SCOPE()
+
+		m_Nodes.clear();
+		m_Root = NullNode;
+		m_FreeList = NullNode;
+		m_ProxyCount = 0;
+	}
+
+	int32_t DynamicAABBTree::AllocateNode()
+	{
+		if (m_FreeList == NullNode)
+		{
+			m_Nodes.emplace_back();
+			return static_cast<int32_t>(m_Nodes.size() - 1);
+		}
+
+		const int32_t nodeId = m_FreeList;
+		m_FreeList = m_Nodes[nodeId].ParentOrNext;
+
+		m_Nodes[nodeId] = Node();
+		return nodeId;
+	}
+
+	void DynamicAABBTree::FreeNode(int32_t nodeId)
+	{
+		Node& node = m_Nodes[nodeId];
+		node.ParentOrNext = m_FreeList;
+		node.Child1 = NullNode;
+		node.Child2 = NullNode;
+		node.Height = -1;
+		m_FreeList = nodeId;
+	}
+
+	void DynamicAABBTree::InsertLeaf(int32_t leaf)
+	{
+		ARC_PROFILE_SCOPE()
+
+		if (m_Root == NullNode)
+		{
+			m_Root = leaf;
+			m_Nodes[m_Root].ParentOrNext = NullNode;
+			return;
+		}
+
+		// Find the best sibling by walking down the cheapest path
+		const AABB leafAABB = m_Nodes[leaf].Bounds;
+		int32_t index = m_Root;
+		while (!m_Nodes[index].IsLeaf())
+		{
+			const Node& node = m_Nodes[index];
+			const int32_t child1 = node.Child1;
+			const int32_t child2 = node.Child2;
+
+			const float area = node.Bounds.GetPerimeter();
+			const float combinedArea = AABB::Merge(node.Bounds, leafAABB).GetPerimeter();
+
+			// Cost of creating a new parent for this node and the new leaf
+			const float cost = 2.0f * combinedArea;
+
+			// Minimum cost of pushing the leaf further down the tree
+			const float inheritanceCost = 2.0f * (combinedArea - area);
+
+			const auto descendCost = [&](int32_t child)
+			{
+				const AABB aabb = AABB::Merge(leafAABB, m_Nodes[child].Bounds);
+				if (m_Nodes[child].IsLeaf())
+					return aabb.GetPerimeter() + inheritanceCost;
+
+				return aabb.GetPerimeter() - m_Nodes[child].Bounds.GetPerimeter() + inheritanceCost;
+			};
+
+			const float cost1 = descendCost(child1);
+			const float cost2 = descendCost(child2);
+
+			if (cost < cost1 && cost < cost2)
+				break;
+
+			index = cost1 < cost2 ? child1 : child2;
+		}
+
+		const int32_t sibling = index;
+
+		// Create a new parent
+		const int32_t oldParent = m_Nodes[sibling].ParentOrNext;
+		const int32_t newParent = AllocateNode();
+		{
+			Node& parentNode = m_Nodes[newParent];
+			parentNode.ParentOrNext = oldParent;
+			parentNode.Bounds = AABB::Merge(leafAABB, m_Nodes[sibling].Bounds);
+			parentNode.Height = m_Nodes[sibling].Height + 1;
+			parentNode.Child1 = sibling;
+			parentNode.Child2 = leaf;
+		}
+
+		if (oldParent != NullNode)
+		{
+			if (m_Nodes[oldParent].Child1 == sibling)
+				m_Nodes[oldParent].Child1 = newParent;
+			else
+				m_Nodes[oldParent].Child2 = newParent;
+		}
+		else
+		{
+			m_Root = newParent;
+		}
+
+		m_Nodes[sibling].ParentOrNext = newParent;
+		m_Nodes[leaf].ParentOrNext = newParent;
+
+		RefitAncestors(m_Nodes[leaf].ParentOrNext);
+	}
+
+	void DynamicAABBTree::RemoveLeaf(int32_t leaf)
+	{
+		ARC_PROFILE_SCOPE()
+
+		if (leaf == m_Root)
+		{
+			m_Root = NullNode;
+			return;
+		}
+
+		const int32_t parent = m_Nodes[leaf].ParentOrNext;
+		const int32_t grandParent = m_Nodes[parent].ParentOrNext;
+		const int32_t sibling = m_Nodes[parent].Child1 == leaf ? m_Nodes[parent].Child2 : m_Nodes[parent].Child1;
+
+		if (grandParent != NullNode)
+		{
+			// Destroy the parent and connect the sibling to the grand parent
+			if (m_Nodes[grandParent].Child1 == parent)
+				m_Nodes[grandParent].Child1 = sibling;
+			else
+				m_Nodes[grandParent].Child2 = sibling;
+
+			m_Nodes[sibling].ParentOrNext = grandParent;
+			FreeNode(parent);
+
+			RefitAncestors(grandParent);
+		}
+		else
+		{
+			m_Root = sibling;
+			m_Nodes[sibling].ParentOrNext = NullNode;
+			FreeNode(parent);
+		}
+	}
+
+	void DynamicAABBTree::RefitAncestors(int32_t nodeId)
+	{
+		int32_t index = nodeId;
+		while (index != NullNode)
+		{
+			index = Balance(index);
+
+			Node& node = m_Nodes[index];
+			const Node& child1 = m_Nodes[node.Child1];
+			const Node& child2 = m_Nodes[node.Child2];
+
+			node.Height = 1 + glm::max(child1.Height, child2.Height);
+			node.Bounds = AABB::Merge(child1.Bounds, child2.Bounds);
+
+			index = node.ParentOrNext;
+		}
+	}
+
+	// Performs a left or right rotation if node A is imbalanced, returns the new root of the subtree
+	int32_t DynamicAABBTree::Balance(int32_t iA)
+	{
+		Node* A = &m_Nodes[iA];
+		if (A->IsLeaf() || A->Height < 2)
+			return iA;
+
+		const int32_t iB = A->Child1;
+		const int32_t iC = A->Child2;
+		Node* B = &m_Nodes[iB];
+		Node* C = &m_Nodes[iC];
+
+		const int32_t balance = C->Height - B->Height;
+
+		// Rotate C up
+		if (balance > 1)
+		{
+			const int32_t iF = C->Child1;
+			const int32_t iG = C->Child2;
+			Node* F = &m_Nodes[iF];
+			Node* G = &m_Nodes[iG];
+
+			// Swap A and C
+			C->Child1 = iA;
+			C->ParentOrNext = A->ParentOrNext;
+			A->ParentOrNext = iC;
+
+			// A's old parent should point to C
+			if (C->ParentOrNext != NullNode)
+			{
+				if (m_Nodes[C->ParentOrNext].Child1 == iA)
+					m_Nodes[C->ParentOrNext].Child1 = iC;
+				else
+					m_Nodes[C->ParentOrNext].Child2 = iC;
+			}
+			else
+			{
+				m_Root = iC;
+			}
+
+			// Rotate
+			if (F->Height > G->Height)
+			{
+				C->Child2 = iF;
+				A->Child2 = iG;
+				G->ParentOrNext = iA;
+				A->Bounds = AABB::Merge(B->Bounds, G->Bounds);
+				C->Bounds = AABB::Merge(A->Bounds, F->Bounds);
+
+				A->Height = 1 + glm::max(B->Height, G->Height);
+				C->Height = 1 + glm::max(A->Height, F->Height);
+			}
+			else
+			{
+				C->Child2 = iG;
+				A->Child2 = iF;
+				F->ParentOrNext = iA;
+				A->Bounds = AABB::Merge(B->Bounds, F->Bounds);
+				C->Bounds = AABB::Merge(A->Bounds, G->Bounds);
+
+				A->Height = 1 + glm::max(B->Height, F->Height);
+				C->Height = 1 + glm::max(A->Height, G->Height);
+			}
+
+			return iC;
+		}
+
+		// Rotate B up
+		if (balance < -1)
+		{
+			const int32_t iD = B->Child1;
+			const int32_t iE = B->Child2;
+			Node* D = &m_Nodes[iD];
+			Node* E = &m_Nodes[iE];
+
+			// Swap A and B
+			B->Child1 = iA;
+			B->ParentOrNext = A->ParentOrNext;
+			A->ParentOrNext = iB;
+
+			// A's old parent should point to B
+			if (B->ParentOrNext != NullNode)
+			{
+				if (m_Nodes[B->ParentOrNext].Child1 == iA)
+					m_Nodes[B->ParentOrNext].Child1 = iB;
+				else
+					m_Nodes[B->ParentOrNext].Child2 = iB;
+			}
+			else
+			{
+				m_Root = iB;
+			}
+
+			// Rotate
+			if (D->Height > E->Height)
+			{
+				B->Child2 = iD;
+				A->Child1 = iE;
+				E->ParentOrNext = iA;
+				A->Bounds = AABB::Merge(C->Bounds, E->Bounds);
+				B->Bounds = AABB::Merge(A->Bounds, D->Bounds);
+
+				A->Height = 1 + glm::max(C->Height, E->Height);
+				B->Height = 1 + glm::max(A->Height, D->Height);
+			}
+			else
+			{
+				B->Child2 = iE;
+				A->Child1 = iD;
+				D->ParentOrNext = iA;
+				A->Bounds = AABB::Merge(C->Bounds, D->Bounds);
+				B->Bounds = AABB::Merge(A->Bounds, E->Bounds);
+
+				A->Height = 1 + glm::max(C->Height, D->Height);
+				B->Height = 1 + glm::max(A->Height, E->Height);
+			}
+
+			return iB;
+		}
+
+		return iA;
+	}
+}
@@ -0,0 +1,157 @@
+#pragma once
+
+#include "Arc/Utils/AABB.h"
+#include "Arc/Utils/Frustum.h"
+
+namespace ArcEngine
+{
+	// Bounding volume hierarchy that supports inserting, moving and removing proxies without a rebuild.
+	// Leaves store a fattened AABB so that small movements do not touch the tree, and the tree is kept
+	// balanced with AVL style rotations on insertion and removal.
+	class DynamicAABBTree
+	{
+	public:
+		static constexpr int32_t NullNode = -1;
+
+		explicit DynamicAABBTree(float margin = 0.1f);
+
+		[[nodiscard]] int32_t CreateProxy(const AABB& aabb, uint32_t userData);
+		void DestroyProxy(int32_t proxyId);
+
+		// Returns true if the proxy had to be reinserted
+		bool MoveProxy(int32_t proxyId, const AABB& aabb);
+
+		void Clear();
+
+		[[nodiscard]] uint32_t GetUserData(int32_t proxyId) const { return m_Nodes[proxyId].UserData; }
+		[[nodiscard]] const AABB& GetFatAABB(int32_t proxyId) const { return m_Nodes[proxyId].Bounds; }
+		[[nodiscard]] size_t GetProxyCount() const { return m_ProxyCount; }
+		[[nodiscard]] int32_t GetHeight() const { return m_Root == NullNode ? 0 : m_Nodes[m_Root].Height; }
+
+		// Calls fn(userData) for every proxy whose fat AABB is at least partially inside the frustum.
+		// Subtrees that are entirely inside are reported without testing their children.
+		template<typename Fn>
+		void Query(const Frustum& frustum, Fn&& fn) const
+		{
+			ARC_PROFILE_SCOPE()
+
+			if (m_Root == NullNode)
+				return;
+
+			m_Stack.clear();
+			m_Stack.push_back(m_Root);
+			while (!m_Stack.empty())
+			{
+				const int32_t nodeId = m_Stack.back();
+				m_Stack.pop_back();
+
+				const Node& node = m_Nodes[nodeId];
+				const Frustum::Intersection intersection = frustum.Classify(node.Bounds);
+				if (intersection == Frustum::Intersection::Outside)
+					continue;
+
+				if (node.IsLeaf())
+				{
+					fn(node.UserData);
+				}
+				else if (intersection == Frustum::Intersection::Inside)
+				{
+					ReportSubtree(nodeId, fn);
+				}
+				else
+				{
+					m_Stack.push_back(node.Child1);
+					m_Stack.push_back(node.Child2);
+				}
+			}
+		}
+
+		template<typename Fn>
+		void Query(const AABB& aabb, Fn&& fn) const
+		{
+			ARC_PROFILE_SCOPE()
+
+			if (m_Root == NullNode)
+				return;
+
+			m_Stack.clear();
+			m_Stack.push_back(m_Root);
+			while (!m_Stack.empty())
+			{
+				const int32_t nodeId = m_Stack.back();
+				m_Stack.pop_back();
+
+				const Node& node = m_Nodes[nodeId];
+				if (!node.Bounds.Overlaps(aabb))
+					continue;
+
+				if (node.IsLeaf())
+				{
+					fn(node.UserData);
+				}
+				else
+				{
+					m_Stack.push_back(node.Child1);
+					m_Stack.push_back(node.Child2);
+				}
+			}
+		}
+
+	private:
+		struct Node
+		{
+			AABB Bounds;
+			uint32_t UserData = 0;
+
+			// Parent while in the tree, next free node while in the free list
+			int32_t ParentOrNext = NullNode;
+			int32_t Child1 = NullNode;
+			int32_t Child2 = NullNode;
+
+			// Leaf = 0, free node = -1
+			int32_t Height = -1;
+
+			[[nodiscard]] bool IsLeaf() const { return Child1 == NullNode; }
+		};
+
+		[[nodiscard]] int32_t AllocateNode();
+		void FreeNode(int32_t nodeId);
+
+		void InsertLeaf(int32_t leaf);
+		void RemoveLeaf(int32_t leaf);
+		[[nodiscard]] int32_t Balance(int32_t iA);
+		void RefitAncestors(int32_t nodeId);
+
+		template<typename Fn>
+		void ReportSubtree(int32_t root, Fn& fn) const
+		{
+			m_SubtreeStack.clear();
+			m_SubtreeStack.push_back(root);
+			while (!m_SubtreeStack.empty())
+			{
+				const Node& node = m_Nodes[m_SubtreeStack.back()];
+				m_SubtreeStack.pop_back();
+
+				if (node.IsLeaf())
+				{
+					fn(node.UserData);
+				}
+				else
+				{
+					m_SubtreeStack.push_back(node.Child1);
+					m_SubtreeStack.push_back(node.Child2);
+				}
+			}
+		}
+
+	private:
+		float m_Margin;
+		std::vector<Node> m_Nodes;
+		int32_t m_Root = NullNode;
+		int32_t m_FreeList = NullNode;
+		size_t m_ProxyCount = 0;
+
+		mutable std::vector<int32_t> m_Stack;
+		mutable std::vector<int32_t> m_SubtreeStack;
+	};
+}
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <glm/glm.hpp>
+
+#include "Arc/Utils/AABB.h"
+
+namespace ArcEngine
+{
+	struct Frustum
+	{
+		enum class Intersection { Outside = 0, Intersects, Inside };
+
+		// xyz: plane normal pointing inwards, w: distance
+		std::array<glm::vec4, 6> Planes;
+
+		Frustum() = default;
+
+		// Extracts the planes of an OpenGL style (-1..1 depth) clip space
+		explicit Frustum(const glm::mat4& viewProjection)
+		{
+			const glm::vec4 row0 = { viewProjection[0][0], viewProjection[1][0], viewProjection[2][0], viewProjection[3][0] };
+			const glm::vec4 row1 = { viewProjection[0][1], viewProjection[1][1], viewProjection[2][1], viewProjection[3][1] };
+			const glm::vec4 row2 = { viewProjection[0][2], viewProjection[1][2], viewProjection[2][2], viewProjection[3][2] };
+			const glm::vec4 row3 = { viewProjection[0][3], viewProjection[1][3], viewProjection[2][3], viewProjection[3][3] };
+
+			Planes[0] = row3 + row0;	// Left
+			Planes[1] = row3 - row0;	// Right
+			Planes[2] = row3 + row1;	// Bottom
+			Planes[3] = row3 - row1;	// Top
+			Planes[4] = row3 + row2;	// Near
+			Planes[5] = row3 - row2;	// Far
+
+			for (glm::vec4& plane : Planes)
+			{
+				const float length = glm::length(glm::vec3(plane));
+				if (length > 0.0f)
+					plane /= length;
+			}
+		}
+
+		[[nodiscard]] Intersection Classify(const AABB& aabb) const
+		{
+			const glm::vec3 center = aabb.GetCenter();
+			const glm::vec3 extents = aabb.GetExtents();
+
+			Intersection result = Intersection::Inside;
+			for (const glm::vec4& plane : Planes)
+			{
+				const glm::vec3 normal = glm::vec3(plane);
+				const float distance = glm::dot(normal, center) + plane.w;
+				const float radius = glm::dot(extents, glm::abs(normal));
+
+				if (distance < -radius)
+					return Intersection::Outside;
+				if (distance < radius)
+					result = Intersection::Intersects;
+			}
+
+			return result;
+		}
+
+		[[nodiscard]] bool IsVisible(const AABB& aabb) const
+		{
+			return Classify(aabb) != Intersection::Outside;
+		}
+	};
+}
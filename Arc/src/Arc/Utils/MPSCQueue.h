@@ -0,0 +1,79 @@
+#pragma once
+
+#include <atomic>
+
+namespace ArcEngine
+{
+	// Unbounded multi-producer single-consumer queue without locks.
+	// Producers only do one atomic exchange, and the consumer never waits on them: an item that is
+	// still being linked in by a producer simply shows up on the next TryPop.
+	template<typename T>
+	class MPSCQueue
+	{
+	public:
+		MPSCQueue()
+		{
+			Node* stub = new Node();
+			m_Head.store(stub, std::memory_order_relaxed);
+			m_Tail = stub;
+		}
+
+		~MPSCQueue()
+		{
+			T value;
+			while (TryPop(value))
+			{
+			}
+
+			delete m_Tail;
+		}
+
+		MPSCQueue(const MPSCQueue& other) = delete;
+		MPSCQueue(MPSCQueue&& other) = delete;
+
+		// Can be called from any thread
+		void Push(T value)
+		{
+			Node* node = new Node();
+			node->Value = std::move(value);
+
+			// Counted before the node is published, so the consumer can never decrement below zero
+			m_Size.fetch_add(1, std::memory_order_relaxed);
+			Node* previous = m_Head.exchange(node, std::memory_order_acq_rel);
+			previous->Next.store(node, std::memory_order_release);
+		}
+
+		// Must only be called from the consumer thread
+		bool TryPop(T& outValue)
+		{
+			Node* tail = m_Tail;
+			Node* next = tail->Next.load(std::memory_order_acquire);
+			if (!next)
+				return false;
+
+			// The popped node becomes the new stub
+			outValue = std::move(next->Value);
+			next->Value = T();
+			m_Tail = next;
+			m_Size.fetch_sub(1, std::memory_order_relaxed);
+
+			delete tail;
+			return true;
+		}
+
+		// Approximate while producers are pushing
+		[[nodiscard]] size_t GetSize() const { return m_Size.load(std::memory_order_relaxed); }
+
+	private:
+		struct Node
+		{
+			std::atomic<Node*> Next = nullptr;
+			T Value;
+		};
+
+		// Producers push at the head, the consumer pops from the tail
+		alignas(64) std::atomic<Node*> m_Head;
+		alignas(64) Node* m_Tail;
+		std::atomic<size_t> m_Size = 0;
+	};
+}
@@ -9,6 +9,7 @@
 #include "Arc/Core/Log.h"
 #include "Arc/Core/Assert.h"
 #include "Arc/Core/AssetManager.h"
+#include "Arc/Core/JobSystem.h"
 #include "Arc/Core/Window.h"
 
 #include "Arc/Core/Timestep.h"
@@ -25,6 +26,8 @@
 #include "Arc/Scene/Scene.h"
 #include "Arc/Scene/Entity.h"
 #include "Arc/Scene/Components.h"
+#include "Arc/Scene/SceneLoader.h"
+#include "Arc/Scene/SceneSnapshot.h"
 
 #include "Arc/Project/Project.h"
 
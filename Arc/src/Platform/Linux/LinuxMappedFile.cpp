@@ -0,0 +1,53 @@
+#include "arcpch.h"
+
+#ifdef ARC_PLATFORM_LINUX
+
+#include "Arc/Core/MappedFile.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace ArcEngine
+{
+	bool MappedFile::Open(const std::filesystem::path& filepath)
+	{
+		ARC_PROFILE_SCOPE()
+
+		Close();
+
+		const int fd = open(filepath.c_str(), O_RDONLY | O_CLOEXEC);
+		if (fd == -1)
+			return false;
+
+		struct stat status {};
+		if (fstat(fd, &status) != 0 || status.st_size <= 0)
+		{
+			close(fd);
+			return false;
+		}
+
+		void* data = mmap(nullptr, static_cast<size_t>(status.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+		close(fd);
+		if (data == MAP_FAILED)
+			return false;
+
+		madvise(data, static_cast<size_t>(status.st_size), MADV_SEQUENTIAL);
+
+		m_Data = static_cast<const uint8_t*>(data);
+		m_Size = static_cast<uint64_t>(status.st_size);
+		return true;
+	}
+
+	void MappedFile::Close()
+	{
+		if (m_Data)
+			munmap(const_cast<uint8_t*>(m_Data), m_Size);
+
+		m_Data = nullptr;
+		m_Size = 0;
+	}
+}
+
+#endif
@@ -0,0 +1,140 @@
+#include "arcpch.h"
+#include "Platform/Null/NullBuffer.h"
+
+#include "Platform/Null/NullRecorder.h"
+
+namespace ArcEngine
+{
+	/////////////////////////////////////////////////////////////////////////////
+	// VertexBuffer /////////////////////////////////////////////////////////////
+	/////////////////////////////////////////////////////////////////////////////
+
+	NullVertexBuffer::NullVertexBuffer(size_t size)
+		: m_RendererID(NullRecorder::GenerateID()), m_Size(size)
+	{
+		ARC_PROFILE_SCOPE()
+	}
+
+	NullVertexBuffer::NullVertexBuffer([[maybe_unused]] const float* vertices, size_t size)
+		: m_RendererID(NullRecorder::GenerateID()), m_Size(size)
+	{
+		ARC_PROFILE_SCOPE()
+
+		NullRecorder::Record(NullCommandType::UploadBuffer, m_RendererID, size);
+	}
+
+	void NullVertexBuffer::Bind() const
+	{
+	}
+
+	void NullVertexBuffer::Unbind() const
+	{
+	}
+
+	void NullVertexBuffer::SetData([[maybe_unused]] const void* data, uint32_t size)
+	{
+		ARC_PROFILE_SCOPE()
+
+		ARC_CORE_ASSERT(size <= m_Size, "Data does not fit in the vertex buffer!")
+		NullRecorder::Record(NullCommandType::UploadBuffer, m_RendererID, size);
+	}
+
+	/////////////////////////////////////////////////////////////////////////////
+	// IndexBuffer //////////////////////////////////////////////////////////////
+	/////////////////////////////////////////////////////////////////////////////
+
+	NullIndexBuffer::NullIndexBuffer([[maybe_unused]] const uint32_t* indices, uint32_t count)
+		: m_RendererID(NullRecorder::GenerateID()), m_Count(count)
+	{
+		ARC_PROFILE_SCOPE()
+
+		NullRecorder::Record(NullCommandType::UploadBuffer, m_RendererID, static_cast<uint64_t>(count) * sizeof(uint32_t));
+	}
+
+	void NullIndexBuffer::Bind() const
+	{
+	}
+
+	void NullIndexBuffer::Unbind() const
+	{
+	}
+
+	/////////////////////////////////////////////////////////////////////////////
+	// UniformBuffer ////////////////////////////////////////////////////////////
+	/////////////////////////////////////////////////////////////////////////////
+
+	NullUniformBuffer::NullUniformBuffer()
+		: m_RendererID(NullRecorder::GenerateID())
+	{
+		ARC_PROFILE_SCOPE()
+	}
+
+	void NullUniformBuffer::Bind() const
+	{
+		ARC_PROFILE_SCOPE()
+
+		NullRecorder::Record(NullCommandType::BindUniformBuffer, m_RendererID, m_BlockIndex);
+	}
+
+	void NullUniformBuffer::Bind(uint32_t blockIndex) const
+	{
+		ARC_PROFILE_SCOPE()
+
+		NullRecorder::Record(NullCommandType::BindUniformBuffer, m_RendererID, blockIndex);
+	}
+
+	void NullUniformBuffer::Unbind() const
+	{
+	}
+
+	void NullUniformBuffer::SetData([[maybe_unused]] const void* data, uint32_t offset, uint32_t size)
+	{
+		ARC_PROFILE_SCOPE()
+
+		ARC_CORE_ASSERT(static_cast<size_t>(offset) + size <= m_Size, "Data does not fit in the uniform buffer!")
+		NullRecorder::Record(NullCommandType::UploadBuffer, m_RendererID, size);
+	}
+
+	void NullUniformBuffer::SetLayout(const BufferLayout& layout, uint32_t blockIndex, uint32_t count)
+	{
+		ARC_PROFILE_SCOPE()
+
+		m_Layout = layout;
+		m_BlockIndex = blockIndex;
+		m_Size = static_cast<size_t>(layout.GetStride()) * count;
+	}
+
+	void NullUniformBuffer::SetSize(uint32_t size)
+	{
+		ARC_PROFILE_SCOPE()
+
+		m_Size = size;
+	}
+
+	/////////////////////////////////////////////////////////////////////////////
+	// StorageBuffer ////////////////////////////////////////////////////////////
+	/////////////////////////////////////////////////////////////////////////////
+
+	NullStorageBuffer::NullStorageBuffer()
+		: m_RendererID(NullRecorder::GenerateID())
+	{
+		ARC_PROFILE_SCOPE()
+	}
+
+	void NullStorageBuffer::Bind(uint32_t blockIndex, uint32_t offset, uint32_t size) const
+	{
+		ARC_PROFILE_SCOPE()
+
+		ARC_CORE_ASSERT(offset % OffsetAlignment == 0, "Storage buffer sections have to be aligned!")
+		ARC_CORE_ASSERT(static_cast<uint64_t>(offset) + size <= m_Size, "Storage buffer section is out of bounds!")
+		NullRecorder::Record(NullCommandType::BindStorageBuffer, m_RendererID, blockIndex);
+	}
+
+	void NullStorageBuffer::SetData([[maybe_unused]] const void* data, uint32_t size)
+	{
+		ARC_PROFILE_SCOPE()
+
+		m_Size = glm::max(m_Size, size);
+		NullRecorder::Record(NullCommandType::UploadBuffer, m_RendererID, size);
+	}
+}
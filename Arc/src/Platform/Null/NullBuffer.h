@@ -0,0 +1,92 @@
+#pragma once
+
+#include "Arc/Renderer/Buffer.h"
+
+namespace ArcEngine
+{
+	class NullVertexBuffer : public VertexBuffer
+	{
+	public:
+		explicit NullVertexBuffer(size_t size);
+		NullVertexBuffer(const float* vertices, size_t size);
+		~NullVertexBuffer() override = default;
+
+		NullVertexBuffer(const NullVertexBuffer& other) = default;
+		NullVertexBuffer(NullVertexBuffer&& other) = default;
+
+		void Bind() const override;
+		void Unbind() const override;
+
+		void SetData(const void* data, uint32_t size) override;
+
+		[[nodiscard]] const BufferLayout& GetLayout() const override { return m_Layout; }
+		void SetLayout(const BufferLayout& layout) override { m_Layout = layout; }
+
+		[[nodiscard]] size_t GetSize() const { return m_Size; }
+
+	private:
+		uint64_t m_RendererID = 0;
+		size_t m_Size = 0;
+		BufferLayout m_Layout;
+	};
+
+	class NullIndexBuffer : public IndexBuffer
+	{
+	public:
+		NullIndexBuffer(const uint32_t* indices, uint32_t count);
+		~NullIndexBuffer() override = default;
+
+		NullIndexBuffer(const NullIndexBuffer& other) = default;
+		NullIndexBuffer(NullIndexBuffer&& other) = default;
+
+		void Bind() const override;
+		void Unbind() const override;
+
+		[[nodiscard]] uint32_t GetCount() const override { return m_Count; }
+
+	private:
+		uint64_t m_RendererID = 0;
+		uint32_t m_Count = 0;
+	};
+
+	class NullUniformBuffer : public UniformBuffer
+	{
+	public:
+		NullUniformBuffer();
+		~NullUniformBuffer() override = default;
+
+		NullUniformBuffer(const NullUniformBuffer& other) = default;
+		NullUniformBuffer(NullUniformBuffer&& other) = default;
+
+		void Bind() const override;
+		void Bind(uint32_t blockIndex) const override;
+		void Unbind() const override;
+
+		void SetData(const void* data, uint32_t offset, uint32_t size) override;
+		void SetLayout(const BufferLayout& layout, uint32_t blockIndex, uint32_t count) override;
+		void SetSize(uint32_t size) override;
+
+	private:
+		uint64_t m_RendererID = 0;
+		uint32_t m_BlockIndex = 0;
+		size_t m_Size = 0;
+		BufferLayout m_Layout;
+	};
+
+	class NullStorageBuffer : public StorageBuffer
+	{
+	public:
+		NullStorageBuffer();
+		~NullStorageBuffer() override = default;
+
+		NullStorageBuffer(const NullStorageBuffer& other) = default;
+		NullStorageBuffer(NullStorageBuffer&& other) = default;
+
+		void Bind(uint32_t blockIndex, uint32_t offset, uint32_t size) const override;
+		void SetData(const void* data, uint32_t size) override;
+
+	private:
+		uint64_t m_RendererID = 0;
+		uint32_t m_Size = 0;
+	};
+}
@@ -0,0 +1,21 @@
+#include "arcpch.h"
+#include "Platform/Null/NullContext.h"
+
+#include "Platform/Null/NullRecorder.h"
+
+namespace ArcEngine
+{
+	void NullContext::Init()
+	{
+		ARC_PROFILE_SCOPE()
+
+		ARC_CORE_INFO("Null graphics context, running headless");
+	}
+
+	void NullContext::SwapBuffers()
+	{
+		ARC_PROFILE_SCOPE()
+
+		NullRecorder::Record(NullCommandType::SwapBuffers);
+	}
+}
@@ -0,0 +1,12 @@
+#pragma once
+#include "Arc/Renderer/GraphicsContext.h"
+
+namespace ArcEngine
+{
+	class NullContext : public GraphicsContext
+	{
+	public:
+		void Init() override;
+		void SwapBuffers() override;
+	};
+}
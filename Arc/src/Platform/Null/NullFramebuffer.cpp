@@ -0,0 +1,83 @@
+#include "arcpch.h"
+#include "Platform/Null/NullFramebuffer.h"
+
+#include "Platform/Null/NullRecorder.h"
+
+namespace ArcEngine
+{
+	static constexpr uint32_t s_MaxFramebufferSize = 8192;
+
+	NullFramebuffer::NullFramebuffer(const FramebufferSpecification& spec)
+		: m_Specification(spec)
+	{
+		ARC_PROFILE_SCOPE()
+
+		for (const auto& s : m_Specification.Attachments.Attachments)
+		{
+			if (s.TextureFormat == FramebufferTextureFormat::DEPTH24STENCIL8)
+				m_HasDepthAttachment = true;
+			else if (s.TextureFormat != FramebufferTextureFormat::None)
+				++m_ColorAttachmentCount;
+		}
+
+		Invalidate();
+	}
+
+	void NullFramebuffer::Invalidate()
+	{
+		ARC_PROFILE_SCOPE()
+
+		// Fresh IDs, like the OpenGL backend recreating its attachments
+		m_RendererID = NullRecorder::GenerateID();
+		m_ColorAttachments.resize(m_ColorAttachmentCount);
+		for (uint64_t& attachment : m_ColorAttachments)
+			attachment = NullRecorder::GenerateID();
+		m_DepthAttachment = m_HasDepthAttachment ? NullRecorder::GenerateID() : 0;
+	}
+
+	void NullFramebuffer::Bind()
+	{
+		ARC_PROFILE_SCOPE()
+
+		NullRecorder::Record(NullCommandType::BindFramebuffer, m_RendererID);
+		NullRecorder::Record(NullCommandType::SetViewport, 0, (static_cast<uint64_t>(m_Specification.Width) << 32) | m_Specification.Height);
+	}
+
+	void NullFramebuffer::Unbind()
+	{
+		ARC_PROFILE_SCOPE()
+
+		NullRecorder::Record(NullCommandType::BindFramebuffer, 0);
+	}
+
+	void NullFramebuffer::BindColorAttachment(uint32_t index, uint32_t slot)
+	{
+		ARC_PROFILE_SCOPE()
+
+		ARC_CORE_ASSERT(index < m_ColorAttachments.size())
+		NullRecorder::Record(NullCommandType::BindTexture, m_ColorAttachments[index], slot);
+	}
+
+	void NullFramebuffer::BindDepthAttachment(uint32_t slot)
+	{
+		ARC_PROFILE_SCOPE()
+
+		NullRecorder::Record(NullCommandType::BindTexture, m_DepthAttachment, slot);
+	}
+
+	void NullFramebuffer::Resize(uint32_t width, uint32_t height)
+	{
+		ARC_PROFILE_SCOPE()
+
+		if (width == 0 || height == 0 || width > s_MaxFramebufferSize || height > s_MaxFramebufferSize)
+		{
+			ARC_CORE_WARN("Attempted to resize framebuffer to {0}, {1}", width, height);
+			return;
+		}
+
+		m_Specification.Width = width;
+		m_Specification.Height = height;
+
+		Invalidate();
+	}
+}
@@ -0,0 +1,40 @@
+#pragma once
+
+#include "Arc/Renderer/Framebuffer.h"
+
+namespace ArcEngine
+{
+	class NullFramebuffer : public Framebuffer
+	{
+	public:
+		explicit NullFramebuffer(const FramebufferSpecification& spec);
+		~NullFramebuffer() override = default;
+
+		NullFramebuffer(const NullFramebuffer& other) = default;
+		NullFramebuffer(NullFramebuffer&& other) = default;
+
+		void Invalidate();
+
+		void Bind() override;
+		void Unbind() override;
+
+		void BindColorAttachment(uint32_t index, uint32_t slot) override;
+		void BindDepthAttachment(uint32_t slot) override;
+
+		void Resize(uint32_t width, uint32_t height) override;
+
+		[[nodiscard]] uint64_t GetColorAttachmentRendererID(uint32_t index = 0) const override { ARC_CORE_ASSERT(index < m_ColorAttachments.size()) return m_ColorAttachments[index]; }
+		[[nodiscard]] uint64_t GetDepthAttachmentRendererID() const override { return m_DepthAttachment; }
+
+		[[nodiscard]] const FramebufferSpecification& GetSpecification() const override { return m_Specification; }
+
+	private:
+		uint64_t m_RendererID = 0;
+		FramebufferSpecification m_Specification;
+		uint32_t m_ColorAttachmentCount = 0;
+		bool m_HasDepthAttachment = false;
+
+		std::vector<uint64_t> m_ColorAttachments;
+		uint64_t m_DepthAttachment = 0;
+	};
+}
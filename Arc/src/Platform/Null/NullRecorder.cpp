@@ -0,0 +1,191 @@
+#include "arcpch.h"
+#include "Platform/Null/NullRecorder.h"
+
+#include <atomic>
+
+namespace ArcEngine
+{
+	static constexpr size_t s_CommandTypeCount = static_cast<size_t>(NullCommandType::SwapBuffers) + 1;
+	static constexpr size_t s_MaxTrackedTextureSlots = 32;
+	static constexpr uint64_t s_UnknownState = std::numeric_limits<uint64_t>::max();
+
+	struct NullRecorderData
+	{
+		NullRecorder::Statistics Stats;
+		std::vector<NullCommand> Commands;
+		std::array<uint32_t, s_CommandTypeCount> CommandCounts{};
+		bool CaptureCommands = false;
+
+		// Last value set for every piece of pipeline state, used to spot redundant changes
+		std::array<uint64_t, s_CommandTypeCount> State{};
+		std::array<uint64_t, s_MaxTrackedTextureSlots> TextureSlots{};
+
+		NullRecorderData()
+		{
+			State.fill(s_UnknownState);
+			TextureSlots.fill(s_UnknownState);
+		}
+	};
+
+	static NullRecorderData s_Data;
+	static std::atomic<uint64_t> s_NextID = 1;
+
+	// Returns true if the state was already set to the given value
+	static bool TrackState(uint64_t& current, uint64_t value)
+	{
+		const bool redundant = current == value;
+		current = value;
+		return redundant;
+	}
+
+	void NullRecorder::Record(NullCommandType type, uint64_t resource, uint64_t value)
+	{
+		const size_t typeIndex = static_cast<size_t>(type);
+		++s_Data.CommandCounts[typeIndex];
+		if (s_Data.CaptureCommands)
+			s_Data.Commands.push_back({ type, resource, value });
+
+		Statistics& stats = s_Data.Stats;
+		bool redundant = false;
+		switch (type)
+		{
+			case NullCommandType::DrawIndexed:
+				++stats.DrawCalls;
+				stats.IndexCount += value;
+				break;
+			case NullCommandType::DrawIndexedInstanced:
+				++stats.DrawCalls;
+				++stats.InstancedDrawCalls;
+				stats.Instances += resource;
+				stats.IndexCount += value * resource;
+				break;
+			case NullCommandType::Draw:			[[fallthrough]];
+			case NullCommandType::DrawLines:
+				++stats.DrawCalls;
+				stats.VertexCount += value;
+				break;
+			case NullCommandType::SetViewport:	[[fallthrough]];
+			case NullCommandType::SetClearColor:[[fallthrough]];
+			case NullCommandType::SetCulling:	[[fallthrough]];
+			case NullCommandType::SetCullFace:	[[fallthrough]];
+			case NullCommandType::SetDepthMask:	[[fallthrough]];
+			case NullCommandType::SetDepthTest:	[[fallthrough]];
+			case NullCommandType::SetBlendState:
+				++stats.StateChanges;
+				redundant = TrackState(s_Data.State[typeIndex], value);
+				break;
+			case NullCommandType::BindShader:
+				++stats.ShaderBinds;
+				redundant = TrackState(s_Data.State[typeIndex], resource);
+				break;
+			case NullCommandType::BindVertexArray:
+				++stats.VertexArrayBinds;
+				redundant = TrackState(s_Data.State[typeIndex], resource);
+				break;
+			case NullCommandType::BindFramebuffer:
+				++stats.FramebufferBinds;
+				redundant = TrackState(s_Data.State[typeIndex], resource);
+				break;
+			case NullCommandType::BindTexture:
+				++stats.TextureBinds;
+				if (value < s_MaxTrackedTextureSlots)
+					redundant = TrackState(s_Data.TextureSlots[value], resource);
+				break;
+			case NullCommandType::BindUniformBuffer:
+				++stats.UniformBufferBinds;
+				break;
+			case NullCommandType::BindStorageBuffer:
+				++stats.StorageBufferBinds;
+				break;
+			case NullCommandType::SetUniform:
+				++stats.UniformSets;
+				break;
+			case NullCommandType::UploadBuffer:	[[fallthrough]];
+			case NullCommandType::UploadTexture:
+				stats.BytesUploaded += value;
+				break;
+			case NullCommandType::SwapBuffers:
+				++stats.Frames;
+				break;
+			case NullCommandType::Clear:
+				break;
+		}
+
+		if (redundant)
+			++stats.RedundantStateChanges;
+	}
+
+	void NullRecorder::Reset()
+	{
+		ARC_PROFILE_SCOPE()
+
+		const bool capture = s_Data.CaptureCommands;
+		std::vector<NullCommand> commands = std::move(s_Data.Commands);
+		commands.clear();
+
+		s_Data = NullRecorderData();
+		s_Data.CaptureCommands = capture;
+		s_Data.Commands = std::move(commands);
+	}
+
+	void NullRecorder::SetCaptureCommands(bool enabled)
+	{
+		s_Data.CaptureCommands = enabled;
+	}
+
+	bool NullRecorder::IsCapturingCommands()
+	{
+		return s_Data.CaptureCommands;
+	}
+
+	const NullRecorder::Statistics& NullRecorder::GetStatistics()
+	{
+		return s_Data.Stats;
+	}
+
+	const std::vector<NullCommand>& NullRecorder::GetCommands()
+	{
+		return s_Data.Commands;
+	}
+
+	uint32_t NullRecorder::GetCommandCount(NullCommandType type)
+	{
+		return s_Data.CommandCounts[static_cast<size_t>(type)];
+	}
+
+	uint64_t NullRecorder::GenerateID()
+	{
+		return s_NextID.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	const char* NullRecorder::CommandTypeToString(NullCommandType type)
+	{
+		switch (type)
+		{
+			case NullCommandType::SetViewport:			return "SetViewport";
+			case NullCommandType::SetClearColor:		return "SetClearColor";
+			case NullCommandType::Clear:				return "Clear";
+			case NullCommandType::DrawIndexed:			return "DrawIndexed";
+			case NullCommandType::DrawIndexedInstanced:	return "DrawIndexedInstanced";
+			case NullCommandType::Draw:					return "Draw";
+			case NullCommandType::DrawLines:			return "DrawLines";
+			case NullCommandType::SetCulling:			return "SetCulling";
+			case NullCommandType::SetCullFace:			return "SetCullFace";
+			case NullCommandType::SetDepthMask:			return "SetDepthMask";
+			case NullCommandType::SetDepthTest:			return "SetDepthTest";
+			case NullCommandType::SetBlendState:		return "SetBlendState";
+			case NullCommandType::BindShader:			return "BindShader";
+			case NullCommandType::SetUniform:			return "SetUniform";
+			case NullCommandType::BindVertexArray:		return "BindVertexArray";
+			case NullCommandType::BindTexture:			return "BindTexture";
+			case NullCommandType::BindFramebuffer:		return "BindFramebuffer";
+			case NullCommandType::BindUniformBuffer:	return "BindUniformBuffer";
+			case NullCommandType::BindStorageBuffer:	return "BindStorageBuffer";
+			case NullCommandType::UploadBuffer:			return "UploadBuffer";
+			case NullCommandType::UploadTexture:		return "UploadTexture";
+			case NullCommandType::SwapBuffers:			return "SwapBuffers";
+		}
+
+		return "Unknown";
+	}
+}
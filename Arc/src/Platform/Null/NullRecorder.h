@@ -0,0 +1,87 @@
+#pragma once
+
+namespace ArcEngine
+{
+	enum class NullCommandType : uint8_t
+	{
+		SetViewport = 0,
+		SetClearColor,
+		Clear,
+
+		DrawIndexed,
+		DrawIndexedInstanced,
+		Draw,
+		DrawLines,
+
+		SetCulling,
+		SetCullFace,
+		SetDepthMask,
+		SetDepthTest,
+		SetBlendState,
+
+		BindShader,
+		SetUniform,
+		BindVertexArray,
+		BindTexture,
+		BindFramebuffer,
+		BindUniformBuffer,
+		BindStorageBuffer,
+
+		UploadBuffer,
+		UploadTexture,
+
+		SwapBuffers
+	};
+
+	struct NullCommand
+	{
+		NullCommandType Type;
+		uint64_t Resource = 0;		// ID of the object the command acts on, zero when there is none. Instance count for instanced draws
+		uint64_t Value = 0;			// Element count, byte count, slot or state depending on the type
+	};
+
+	// Collects everything the null backend is asked to do so that render submission
+	// can be measured and verified without a graphics context.
+	class NullRecorder
+	{
+	public:
+		struct Statistics
+		{
+			uint32_t Frames = 0;
+			uint32_t DrawCalls = 0;
+			uint32_t InstancedDrawCalls = 0;
+			uint64_t Instances = 0;
+			uint64_t IndexCount = 0;
+			uint64_t VertexCount = 0;
+
+			uint32_t StateChanges = 0;
+			uint32_t RedundantStateChanges = 0;
+
+			uint32_t ShaderBinds = 0;
+			uint32_t VertexArrayBinds = 0;
+			uint32_t TextureBinds = 0;
+			uint32_t FramebufferBinds = 0;
+			uint32_t UniformBufferBinds = 0;
+			uint32_t StorageBufferBinds = 0;
+			uint32_t UniformSets = 0;
+
+			uint64_t BytesUploaded = 0;
+		};
+
+		static void Record(NullCommandType type, uint64_t resource = 0, uint64_t value = 0);
+		static void Reset();
+
+		// Statistics are always gathered, the full command list only when capturing is enabled
+		static void SetCaptureCommands(bool enabled);
+		[[nodiscard]] static bool IsCapturingCommands();
+
+		[[nodiscard]] static const Statistics& GetStatistics();
+		[[nodiscard]] static const std::vector<NullCommand>& GetCommands();
+		[[nodiscard]] static uint32_t GetCommandCount(NullCommandType type);
+
+		// Unique non-zero ID for every null resource
+		[[nodiscard]] static uint64_t GenerateID();
+
+		[[nodiscard]] static const char* CommandTypeToString(NullCommandType type);
+	};
+}
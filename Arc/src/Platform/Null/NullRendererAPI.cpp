@@ -0,0 +1,126 @@
+#include "arcpch.h"
+#include "Platform/Null/NullRendererAPI.h"
+
+#include "Arc/Renderer/VertexArray.h"
+#include "Platform/Null/NullRecorder.h"
+
+namespace ArcEngine
+{
+	void NullRendererAPI::Init()
+	{
+		ARC_PROFILE_SCOPE()
+
+		ARC_CORE_INFO("Null renderer: commands are recorded but never executed");
+
+		// Same defaults the OpenGL backend starts with
+		NullRecorder::Record(NullCommandType::SetBlendState, 0, 1);
+		NullRecorder::Record(NullCommandType::SetDepthTest, 0, 1);
+	}
+
+	void NullRendererAPI::SetViewport([[maybe_unused]] uint32_t x, [[maybe_unused]] uint32_t y, uint32_t width, uint32_t height)
+	{
+		ARC_PROFILE_SCOPE()
+
+		NullRecorder::Record(NullCommandType::SetViewport, 0, (static_cast<uint64_t>(width) << 32) | height);
+	}
+
+	void NullRendererAPI::SetClearColor(const glm::vec4& color)
+	{
+		ARC_PROFILE_SCOPE()
+
+		uint64_t packed = 0;
+		for (int i = 0; i < 4; ++i)
+			packed = (packed << 16) | static_cast<uint16_t>(glm::clamp(color[i], 0.0f, 1.0f) * 65535.0f);
+		NullRecorder::Record(NullCommandType::SetClearColor, 0, packed);
+	}
+
+	void NullRendererAPI::Clear()
+	{
+		ARC_PROFILE_SCOPE()
+
+		NullRecorder::Record(NullCommandType::Clear);
+	}
+
+	void NullRendererAPI::DrawIndexed(const Ref<VertexArray>& vertexArray, uint32_t indexCount)
+	{
+		ARC_PROFILE_SCOPE()
+
+		vertexArray->Bind();
+		const uint32_t count = indexCount != 0 ? indexCount : vertexArray->GetIndexBuffer()->GetCount();
+		NullRecorder::Record(NullCommandType::DrawIndexed, 0, count);
+	}
+
+	void NullRendererAPI::DrawIndexedInstanced(const Ref<VertexArray>& vertexArray, uint32_t instanceCount, uint32_t indexCount)
+	{
+		ARC_PROFILE_SCOPE()
+
+		vertexArray->Bind();
+		const uint32_t count = indexCount != 0 ? indexCount : vertexArray->GetIndexBuffer()->GetCount();
+		NullRecorder::Record(NullCommandType::DrawIndexedInstanced, instanceCount, count);
+	}
+
+	void NullRendererAPI::Draw(const Ref<VertexArray>& vertexArray, uint32_t count)
+	{
+		ARC_PROFILE_SCOPE()
+
+		vertexArray->Bind();
+		NullRecorder::Record(NullCommandType::Draw, 0, count);
+	}
+
+	void NullRendererAPI::DrawLines(const Ref<VertexArray>& vertexArray, uint32_t vertexCount)
+	{
+		ARC_PROFILE_SCOPE()
+
+		vertexArray->Bind();
+		NullRecorder::Record(NullCommandType::DrawLines, 0, vertexCount);
+	}
+
+	void NullRendererAPI::EnableCulling()
+	{
+		ARC_PROFILE_SCOPE()
+
+		NullRecorder::Record(NullCommandType::SetCulling, 0, 1);
+	}
+
+	void NullRendererAPI::DisableCulling()
+	{
+		ARC_PROFILE_SCOPE()
+
+		NullRecorder::Record(NullCommandType::SetCulling, 0, 0);
+	}
+
+	void NullRendererAPI::FrontCull()
+	{
+		ARC_PROFILE_SCOPE()
+
+		NullRecorder::Record(NullCommandType::SetCullFace, 0, 0);
+	}
+
+	void NullRendererAPI::BackCull()
+	{
+		ARC_PROFILE_SCOPE()
+
+		NullRecorder::Record(NullCommandType::SetCullFace, 0, 1);
+	}
+
+	void NullRendererAPI::SetDepthMask(bool value)
+	{
+		ARC_PROFILE_SCOPE()
+
+		NullRecorder::Record(NullCommandType::SetDepthMask, 0, value);
+	}
+
+	void NullRendererAPI::SetDepthTest(bool value)
+	{
+		ARC_PROFILE_SCOPE()
+
+		NullRecorder::Record(NullCommandType::SetDepthTest, 0, value);
+	}
+
+	void NullRendererAPI::SetBlendState(bool value)
+	{
+		ARC_PROFILE_SCOPE()
+
+		NullRecorder::Record(NullCommandType::SetBlendState, 0, value);
+	}
+}
@@ -0,0 +1,89 @@
+#include "arcpch.h"
+#include "Platform/Null/NullShader.h"
+
+#include "Arc/Core/Filesystem.h"
+#include "Arc/Renderer/ShaderUtils.h"
+#include "Platform/Null/NullRecorder.h"
+
+namespace ArcEngine
+{
+	NullShader::NullShader(const std::filesystem::path& filepath)
+		: m_RendererID(NullRecorder::GenerateID())
+	{
+		ARC_PROFILE_SCOPE()
+
+		m_Name = filepath.filename().string();
+		// Without a driver to query, the material properties are reflected from the source text
+		ShaderUtils::Reflect(m_Name, Filesystem::ReadFileText(filepath), m_MaterialProperties, m_MaterialBlockSize);
+	}
+
+	void NullShader::Recompile(const std::filesystem::path& filepath)
+	{
+		ARC_PROFILE_SCOPE()
+
+		ShaderUtils::Reflect(m_Name, Filesystem::ReadFileText(filepath), m_MaterialProperties, m_MaterialBlockSize);
+	}
+
+	void NullShader::Bind() const
+	{
+		ARC_PROFILE_SCOPE()
+
+		NullRecorder::Record(NullCommandType::BindShader, m_RendererID);
+	}
+
+	void NullShader::Unbind() const
+	{
+		ARC_PROFILE_SCOPE()
+
+		NullRecorder::Record(NullCommandType::BindShader, 0);
+	}
+
+	void NullShader::SetInt([[maybe_unused]] const std::string& name, [[maybe_unused]] int value)
+	{
+		RecordUniform(sizeof(int));
+	}
+
+	void NullShader::SetIntArray([[maybe_unused]] const std::string& name, [[maybe_unused]] const int* values, uint32_t count)
+	{
+		RecordUniform(sizeof(int) * count);
+	}
+
+	void NullShader::SetFloat([[maybe_unused]] const std::string& name, [[maybe_unused]] float value)
+	{
+		RecordUniform(sizeof(float));
+	}
+
+	void NullShader::SetFloat2([[maybe_unused]] const std::string& name, [[maybe_unused]] const glm::vec2& value)
+	{
+		RecordUniform(sizeof(glm::vec2));
+	}
+
+	void NullShader::SetFloat3([[maybe_unused]] const std::string& name, [[maybe_unused]] const glm::vec3& value)
+	{
+		RecordUniform(sizeof(glm::vec3));
+	}
+
+	void NullShader::SetFloat4([[maybe_unused]] const std::string& name, [[maybe_unused]] const glm::vec4& value)
+	{
+		RecordUniform(sizeof(glm::vec4));
+	}
+
+	void NullShader::SetMat3([[maybe_unused]] const std::string& name, [[maybe_unused]] const glm::mat3& value)
+	{
+		RecordUniform(sizeof(glm::mat3));
+	}
+
+	void NullShader::SetMat4([[maybe_unused]] const std::string& name, [[maybe_unused]] const glm::mat4& value)
+	{
+		RecordUniform(sizeof(glm::mat4));
+	}
+
+	void NullShader::SetUniformBlock([[maybe_unused]] const std::string& name, [[maybe_unused]] uint32_t blockIndex)
+	{
+	}
+
+	void NullShader::RecordUniform(size_t sizeInBytes) const
+	{
+		NullRecorder::Record(NullCommandType::SetUniform, m_RendererID, sizeInBytes);
+	}
+}
@@ -0,0 +1,45 @@
+#pragma once
+
+#include "Arc/Renderer/Shader.h"
+
+namespace ArcEngine
+{
+	class NullShader : public Shader
+	{
+	public:
+		explicit NullShader(const std::filesystem::path& filepath);
+		~NullShader() override = default;
+
+		NullShader(const NullShader& other) = default;
+		NullShader(NullShader&& other) = default;
+
+		void Recompile(const std::filesystem::path& filepath) override;
+
+		void Bind() const override;
+		void Unbind() const override;
+
+		void SetInt(const std::string& name, int value) override;
+		void SetIntArray(const std::string& name, const int* values, uint32_t count) override;
+		void SetFloat(const std::string& name, float value) override;
+		void SetFloat2(const std::string& name, const glm::vec2& value) override;
+		void SetFloat3(const std::string& name, const glm::vec3& value) override;
+		void SetFloat4(const std::string& name, const glm::vec4& value) override;
+		void SetMat3(const std::string& name, const glm::mat3& value) override;
+		void SetMat4(const std::string& name, const glm::mat4& value) override;
+		void SetUniformBlock(const std::string& name, uint32_t blockIndex) override;
+
+		[[nodiscard]] std::unordered_map<std::string, MaterialProperty, UM_StringTransparentEquality>& GetMaterialProperties() override { return m_MaterialProperties; }
+		[[nodiscard]] size_t GetMaterialBlockSize() const override { return m_MaterialBlockSize; }
+
+		[[nodiscard]] const std::string& GetName() const override { return m_Name; }
+
+	private:
+		void RecordUniform(size_t sizeInBytes) const;
+
+	private:
+		uint64_t m_RendererID = 0;
+		std::string m_Name;
+		std::unordered_map<std::string, MaterialProperty, UM_StringTransparentEquality> m_MaterialProperties;
+		size_t m_MaterialBlockSize = 0;
+	};
+}
@@ -0,0 +1,147 @@
+#include "arcpch.h"
+#include "Platform/Null/NullTexture.h"
+
+#include <stb_image.h>
+
+#include "Platform/Null/NullRecorder.h"
+
+namespace ArcEngine
+{
+	// Only the header is read, the pixels are never needed without a GPU
+	static bool ReadImageInfo(const std::string& path, uint32_t& width, uint32_t& height, uint32_t& channels)
+	{
+		ARC_PROFILE_SCOPE()
+
+		int w, h, c;
+		if (!stbi_info(path.c_str(), &w, &h, &c))
+		{
+			ARC_CORE_ERROR("Failed to read image info: {}", path);
+			return false;
+		}
+
+		width = static_cast<uint32_t>(w);
+		height = static_cast<uint32_t>(h);
+		channels = static_cast<uint32_t>(c);
+		return true;
+	}
+
+	/////////////////////////////////////////////////////////////////////////////
+	// Texture2D ////////////////////////////////////////////////////////////////
+	/////////////////////////////////////////////////////////////////////////////
+
+	NullTexture2D::NullTexture2D()
+		: m_RendererID(NullRecorder::GenerateID())
+	{
+	}
+
+	NullTexture2D::NullTexture2D(uint32_t width, uint32_t height)
+		: m_Width(width), m_Height(height), m_RendererID(NullRecorder::GenerateID())
+	{
+		ARC_PROFILE_SCOPE()
+	}
+
+	NullTexture2D::NullTexture2D(const std::string& path)
+		: m_RendererID(NullRecorder::GenerateID())
+	{
+		ARC_PROFILE_SCOPE()
+
+		uint32_t width = 1, height = 1, channels = 4;
+		ReadImageInfo(path, width, height, channels);
+		Invalidate(path, width, height, nullptr, channels);
+	}
+
+	void NullTexture2D::SetData([[maybe_unused]] void* data, [[maybe_unused]] uint32_t size)
+	{
+		ARC_PROFILE_SCOPE()
+
+		ARC_CORE_ASSERT(size == m_Width * m_Height * m_Channels, "Data must be entire texture!")
+		NullRecorder::Record(NullCommandType::UploadTexture, m_RendererID, size);
+	}
+
+	void NullTexture2D::Invalidate(std::string_view path, uint32_t width, uint32_t height, [[maybe_unused]] const void* data, uint32_t channels)
+	{
+		ARC_PROFILE_SCOPE()
+
+		if (channels < 1 || channels > 4)
+		{
+			ARC_CORE_ERROR("Texture channel count is not within (1-4) range. Channel count: {}", channels);
+			return;
+		}
+
+		m_Path = path;
+		m_Width = width;
+		m_Height = height;
+		m_Channels = channels;
+
+		NullRecorder::Record(NullCommandType::UploadTexture, m_RendererID, static_cast<uint64_t>(width) * height * channels);
+	}
+
+	void NullTexture2D::Bind(uint32_t slot) const
+	{
+		ARC_PROFILE_SCOPE()
+
+		NullRecorder::Record(NullCommandType::BindTexture, m_RendererID, slot);
+	}
+
+	/////////////////////////////////////////////////////////////////////////////
+	// TextureCubemap ///////////////////////////////////////////////////////////
+	/////////////////////////////////////////////////////////////////////////////
+
+	NullTextureCubemap::NullTextureCubemap()
+		: m_HRDRendererID(NullRecorder::GenerateID()), m_RendererID(NullRecorder::GenerateID())
+		, m_IrradianceRendererID(NullRecorder::GenerateID()), m_RadianceRendererID(NullRecorder::GenerateID())
+	{
+	}
+
+	NullTextureCubemap::NullTextureCubemap(const std::string& path)
+		: NullTextureCubemap()
+	{
+		ARC_PROFILE_SCOPE()
+
+		uint32_t width = 1, height = 1, channels = 3;
+		ReadImageInfo(path, width, height, channels);
+		Invalidate(path, width, height, nullptr, channels);
+	}
+
+	void NullTextureCubemap::SetData([[maybe_unused]] void* data, [[maybe_unused]] uint32_t size)
+	{
+	}
+
+	void NullTextureCubemap::Invalidate(std::string_view path, uint32_t width, uint32_t height, [[maybe_unused]] const void* data, uint32_t channels)
+	{
+		ARC_PROFILE_SCOPE()
+
+		if (channels < 3)
+		{
+			ARC_CORE_ERROR("Couldn't load HDR cubemap with {} channels: {}", channels, path);
+			return;
+		}
+
+		m_Path = path;
+		m_Width = width;
+		m_Height = height;
+
+		NullRecorder::Record(NullCommandType::UploadTexture, m_HRDRendererID, static_cast<uint64_t>(width) * height * channels * sizeof(float));
+	}
+
+	void NullTextureCubemap::Bind(uint32_t slot) const
+	{
+		ARC_PROFILE_SCOPE()
+
+		NullRecorder::Record(NullCommandType::BindTexture, m_RendererID, slot);
+	}
+
+	void NullTextureCubemap::BindIrradianceMap(uint32_t slot) const
+	{
+		ARC_PROFILE_SCOPE()
+
+		NullRecorder::Record(NullCommandType::BindTexture, m_IrradianceRendererID, slot);
+	}
+
+	void NullTextureCubemap::BindRadianceMap(uint32_t slot) const
+	{
+		ARC_PROFILE_SCOPE()
+
+		NullRecorder::Record(NullCommandType::BindTexture, m_RadianceRendererID, slot);
+	}
+}
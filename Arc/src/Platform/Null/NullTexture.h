@@ -0,0 +1,66 @@
+#pragma once
+
+#include "Arc/Renderer/Texture.h"
+
+namespace ArcEngine
+{
+	class NullTexture2D : public Texture2D
+	{
+	public:
+		NullTexture2D();
+		NullTexture2D(uint32_t width, uint32_t height);
+		explicit NullTexture2D(const std::string& path);
+		~NullTexture2D() override = default;
+
+		NullTexture2D(const NullTexture2D& other) = default;
+		NullTexture2D(NullTexture2D&& other) = default;
+
+		[[nodiscard]] uint32_t GetWidth() const override { return m_Width; }
+		[[nodiscard]] uint32_t GetHeight() const override { return m_Height; }
+		[[nodiscard]] uint64_t GetRendererID() const override { return m_RendererID; }
+		[[nodiscard]] const std::string& GetPath() const override { return m_Path; }
+
+		void SetData(void* data, [[maybe_unused]] uint32_t size) override;
+		void Invalidate(std::string_view path, uint32_t width, uint32_t height, const void* data, uint32_t channels) override;
+
+		void Bind(uint32_t slot = 0) const override;
+
+	private:
+		std::string m_Path;
+		uint32_t m_Width = 0, m_Height = 0;
+		uint32_t m_Channels = 4;
+		uint64_t m_RendererID = 0;
+	};
+
+	class NullTextureCubemap : public TextureCubemap
+	{
+	public:
+		NullTextureCubemap();
+		explicit NullTextureCubemap(const std::string& path);
+		~NullTextureCubemap() override = default;
+
+		NullTextureCubemap(const NullTextureCubemap& other) = default;
+		NullTextureCubemap(NullTextureCubemap&& other) = default;
+
+		[[nodiscard]] uint32_t GetWidth() const override { return m_Width; }
+		[[nodiscard]] uint32_t GetHeight() const override { return m_Height; }
+		[[nodiscard]] uint64_t GetRendererID() const override { return m_RendererID; }
+		[[nodiscard]] uint64_t GetHRDRendererID() const override { return m_HRDRendererID; }
+		[[nodiscard]] const std::string& GetPath() const override { return m_Path; }
+
+		void SetData(void* data, uint32_t size) override;
+		void Invalidate(std::string_view path, uint32_t width, uint32_t height, const void* data, uint32_t channels) override;
+
+		void Bind(uint32_t slot = 0) const override;
+		void BindIrradianceMap(uint32_t slot) const override;
+		void BindRadianceMap(uint32_t slot) const override;
+
+	private:
+		std::string m_Path;
+		uint32_t m_Width = 0, m_Height = 0;
+		uint64_t m_HRDRendererID = 0;
+		uint64_t m_RendererID = 0;
+		uint64_t m_IrradianceRendererID = 0;
+		uint64_t m_RadianceRendererID = 0;
+	};
+}
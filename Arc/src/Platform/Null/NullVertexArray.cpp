@@ -0,0 +1,43 @@
+#include "arcpch.h"
+#include "Platform/Null/NullVertexArray.h"
+
+#include "Platform/Null/NullRecorder.h"
+
+namespace ArcEngine
+{
+	NullVertexArray::NullVertexArray()
+		: m_RendererID(NullRecorder::GenerateID())
+	{
+		ARC_PROFILE_SCOPE()
+	}
+
+	void NullVertexArray::Bind() const
+	{
+		ARC_PROFILE_SCOPE()
+
+		NullRecorder::Record(NullCommandType::BindVertexArray, m_RendererID);
+	}
+
+	void NullVertexArray::Unbind() const
+	{
+		ARC_PROFILE_SCOPE()
+
+		NullRecorder::Record(NullCommandType::BindVertexArray, 0);
+	}
+
+	void NullVertexArray::AddVertexBuffer(Ref<VertexBuffer>& vertexBuffer)
+	{
+		ARC_PROFILE_SCOPE()
+
+		ARC_CORE_ASSERT(!vertexBuffer->GetLayout().GetElements().empty(), "Vertex Buffer has no layout!")
+
+		m_VertexBuffers.emplace_back(vertexBuffer);
+	}
+
+	void NullVertexArray::SetIndexBuffer(Ref<IndexBuffer>& indexBuffer)
+	{
+		ARC_PROFILE_SCOPE()
+
+		m_IndexBuffer = indexBuffer;
+	}
+}
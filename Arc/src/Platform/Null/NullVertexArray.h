@@ -0,0 +1,28 @@
+#pragma once
+
+#include "Arc/Renderer/VertexArray.h"
+
+namespace ArcEngine
+{
+	class NullVertexArray : public VertexArray
+	{
+	public:
+		NullVertexArray();
+		~NullVertexArray() override = default;
+
+		NullVertexArray(const NullVertexArray& other) = default;
+		NullVertexArray(NullVertexArray&& other) = default;
+
+		void Bind() const override;
+		void Unbind() const override;
+		void AddVertexBuffer(Ref<VertexBuffer>& vertexBuffer) override;
+		void SetIndexBuffer(Ref<IndexBuffer>& indexBuffer) override;
+		[[nodiscard]] const std::vector<Ref<VertexBuffer>>& GetVertexBuffer() const override { return m_VertexBuffers; }
+		[[nodiscard]] const Ref<IndexBuffer>& GetIndexBuffer() const override { return m_IndexBuffer; }
+
+	private:
+		uint64_t m_RendererID = 0;
+		std::vector<Ref<VertexBuffer>> m_VertexBuffers;
+		Ref<IndexBuffer> m_IndexBuffer;
+	};
+}
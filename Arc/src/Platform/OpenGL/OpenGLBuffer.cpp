@@ -119,6 +119,13 @@ namespace ArcEngine
 		glBindBuffer(GL_UNIFORM_BUFFER, m_RendererID);
 	}
 
+	void OpenGLUniformBuffer::Bind(uint32_t blockIndex) const
+	{
+		ARC_PROFILE_SCOPE()
+
+		glBindBufferBase(GL_UNIFORM_BUFFER, blockIndex, m_RendererID);
+	}
+
 	void OpenGLUniformBuffer::Unbind() const
 	{
 		ARC_PROFILE_SCOPE()
@@ -130,7 +137,7 @@ namespace ArcEngine
 	{
 		ARC_PROFILE_SCOPE()
 
-		glBufferSubData(GL_UNIFORM_BUFFER, offset, size, data);
+		glNamedBufferSubData(m_RendererID, offset, size, data);
 	}
 
 	void OpenGLUniformBuffer::SetLayout(const BufferLayout& layout, uint32_t blockIndex, uint32_t count)
@@ -150,4 +157,52 @@ namespace ArcEngine
 		glBindBuffer(GL_UNIFORM_BUFFER, 0);
 		glBindBufferRange(GL_UNIFORM_BUFFER, blockIndex, m_RendererID, 0, size);
 	}
+
+	void OpenGLUniformBuffer::SetSize(uint32_t size)
+	{
+		ARC_PROFILE_SCOPE()
+
+		glNamedBufferData(m_RendererID, size, nullptr, GL_DYNAMIC_DRAW);
+	}
+
+	//////////////////////////////////////////////////////////////////////
+	// StorageBuffer /////////////////////////////////////////////////////
+	//////////////////////////////////////////////////////////////////////
+
+	OpenGLStorageBuffer::OpenGLStorageBuffer()
+	{
+		ARC_PROFILE_SCOPE()
+
+		glCreateBuffers(1, &m_RendererID);
+	}
+
+	OpenGLStorageBuffer::~OpenGLStorageBuffer()
+	{
+		ARC_PROFILE_SCOPE()
+
+		glDeleteBuffers(1, &m_RendererID);
+	}
+
+	void OpenGLStorageBuffer::Bind(uint32_t blockIndex, uint32_t offset, uint32_t size) const
+	{
+		ARC_PROFILE_SCOPE()
+
+		ARC_CORE_ASSERT(offset % OffsetAlignment == 0, "Storage buffer sections have to be aligned!")
+		ARC_CORE_ASSERT(static_cast<uint64_t>(offset) + size <= m_Capacity, "Storage buffer section is out of bounds!")
+		glBindBufferRange(GL_SHADER_STORAGE_BUFFER, blockIndex, m_RendererID, offset, size);
+	}
+
+	void OpenGLStorageBuffer::SetData(const void* data, uint32_t size)
+	{
+		ARC_PROFILE_SCOPE()
+
+		// Grows by half again so that slowly rising light counts do not reallocate every frame
+		if (size > m_Capacity)
+		{
+			m_Capacity = glm::max(size, m_Capacity + m_Capacity / 2);
+			glNamedBufferData(m_RendererID, m_Capacity, nullptr, GL_DYNAMIC_DRAW);
+		}
+
+		glNamedBufferSubData(m_RendererID, 0, size, data);
+	}
 }
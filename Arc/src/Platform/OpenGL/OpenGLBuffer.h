@@ -56,13 +56,32 @@ namespace ArcEngine
 		OpenGLUniformBuffer(OpenGLUniformBuffer&& other) = default;
 
 		void Bind() const override;
+		void Bind(uint32_t blockIndex) const override;
 		void Unbind() const override;
 
 		void SetData(const void* data, uint32_t offset, uint32_t size) override;
 		void SetLayout(const BufferLayout& layout, uint32_t blockIndex, uint32_t count) override;
+		void SetSize(uint32_t size) override;
 
 	private:
 		uint32_t m_RendererID = 0;
 		BufferLayout m_Layout;
 	};
+
+	class OpenGLStorageBuffer : public StorageBuffer
+	{
+	public:
+		OpenGLStorageBuffer();
+		~OpenGLStorageBuffer() override;
+
+		OpenGLStorageBuffer(const OpenGLStorageBuffer& other) = default;
+		OpenGLStorageBuffer(OpenGLStorageBuffer&& other) = default;
+
+		void Bind(uint32_t blockIndex, uint32_t offset, uint32_t size) const override;
+		void SetData(const void* data, uint32_t size) override;
+
+	private:
+		uint32_t m_RendererID = 0;
+		uint32_t m_Capacity = 0;
+	};
 }
@@ -75,6 +75,15 @@ namespace ArcEngine
 		glDrawElements(GL_TRIANGLES, static_cast<int>(count), GL_UNSIGNED_INT, nullptr);
 	}
 
+	void OpenGLRendererAPI::DrawIndexedInstanced(const Ref<VertexArray>& vertexArray, uint32_t instanceCount, uint32_t indexCount)
+	{
+		ARC_PROFILE_SCOPE()
+
+		vertexArray->Bind();
+		const uint32_t count = indexCount != 0 ? indexCount : vertexArray->GetIndexBuffer()->GetCount();
+		glDrawElementsInstanced(GL_TRIANGLES, static_cast<int>(count), GL_UNSIGNED_INT, nullptr, static_cast<int>(instanceCount));
+	}
+
 	void OpenGLRendererAPI::Draw(const Ref<VertexArray>& vertexArray, uint32_t count)
 	{
 		ARC_PROFILE_SCOPE()
@@ -15,6 +15,7 @@ namespace ArcEngine
 		void SetClearColor(const glm::vec4& color) override;
 		void Clear() override;
 		void DrawIndexed(const Ref<VertexArray>& vertexArray, uint32_t indexCount = 0) override;
+		void DrawIndexedInstanced(const Ref<VertexArray>& vertexArray, uint32_t instanceCount, uint32_t indexCount = 0) override;
 		void Draw(const Ref<VertexArray>& vertexArray, uint32_t count) override;
 		void DrawLines(const Ref<VertexArray>& vertexArray, uint32_t vertexCount) override;
 		void EnableCulling() override;
@@ -5,6 +5,7 @@
 #include <glm/gtc/type_ptr.hpp>
 
 #include "Arc/Core/Filesystem.h"
+#include "Arc/Renderer/ShaderCache.h"
 
 typedef uint32_t GLenum;
 
@@ -23,14 +24,34 @@ namespace ArcEngine
 		return 0;
 	}
 	
+	// Vendor, renderer and version, a binary is only valid for the exact driver that produced it.
+	// Empty when the driver cannot load program binaries, which disables the cache.
+	static const std::string& GetDriverIdentity()
+	{
+		static const std::string identity = []()
+		{
+			GLint formatCount = 0;
+			glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formatCount);
+			if (formatCount == 0)
+				return std::string();
+
+			const auto getString = [](GLenum name)
+			{
+				const GLubyte* str = glGetString(name);
+				return str ? std::string_view(reinterpret_cast<const char*>(str)) : std::string_view();
+			};
+			return fmt::format("{}|{}|{}", getString(GL_VENDOR), getString(GL_RENDERER), getString(GL_VERSION));
+		}();
+
+		return identity;
+	}
+
 	OpenGLShader::OpenGLShader(const std::filesystem::path& filepath)
 	{
 		ARC_PROFILE_SCOPE()
 
-		const std::string source = Filesystem::ReadFileText(filepath);
-		const auto shaderSources = PreProcess(source);
-		Compile(shaderSources);
 		m_Name = filepath.filename().string();
+		Load(filepath);
 	}
 
 	OpenGLShader::~OpenGLShader()
@@ -45,10 +66,10 @@ namespace ArcEngine
 		ARC_PROFILE_SCOPE()
 
 		glDeleteProgram(m_RendererID);
+		m_RendererID = 0;
+		m_UniformLocationCache.clear();
 
-		const std::string source = Filesystem::ReadFileText(filepath);
-		const auto shaderSources = PreProcess(source);
-		Compile(shaderSources);
+		Load(filepath);
 	}
 
 	void OpenGLShader::Bind() const
@@ -181,29 +202,90 @@ namespace ArcEngine
 		return location;
 	}
 
-	std::unordered_map<GLenum, std::string> OpenGLShader::PreProcess(std::string_view source) const
+	void OpenGLShader::Load(const std::filesystem::path& filepath)
 	{
 		ARC_PROFILE_SCOPE()
-		
-		std::unordered_map<GLenum, std::string> shaderSources;
 
-		constexpr const char* typeToken = "#type";
-		constexpr size_t typeTokenLength = std::string_view(typeToken).size();
-		size_t pos = source.find(typeToken, 0);
-		while (pos != std::string::npos)
+		const std::string source = Filesystem::ReadFileText(filepath);
+		const ShaderUtils::StageSources shaderSources = ShaderUtils::PreProcess(source);
+
+		const std::string& driverIdentity = GetDriverIdentity();
+		if (driverIdentity.empty())
 		{
-			const size_t eol = source.find_first_of("\r\n", pos);
-			ARC_CORE_ASSERT(eol != std::string::npos, "Syntax error")
-			const size_t begin = pos + typeTokenLength + 1;
-			const std::string type = static_cast<std::string>(source.substr(begin, eol - begin));
-			ARC_CORE_ASSERT(ShaderTypeFromString(type), "Invalid shader type specified")
-
-			const size_t nextLinePos = source.find_first_not_of("\r\n", eol);
-			pos = source.find(typeToken, nextLinePos);
-			shaderSources[ShaderTypeFromString(type)] = source.substr(nextLinePos, pos - (nextLinePos == std::string::npos ? source.size() - 1 : nextLinePos));
+			Compile(shaderSources);
+			return;
 		}
 
-		return shaderSources;
+		const uint64_t key = ShaderCache::ComputeKey(shaderSources, driverIdentity);
+		if (LoadFromCache(key))
+			return;
+
+		Compile(shaderSources);
+		StoreInCache(key);
+	}
+
+	bool OpenGLShader::LoadFromCache(uint64_t key)
+	{
+		ARC_PROFILE_SCOPE()
+
+		std::optional<ShaderCache::Entry> entry = ShaderCache::Load(m_Name, key);
+		if (!entry)
+			return false;
+
+		const GLuint program = glCreateProgram();
+		glProgramBinary(program, entry->BinaryFormat, entry->Binary.data(), static_cast<GLsizei>(entry->Binary.size()));
+
+		// Drivers may still reject a binary that matches the key, e.g. after a hardware change
+		GLint isLinked = 0;
+		glGetProgramiv(program, GL_LINK_STATUS, &isLinked);
+		if (isLinked == GL_FALSE)
+		{
+			ARC_CORE_WARN("Driver rejected the cached program of {}, compiling it again", m_Name);
+			glDeleteProgram(program);
+			ShaderCache::Remove(m_Name, key);
+			return false;
+		}
+
+		m_RendererID = program;
+		m_MaterialProperties = std::move(entry->MaterialProperties);
+		m_MaterialBlockSize = entry->MaterialBlockSize;
+
+		// Loading a binary resets uniforms, so the sampler units are assigned again
+		static constexpr std::string_view prefix = "u_Material.";
+		for (const auto& [name, property] : m_MaterialProperties)
+		{
+			if (property.Type == MaterialPropertyType::Sampler2D)
+			{
+				const std::string uniformName = fmt::format("u_MaterialTextures.{}", std::string_view(name).substr(prefix.size()));
+				glProgramUniform1i(program, glGetUniformLocation(program, uniformName.c_str()), static_cast<int>(property.TextureSlot));
+			}
+		}
+
+		return true;
+	}
+
+	void OpenGLShader::StoreInCache(uint64_t key) const
+	{
+		ARC_PROFILE_SCOPE()
+
+		if (m_RendererID == 0)
+			return;
+
+		GLint binaryLength = 0;
+		glGetProgramiv(m_RendererID, GL_PROGRAM_BINARY_LENGTH, &binaryLength);
+		if (binaryLength <= 0)
+			return;
+
+		ShaderCache::Entry entry;
+		entry.Binary.resize(static_cast<size_t>(binaryLength));
+		GLenum binaryFormat = 0;
+		glGetProgramBinary(m_RendererID, binaryLength, nullptr, &binaryFormat, entry.Binary.data());
+		entry.BinaryFormat = binaryFormat;
+		entry.MaterialProperties = m_MaterialProperties;
+		entry.MaterialBlockSize = m_MaterialBlockSize;
+
+		if (!ShaderCache::Store(m_Name, key, entry))
+			ARC_CORE_WARN("Failed to write the shader cache entry of {}", m_Name);
 	}
 
 	static MaterialPropertyType GetMaterialPropertyType(GLenum property)
@@ -221,16 +303,19 @@ namespace ArcEngine
 		}
 	}
 
-	void OpenGLShader::Compile(const std::unordered_map<GLenum, std::string>& shaderSources)
+	void OpenGLShader::Compile(const ShaderUtils::StageSources& shaderSources)
 	{
 		ARC_PROFILE_SCOPE()
 
 		const GLuint program = glCreateProgram();
+		glProgramParameteri(program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
 		ARC_CORE_ASSERT(shaderSources.size() <= 2, "We only support 2 shaders for now")
 		std::array<GLenum, 2> glShaderIDs = {};
 		int glShaderIDIndex = 0;
-		for (const auto& [type, source] : shaderSources)
+		for (const auto& [stage, source] : shaderSources)
 		{
+			const GLenum type = ShaderTypeFromString(stage);
+			ARC_CORE_ASSERT(type, "Invalid shader type specified")
 			const GLuint shader = glCreateShader(type);
 			
 			const GLchar* sourceCStr = source.c_str();
@@ -286,16 +371,40 @@ namespace ArcEngine
 			glDetachShader(program, id);
 
 		m_RendererID = program;
+		Reflect();
+	}
+
+	void OpenGLShader::Reflect()
+	{
+		ARC_PROFILE_SCOPE()
+
+		const GLuint program = m_RendererID;
 
-		// Get material properties from the shader
+		// Get material properties from the shader.
+		// Values live in the std140 u_Material block, samplers in u_MaterialTextures get a fixed texture unit here
+		// so that binding a material never has to set uniforms by name.
 		m_MaterialProperties.clear();
+		m_MaterialBlockSize = 0;
+
+		const GLuint materialBlockIndex = glGetUniformBlockIndex(program, "Material");
+		if (materialBlockIndex != GL_INVALID_INDEX)
+		{
+			GLint blockSize = 0;
+			glGetActiveUniformBlockiv(program, materialBlockIndex, GL_UNIFORM_BLOCK_DATA_SIZE, &blockSize);
+			m_MaterialBlockSize = static_cast<size_t>(blockSize);
+		}
+
 		int maxLength;
 		glGetProgramiv(program, GL_ACTIVE_UNIFORM_MAX_LENGTH, &maxLength);
 
 		int uniformCount;
 		glGetProgramiv(program, GL_ACTIVE_UNIFORMS, &uniformCount);
 
-		size_t offset = 0;
+		static constexpr std::string_view blockPrefix = "Material.";
+		static constexpr std::string_view texturePrefix = "u_MaterialTextures.";
+		static constexpr std::string_view prefix = "u_Material.";
+
+		uint32_t textureSlot = 0;
 		for (GLuint i = 0; i < static_cast<GLuint>(uniformCount); i++)
 		{
 			char name[128];
@@ -303,19 +412,41 @@ namespace ArcEngine
 			GLenum type;
 			glGetActiveUniform(program, i, maxLength, nullptr, &size, &type, &name[0]);
 
-			std::string nameStr(name);
-			static constexpr const char* prefix = "u_Material.";
-			static constexpr size_t prefixOffset = std::string_view(prefix).size();
-			if (nameStr.starts_with(prefix))
+			std::string_view nameView(name);
+			const MaterialPropertyType propertyType = GetMaterialPropertyType(type);
+			size_t offset;
+			uint32_t slot = 0;
+			if (nameView.starts_with(blockPrefix))
+			{
+				GLint blockIndex;
+				glGetActiveUniformsiv(program, 1, &i, GL_UNIFORM_BLOCK_INDEX, &blockIndex);
+				if (static_cast<GLuint>(blockIndex) != materialBlockIndex)
+					continue;
+
+				GLint blockOffset;
+				glGetActiveUniformsiv(program, 1, &i, GL_UNIFORM_OFFSET, &blockOffset);
+				offset = static_cast<size_t>(blockOffset);
+				nameView.remove_prefix(blockPrefix.size());
+			}
+			else if (nameView.starts_with(texturePrefix) && propertyType == MaterialPropertyType::Sampler2D)
+			{
+				slot = textureSlot++;
+				offset = m_MaterialBlockSize + slot * sizeof(uint32_t);
+				glProgramUniform1i(program, glGetUniformLocation(program, name), static_cast<int>(slot));
+				nameView.remove_prefix(texturePrefix.size());
+			}
+			else
 			{
-				const MaterialPropertyType propertyType = GetMaterialPropertyType(type);
-				const size_t sizeInBytes = GetSizeInBytes(propertyType);
-				const bool isSlider = nameStr.ends_with("01");
-				const size_t sufixSize = isSlider ? 2 : 0;
-				const bool isColor = nameStr.find("color") != std::string::npos || nameStr.find("Color") != std::string::npos;
-				m_MaterialProperties.emplace(nameStr, MaterialProperty{ propertyType, sizeInBytes, offset, nameStr.substr(prefixOffset, nameStr.size() - prefixOffset - sufixSize), isSlider, isColor });
-				offset += sizeInBytes;
+				continue;
 			}
+
+			std::string nameStr = std::string(prefix) + std::string(nameView);
+			const size_t sizeInBytes = GetSizeInBytes(propertyType);
+			const bool isSlider = nameStr.ends_with("01");
+			const size_t sufixSize = isSlider ? 2 : 0;
+			const bool isColor = nameStr.find("color") != std::string::npos || nameStr.find("Color") != std::string::npos;
+			std::string displayName = nameStr.substr(prefix.size(), nameStr.size() - prefix.size() - sufixSize);
+			m_MaterialProperties.emplace(std::move(nameStr), MaterialProperty{ propertyType, sizeInBytes, offset, std::move(displayName), isSlider, isColor, slot });
 		}
 	}
 }
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Arc/Renderer/Shader.h"
+#include "Arc/Renderer/ShaderUtils.h"
 
 namespace ArcEngine
 {
@@ -29,6 +30,7 @@ namespace ArcEngine
 		void SetUniformBlock(const std::string& name, uint32_t blockIndex) override;
 
 		[[nodiscard]] std::unordered_map<std::string, MaterialProperty, UM_StringTransparentEquality>& GetMaterialProperties() override { return m_MaterialProperties; }
+		[[nodiscard]] size_t GetMaterialBlockSize() const override { return m_MaterialBlockSize; }
 
 		[[nodiscard]] const std::string& GetName() const override { return m_Name; }
 		
@@ -45,13 +47,17 @@ namespace ArcEngine
 
 	private:
 		[[nodiscard]] int GetLocation(const std::string& name);
-		[[nodiscard]] std::unordered_map<uint32_t, std::string> PreProcess(std::string_view source) const;
-		void Compile(const std::unordered_map<uint32_t, std::string>& shaderSources);
+		void Load(const std::filesystem::path& filepath);
+		[[nodiscard]] bool LoadFromCache(uint64_t key);
+		void StoreInCache(uint64_t key) const;
+		void Compile(const ShaderUtils::StageSources& shaderSources);
+		void Reflect();
 
 	private:
 		uint32_t m_RendererID = 0;
 		std::string m_Name;
 		std::unordered_map<std::string, int, UM_StringTransparentEquality> m_UniformLocationCache;
 		std::unordered_map<std::string, MaterialProperty, UM_StringTransparentEquality> m_MaterialProperties;
+		size_t m_MaterialBlockSize = 0;
 	};
 }
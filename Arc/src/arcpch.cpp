@@ -1,10 +1,13 @@
 #include "arcpch.h"
 
-size_t g_ArcAllocationSize = 0;
+// Relaxed atomics, allocations happen on worker threads too and only the totals matter
+std::atomic<size_t> g_ArcAllocationSize = 0;
+std::atomic<uint64_t> g_ArcAllocationCount = 0;
 
 namespace ArcEngine::Allocation
 {
-	size_t GetSize() { return g_ArcAllocationSize; }
+	size_t GetSize() { return g_ArcAllocationSize.load(std::memory_order_relaxed); }
+	uint64_t GetCount() { return g_ArcAllocationCount.load(std::memory_order_relaxed); }
 }
 
 void* operator new(size_t size)
@@ -12,12 +15,13 @@ void* operator new(size_t size)
 	if (size == 0)
 		++size;
 
-	g_ArcAllocationSize += size;
+	g_ArcAllocationSize.fetch_add(size, std::memory_order_relaxed);
+	g_ArcAllocationCount.fetch_add(1, std::memory_order_relaxed);
 	return std::malloc(size);
 }
 
 void operator delete(void* ptr, size_t size) noexcept
 {
-	g_ArcAllocationSize -= size;
+	g_ArcAllocationSize.fetch_sub(size, std::memory_order_relaxed);
 	std::free(ptr);
 }
@@ -11,6 +11,7 @@
 
 #include <sstream>
 
+#include <atomic>
 #include <future>
 #include <memory>
 #include <utility>
@@ -41,5 +42,8 @@
 
 namespace ArcEngine::Allocation
 {
+	// Bytes currently allocated through operator new
 	size_t GetSize();
+	// Calls to operator new since startup
+	uint64_t GetCount();
 }
@@ -96,4 +96,5 @@ group ""
 
 include "Arc"
 include "Arc-Editor"
+include "Arc-Benchmark"
 include "Arc-ScriptCore"